@@ -16,8 +16,18 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "cJSON.h"
 #include "board.h"
+#include "patterns.h"
+#include "eval_terms.h"
+#include "symmetry.h"
+#include "wire.h"
 
 // Platform compatibility
 #ifdef _WIN32
@@ -32,16 +42,14 @@
     }
 #endif
 
-// ===== GENERATED AI DATA =====
-#ifdef HAS_OPENING_BOOK
-#include "opening_book_data.h"
+// SIMD intrinsics for the NNUE kernels (picked at runtime, see nnue_init)
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define NNUE_X86_KERNELS 1
 #endif
-
-#if __has_include("nnue_weights_generated.h")
-    #include "nnue_weights_generated.h"
-    #define HAS_NNUE_WEIGHTS 1
-#else
-    #define HAS_NNUE_WEIGHTS 0
+#if defined(__ARM_NEON)
+    #include <arm_neon.h>
+    #define NNUE_NEON_KERNEL 1
 #endif
 
 // ===== GAME CONSTANTS =====
@@ -63,11 +71,20 @@
 #define MAX_MOVES 200
 #define TIME_LIMIT 3.0
 #define SAFETY_MARGIN 0.1
+#define DEADLINE_MARGIN 1.0   // Seconds kept back from the server's time_left_ms for network and scheduling
 #define BUFFER_SIZE 4096
 
 // ===== HASH TABLE (Optimized for RPi) =====
 #define HASH_SIZE (1 << 18)  // 256K entries for RPi
 #define HASH_MASK (HASH_SIZE - 1)
+#define SYMMETRY_MIN_EMPTY 44  // Symmetric positions share TT / eval cache entries while this many squares are empty
+
+// ===== EVALUATION CACHE =====
+#define EVAL_CACHE_SIZE (1 << 16)  // 64K entries, 1.5 MB
+#define EVAL_CACHE_MASK (EVAL_CACHE_SIZE - 1)
+#define EVAL_CACHE_SIDE_KEY 0x9E3779B97F4A7C15ULL  // xored into the key when BLUE is to move
+#define EVAL_CACHE_HAS_NNUE (1ULL << 16)
+#define EVAL_CACHE_HAS_CLASSIC (1ULL << 17)
 
 // ===== MCTS CONSTANTS (Simplified and Optimized) =====
 #define MCTS_C 1.414                  // UCB constant (sqrt(2))
@@ -76,9 +93,13 @@
 #define MCTS_MAX_CHILDREN 50           // Maximum children per node
 #define MCTS_SIMULATION_DEPTH 30       // Max moves in simulation
 #define MCTS_MIN_VISITS 10             // Minimum visits for robust selection
+#define MCTS_SIMS_PER_THREAD 4         // Simulations per worker for fresh leaves
+#define MCTS_RAVE_EQUIV 300.0          // RAVE equivalence parameter k: beta = sqrt(k / (3n + k))
+#define MCTS_MAX_TRACE 128             // Max moves recorded per iteration for AMAF
 
 // ===== MINIMAX CONSTANTS =====
 #define MINIMAX_THREADS 4
+#define ORDERING_SLOTS (MINIMAX_THREADS + 1)  // Ordering tables: one per worker, the last for the main thread
 #define ASPIRATION_WINDOW 50
 
 // ===== PHASE CONSTANTS =====
@@ -90,43 +111,21 @@
 #define DEFAULT_SERVER_IP "10.8.128.233"
 #define DEFAULT_SERVER_PORT "8080"
 
-// ===== POSITION WEIGHTS (Carefully redesigned for OctaFlip) =====
-
-// Opening: 중앙 제어 + 초기 위치 활용
-static const double POSITION_WEIGHTS_OPENING[8][8] = {
-    { 20, -10,  10,   5,   5,  10, -10,  20},
-    {-10, -20,   5,   5,   5,   5, -20, -10},
-    { 10,   5,  15,  20,  20,  15,   5,  10},
-    {  5,   5,  20,  25,  25,  20,   5,   5},
-    {  5,   5,  20,  25,  25,  20,   5,   5},
-    { 10,   5,  15,  20,  20,  15,   5,  10},
-    {-10, -20,   5,   5,   5,   5, -20, -10},
-    { 20, -10,  10,   5,   5,  10, -10,  20}
-};
-
-// Midgame: 안정성 vs 기동성 균형
-static const double POSITION_WEIGHTS_MIDGAME[8][8] = {
-    { 50, -20,  20,  10,  10,  20, -20,  50},
-    {-20, -40,   0,   0,   0,   0, -40, -20},
-    { 20,   0,  10,  10,  10,  10,   0,  20},
-    { 10,   0,  10,  15,  15,  10,   0,  10},
-    { 10,   0,  10,  15,  15,  10,   0,  10},
-    { 20,   0,  10,  10,  10,  10,   0,  20},
-    {-20, -40,   0,   0,   0,   0, -40, -20},
-    { 50, -20,  20,  10,  10,  20, -20,  50}
-};
+// ===== NNUE CONSTANTS =====
+#define NNUE_INPUT_SIZE 192            // 64 squares x {red, blue, empty}
+#define NNUE_HIDDEN1_SIZE 128          // Layer sizes the kernels are built for;
+#define NNUE_HIDDEN2_SIZE 64           // a network file must match them
+#define NNUE_HIDDEN3_SIZE 32
+#define NNUE_FILE_MAGIC "OFNN"
+#define NNUE_FILE_VERSION 2
+#define DEFAULT_NNUE_FILE "octaflip.nnue"
 
-// Endgame: 코너와 엣지가 결정적
-static const double POSITION_WEIGHTS_ENDGAME[8][8] = {
-    {100, -40,  40,  30,  30,  40, -40, 100},
-    {-40, -80, -10, -10, -10, -10, -80, -40},
-    { 40, -10,  10,   0,   0,  10, -10,  40},
-    { 30, -10,   0,   0,   0,   0, -10,  30},
-    { 30, -10,   0,   0,   0,   0, -10,  30},
-    { 40, -10,  10,   0,   0,  10, -10,  40},
-    {-40, -80, -10, -10, -10, -10, -80, -40},
-    {100, -40,  40,  30,  30,  40, -40, 100}
-};
+// ===== OPENING BOOK CONSTANTS =====
+#define BOOK_FILE_MAGIC "OFBK"
+#define BOOK_FILE_VERSION 2
+#define DEFAULT_BOOK_FILE "octaflip.book"
+#define BOOK_MIN_COUNT 10              // Book moves played in fewer games are ignored
+#define BOOK_SIDE_KEY 0x9E3779B97F4A7C15ULL  // xored into the key when BLUE is to move
 
 // Move structure
 typedef struct {
@@ -135,6 +134,30 @@ typedef struct {
     int moveType;
 } Move;
 
+// Everything needed to take a move back (squares that changed)
+typedef struct {
+    Move move;
+    char mover;
+    int flipCount;
+    unsigned char flipped[8];  // r * BOARD_SIZE + c of each flipped piece
+} MoveUndo;
+
+// NNUE first-layer accumulator: b1 + sum of the w1 rows of all active
+// features, kept in sync with a board through makeMoveWithUndo/undoMove
+typedef struct {
+    int32_t v[NNUE_HIDDEN1_SIZE];
+} NNUEAccumulator;
+
+// Classical eval state, kept in sync with a board through makeMoveWithUndo/
+// undoMove like the NNUE accumulator: piece bitboards, each side's sum over
+// every position table, and the Zobrist hash
+typedef struct {
+    Bitboard red, blue, empty;
+    double pst[PST_TABLES][2];  // [table][RED_TURN / BLUE_TURN]
+    uint16_t pattern[PATTERN_INSTANCES];  // base-3 index of each pattern instance
+    unsigned long long hash;
+} EvalState;
+
 // Transposition Table Entry
 typedef struct {
     unsigned long long hash;
@@ -144,6 +167,31 @@ typedef struct {
     Move bestMove;
 } TTEntry;
 
+// Move ordering tables of one search thread. Killers are indexed by ply from
+// the search root, history by side to move and (from, to), counter-moves by
+// the opponent's previous move (from, to) and hold the reply as from << 6 | to
+// (0 = none).
+typedef struct {
+    Move killers[MAX_DEPTH][2];
+    int history[2][BOARD_SIZE * BOARD_SIZE][BOARD_SIZE * BOARD_SIZE];
+    uint16_t counterMoves[BOARD_SIZE * BOARD_SIZE][BOARD_SIZE * BOARD_SIZE];
+} OrderingTables;
+
+// Evaluation cache entry, shared by all search threads without locks. The
+// three words are written separately, so check holds key ^ classic ^ meta:
+// a torn entry (two threads storing at once) simply fails the key test.
+typedef struct {
+    atomic_ullong check;
+    atomic_ullong classic;  // evaluateTapered result, bits of the double
+    atomic_ullong meta;     // int16 NNUE score | HAS_NNUE | HAS_CLASSIC
+} EvalCacheEntry;
+
+// AMAF (all-moves-as-first) statistics, indexed by [target square][move type - 1]
+typedef struct {
+    int visits[BOARD_SIZE * BOARD_SIZE][2];
+    double totalScore[BOARD_SIZE * BOARD_SIZE][2];
+} MCTSAmafTable;
+
 // MCTS Node (Simplified)
 typedef struct MCTSNode {
     Move move;
@@ -156,8 +204,17 @@ typedef struct MCTSNode {
     int childCount;
     int childCapacity;
     int fullyExpanded;
+    MCTSAmafTable* amaf;  // Only allocated for expanded nodes in RAVE mode
 } MCTSNode;
 
+// Moves played during one playout (for AMAF updates)
+typedef struct {
+    unsigned char square[MCTS_MAX_TRACE];
+    unsigned char type[MCTS_MAX_TRACE];
+    unsigned char player[MCTS_MAX_TRACE];
+    int length;
+} MCTSTrace;
+
 // Thread data structures
 typedef struct {
     char board[BOARD_SIZE][BOARD_SIZE];
@@ -212,16 +269,33 @@ static int boardServerEnabled = 1;
 static int led_initialized = 0;
 static int totalMoveCount = 0;
 static GamePhase currentPhase = PHASE_OPENING;
+static int mctsRaveEnabled = 0;
+static const char* nnueKernelRequest = "auto";
+static char nnueNetPath[256] = DEFAULT_NNUE_FILE;
+static int nnueNetRequired = 0;  // -net given explicitly: failing to load it is fatal
+static int evalStateEnabled = 1;  // Cleared if EvalState disagrees with the board at startup
+static char patternPath[256] = DEFAULT_PATTERN_FILE;
+static int patternRequired = 0;  // -patterns given explicitly: failing to load it is fatal
+static int patternsLoaded = 0;
+static char bookPath[256] = DEFAULT_BOOK_FILE;
+static int bookRequired = 0;  // -book given explicitly: failing to load it is fatal
+static int wireRequested = 0;  // -binary: ask the server for wire.h frames
+static atomic_int wireActive = 0;  // The server's register_ack accepted them
+static int rejoinEnabled = 0;  // -rejoin: register again after game over (arena mode)
 
 // AI optimization globals
 static struct timespec searchStart;
 static atomic_int timeUp = 0;
 static TTEntry* transpositionTable = NULL;
+static EvalCacheEntry* evalCache = NULL;
+static atomic_long evalCacheProbes;
+static atomic_long evalCacheHits;
 static unsigned long long zobristTable[BOARD_SIZE][BOARD_SIZE][4];
-static Move killerMoves[MAX_DEPTH][2];
-static int historyTable[BOARD_SIZE][BOARD_SIZE][BOARD_SIZE][BOARD_SIZE];
+static OrderingTables orderingTables[ORDERING_SLOTS];
+static __thread OrderingTables* ordering = &orderingTables[ORDERING_SLOTS - 1];  // This thread's tables
 static atomic_long nodeCount;
 static double timeAllocated = TIME_LIMIT;
+static double moveTimeLimit = TIME_LIMIT;  // This move's budget, from your_turn when the server sends one
 
 // Position history for repetition detection
 static unsigned long long positionHistory[10];
@@ -244,10 +318,17 @@ void cleanupAISystem();
 Move generate_move();
 int isValidMove(int sx, int sy, int tx, int ty);
 void makeMove(char board[BOARD_SIZE][BOARD_SIZE], Move move);
+void makeMoveWithUndo(char board[BOARD_SIZE][BOARD_SIZE], Move move, MoveUndo* undo);
+void undoMove(char board[BOARD_SIZE][BOARD_SIZE], const MoveUndo* undo);
 void getAllValidMoves(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, Move* moves, int* moveCount);
 double evaluateBoard(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer);
-double evaluateBoardPhased(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase);
-double evaluateHybrid(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase);
+double evaluateBoardTapered(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer);
+double evaluateHybrid(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase,
+                      const NNUEAccumulator* acc);
+void evalCache_clear();
+void eval_refreshState(EvalState* es, char board[BOARD_SIZE][BOARD_SIZE]);
+void eval_applyMove(EvalState* es, const MoveUndo* undo);
+void eval_undoMove(EvalState* es, const MoveUndo* undo);
 double elapsedSeconds();
 void initZobrist();
 unsigned long long computeHash(char board[BOARD_SIZE][BOARD_SIZE]);
@@ -274,33 +355,54 @@ MCTSNode* mcts_createNode(Move move, int player, MCTSNode* parent);
 void mcts_freeTree(MCTSNode* root);
 MCTSNode* mcts_selectChild(MCTSNode* node);
 void mcts_expand(MCTSNode* node, char board[BOARD_SIZE][BOARD_SIZE]);
-double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int player, bool useNN);
+double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int player, bool useNN, MCTSTrace* trace);
 void mcts_backpropagate(MCTSNode* node, double score);
+void mcts_updateAmaf(MCTSNode* leaf, double score, const MCTSTrace* playout);
 Move mcts_getBestMove(MCTSNode* root);
 Move mcts_search(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, bool useNN);
 
 // Improved Minimax functions (Eunsong style)
-int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int beta, 
-                  int currentPlayer, Move* bestMove, GamePhase phase, bool useHybrid);
+int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int ply, int alpha, int beta, 
+                  int currentPlayer, const Move* lastMove, Move* bestMove, GamePhase phase, bool useHybrid,
+                  NNUEAccumulator* acc, EvalState* es);
 void orderMovesPhased(Move* moves, int moveCount, char board[BOARD_SIZE][BOARD_SIZE], 
-                      int currentPlayer, int depth, GamePhase phase);
+                      int currentPlayer, GamePhase phase);
 void* minimaxWorkerPhased(void* arg);
+void ordering_age();
 
 // Network functions
 void sendJSON(cJSON* json);
 void sendRegister(const char* username);
 void sendMove(int sx, int sy, int tx, int ty);
 void handleServerMessage(const char* message);
+void handleServerFrame(const uint8_t* payload, size_t len);
 void* receiveMessages(void* arg);
 void updateBoardFromJSON(cJSON* board_array);
 void printBoard();
+void resetBoard();
 void cleanup();
 void sigint_handler(int sig);
 
+// Pattern functions
+void pattern_init();
+int pattern_load(const char* path);
+
+// Opening book functions
+void book_init();
+int book_load(const char* path);
+int book_probe(char board[BOARD_SIZE][BOARD_SIZE], int player, Move* moves, int moveCount, Move* bookMove);
+
 // NNUE functions
-#ifdef HAS_NNUE_WEIGHTS
+static uint32_t nnue_checksum(const unsigned char* data, size_t len);
 static int nnue_evaluate(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer);
-#endif
+static int nnue_evaluateAccumulator(const NNUEAccumulator* acc, int forPlayer);
+void nnue_init();
+int nnue_loadNetwork(const char* path);
+void nnue_checkForUpdate();
+bool nnue_available();
+void nnue_refreshAccumulator(NNUEAccumulator* acc, char board[BOARD_SIZE][BOARD_SIZE]);
+void nnue_applyMove(NNUEAccumulator* acc, const MoveUndo* undo);
+void nnue_undoMove(NNUEAccumulator* acc, const MoveUndo* undo);
 
 // LED functions
 void initLEDDisplay();
@@ -359,6 +461,28 @@ unsigned long long computeHash(char board[BOARD_SIZE][BOARD_SIZE]) {
     return hash;
 }
 
+// Red, blue and blocked squares as bitboards (for the symmetry keys)
+static void boardBitboards(char board[BOARD_SIZE][BOARD_SIZE], Bitboard* red, Bitboard* blue, Bitboard* blocked) {
+    *red = *blue = *blocked = 0;
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        char cell = board[sq / BOARD_SIZE][sq % BOARD_SIZE];
+        if (cell == RED) *red |= 1ULL << sq;
+        else if (cell == BLUE) *blue |= 1ULL << sq;
+        else if (cell == BLOCKED) *blocked |= 1ULL << sq;
+    }
+}
+
+// Move m under symmetry t
+static inline Move symmetricMove(Move m, int t) {
+    int from = sym_square(t, m.r1 * BOARD_SIZE + m.c1);
+    int to = sym_square(t, m.r2 * BOARD_SIZE + m.c2);
+    m.r1 = from / BOARD_SIZE;
+    m.c1 = from % BOARD_SIZE;
+    m.r2 = to / BOARD_SIZE;
+    m.c2 = to % BOARD_SIZE;
+    return m;
+}
+
 int countPieces(char board[BOARD_SIZE][BOARD_SIZE], char piece) {
     int count = 0;
     for (int i = 0; i < BOARD_SIZE; i++) {
@@ -423,6 +547,48 @@ void makeMove(char board[BOARD_SIZE][BOARD_SIZE], Move move) {
     }
 }
 
+// Same as makeMove, but records what changed so the move can be taken back
+void makeMoveWithUndo(char board[BOARD_SIZE][BOARD_SIZE], Move move, MoveUndo* undo) {
+    char playerPiece = board[move.r1][move.c1];
+    char opponentPiece = (playerPiece == RED) ? BLUE : RED;
+    
+    undo->move = move;
+    undo->mover = playerPiece;
+    undo->flipCount = 0;
+    
+    board[move.r2][move.c2] = playerPiece;
+    
+    if (move.moveType == JUMP) {
+        board[move.r1][move.c1] = EMPTY;
+    }
+    
+    for (int dr = -1; dr <= 1; dr++) {
+        for (int dc = -1; dc <= 1; dc++) {
+            if (dr == 0 && dc == 0) continue;
+            
+            int nr = move.r2 + dr;
+            int nc = move.c2 + dc;
+            
+            if (nr >= 0 && nr < BOARD_SIZE && nc >= 0 && nc < BOARD_SIZE &&
+                board[nr][nc] == opponentPiece) {
+                board[nr][nc] = playerPiece;
+                undo->flipped[undo->flipCount++] = nr * BOARD_SIZE + nc;
+            }
+        }
+    }
+}
+
+void undoMove(char board[BOARD_SIZE][BOARD_SIZE], const MoveUndo* undo) {
+    char opponentPiece = (undo->mover == RED) ? BLUE : RED;
+    
+    for (int i = 0; i < undo->flipCount; i++) {
+        board[undo->flipped[i] / BOARD_SIZE][undo->flipped[i] % BOARD_SIZE] = opponentPiece;
+    }
+    
+    board[undo->move.r2][undo->move.c2] = EMPTY;
+    board[undo->move.r1][undo->move.c1] = undo->mover;
+}
+
 void getAllValidMoves(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, Move* moves, int* moveCount) {
     char playerPiece = (currentPlayer == RED_TURN) ? RED : BLUE;
     *moveCount = 0;
@@ -755,12 +921,116 @@ void addToHistory(unsigned long long hash, Move move) {
     moveHistoryCount++;
 }
 
+// ===== PATTERN EVALUATION =====
+
+// Table values, all types back to back at PATTERN_TABLE_OFFSET, indexed by
+// the red/blue digits EvalState keeps: [RED_TURN] as stored in the file,
+// [BLUE_TURN] with the colours of each index swapped
+static int16_t patternValues[2][PATTERN_VALUE_COUNT];
+
+// Pattern instances each square belongs to, with its digit weight there
+typedef struct {
+    int count;
+    uint8_t instance[4];
+    uint16_t weight[4];
+} PatternSquareRefs;
+
+static PatternSquareRefs patternRefs[BOARD_SIZE * BOARD_SIZE];
+
+static inline int pattern_digit(char piece) {
+    return piece == RED ? 1 : (piece == BLUE ? 2 : 0);
+}
+
+// Sum of all instances' table values for side, taken as the side to move
+static inline int pattern_score(const uint16_t* index, int side) {
+    int score = 0;
+    for (int i = 0; i < PATTERN_INSTANCES; i++) {
+        score += patternValues[side][PATTERN_TABLE_OFFSET[PATTERN_LIST[i].type] + index[i]];
+    }
+    return score;
+}
+
+// Read the pattern tables written by pattern_fit
+int pattern_load(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (!file) {
+        safePrint("Patterns: cannot open %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+    
+    PatternFileHeader header;
+    static int16_t values[PATTERN_VALUE_COUNT];
+    const char* error = NULL;
+    
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, PATTERN_FILE_MAGIC, sizeof(header.magic)) != 0) {
+        error = "not a pattern file";
+    } else if (header.version != PATTERN_FILE_VERSION) {
+        error = "unsupported version";
+    } else if (header.payloadBytes != sizeof(values)) {
+        error = "table sizes do not match this build";
+    } else {
+        for (int t = 0; t < PATTERN_TYPES; t++) {
+            if (header.tableSize[t] != (uint32_t)PATTERN_TABLE_SIZE[t]) {
+                error = "table sizes do not match this build";
+            }
+        }
+    }
+    
+    if (!error && (fread(values, sizeof(values), 1, file) != 1 || fgetc(file) != EOF)) {
+        error = "wrong file size";
+    } else if (!error && nnue_checksum((const unsigned char*)values, sizeof(values)) != header.checksum) {
+        error = "checksum mismatch";
+    }
+    fclose(file);
+    
+    if (error) {
+        safePrint("Patterns: %s: %s\n", path, error);
+        return 0;
+    }
+    
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        for (int index = 0; index < PATTERN_TABLE_SIZE[t]; index++) {
+            int swapped = 0;
+            for (int k = 0, rest = index, weight = 1; k < PATTERN_LENGTH[t]; k++, rest /= 3, weight *= 3) {
+                swapped += (rest % 3 ? 3 - rest % 3 : 0) * weight;
+            }
+            patternValues[RED_TURN][PATTERN_TABLE_OFFSET[t] + index] = values[PATTERN_TABLE_OFFSET[t] + index];
+            patternValues[BLUE_TURN][PATTERN_TABLE_OFFSET[t] + index] = values[PATTERN_TABLE_OFFSET[t] + swapped];
+        }
+    }
+    patternsLoaded = 1;
+    safePrint("Patterns: loaded %s\n", path);
+    return 1;
+}
+
+void pattern_init() {
+    memset(patternRefs, 0, sizeof(patternRefs));
+    for (int i = 0; i < PATTERN_INSTANCES; i++) {
+        int weight = 1;
+        for (int k = 0; k < PATTERN_LENGTH[PATTERN_LIST[i].type]; k++) {
+            PatternSquareRefs* refs = &patternRefs[PATTERN_LIST[i].squares[k]];
+            refs->instance[refs->count] = i;
+            refs->weight[refs->count] = weight;
+            refs->count++;
+            weight *= 3;
+        }
+    }
+    
+    if (!pattern_load(patternPath)) {
+        if (patternRequired) {
+            exit(1);
+        }
+        safePrint("Patterns: Disabled (corner/edge heuristics)\n");
+    }
+}
+
 double evaluateBoard(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer) {
-    GamePhase phase = getGamePhase(board);
-    return evaluateBoardPhased(board, forPlayer, phase);
+    return evaluateBoardTapered(board, forPlayer);
 }
 
-double evaluateBoardPhased(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase) {
+// Square-by-square version, kept as the reference for verifyEvalState
+static double evaluateBoardReference(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer) {
     int redCount = countPieces(board, RED);
     int blueCount = countPieces(board, BLUE);
     
@@ -775,87 +1045,76 @@ double evaluateBoardPhased(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, Ga
     double score = 0.0;
     int pieceDiff = (forPlayer == RED_TURN) ? (redCount - blueCount) : (blueCount - redCount);
     
-    // 기본 재료 점수 (phase별 가중치)
-    double pieceMultiplier;
-    switch (phase) {
-        case PHASE_OPENING:
-            pieceMultiplier = 80.0;
-            break;
-        case PHASE_MIDGAME:
-            pieceMultiplier = 100.0;
-            break;
-        case PHASE_ENDGAME_EARLY:
-            pieceMultiplier = 120.0;
-            break;
-        case PHASE_ENDGAME_LATE:
-            pieceMultiplier = 200.0;  // 종반엔 각 말이 매우 중요
-            break;
-    }
-    score += pieceDiff * pieceMultiplier;
-    
-    // 위치 가중치 선택
-    const double (*posWeights)[8];
-    switch (phase) {
-        case PHASE_OPENING:
-            posWeights = POSITION_WEIGHTS_OPENING;
-            break;
-        case PHASE_MIDGAME:
-            posWeights = POSITION_WEIGHTS_MIDGAME;
-            break;
-        case PHASE_ENDGAME_EARLY:
-        case PHASE_ENDGAME_LATE:
-            posWeights = POSITION_WEIGHTS_ENDGAME;
-            break;
-    }
+    // 재료 점수와 위치 가중치 (보드 채움 정도에 따라 phase 사이를 보간)
+    double pieceValue, tableWeight[PST_TABLES];
+    taperWeights(redCount + blueCount, countPieces(board, EMPTY), &pieceValue, tableWeight);
+    score += pieceDiff * pieceValue;
     
     char playerPiece = (forPlayer == RED_TURN) ? RED : BLUE;
     char opponentPiece = (forPlayer == RED_TURN) ? BLUE : RED;
     
     // 위치 평가
-    double myPositionScore = 0.0;
-    double oppPositionScore = 0.0;
-    
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            if (board[i][j] == playerPiece) {
-                myPositionScore += posWeights[i][j];
-            } else if (board[i][j] == opponentPiece) {
-                oppPositionScore += posWeights[i][j];
+    for (int t = 0; t < PST_TABLES; t++) {
+        double myPositionScore = 0.0;
+        double oppPositionScore = 0.0;
+        
+        for (int i = 0; i < BOARD_SIZE; i++) {
+            for (int j = 0; j < BOARD_SIZE; j++) {
+                if (board[i][j] == playerPiece) {
+                    myPositionScore += POSITION_TABLES[t][i][j];
+                } else if (board[i][j] == opponentPiece) {
+                    oppPositionScore += POSITION_TABLES[t][i][j];
+                }
             }
         }
+        
+        score += tableWeight[t] * (myPositionScore - oppPositionScore);
     }
     
-    score += (myPositionScore - oppPositionScore);
-    
-    // 추가 패턴 평가
-    int myCorners = 0, oppCorners = 0;
-    int myXSquares = 0, oppXSquares = 0;
-    
-    // 코너 체크
-    if (board[0][0] == playerPiece) myCorners++;
-    if (board[0][7] == playerPiece) myCorners++;
-    if (board[7][0] == playerPiece) myCorners++;
-    if (board[7][7] == playerPiece) myCorners++;
-    
-    if (board[0][0] == opponentPiece) oppCorners++;
-    if (board[0][7] == opponentPiece) oppCorners++;
-    if (board[7][0] == opponentPiece) oppCorners++;
-    if (board[7][7] == opponentPiece) oppCorners++;
-    
-    // X-square 체크 (코너 소유 여부에 따라 다르게 평가)
-    if (board[1][1] == playerPiece && board[0][0] != playerPiece) myXSquares++;
-    if (board[1][6] == playerPiece && board[0][7] != playerPiece) myXSquares++;
-    if (board[6][1] == playerPiece && board[7][0] != playerPiece) myXSquares++;
-    if (board[6][6] == playerPiece && board[7][7] != playerPiece) myXSquares++;
-    
-    if (board[1][1] == opponentPiece && board[0][0] != opponentPiece) oppXSquares++;
-    if (board[1][6] == opponentPiece && board[0][7] != opponentPiece) oppXSquares++;
-    if (board[6][1] == opponentPiece && board[7][0] != opponentPiece) oppXSquares++;
-    if (board[6][6] == opponentPiece && board[7][7] != opponentPiece) oppXSquares++;
-    
-    // 코너와 X-square 보너스/페널티
-    score += (myCorners - oppCorners) * 300;
-    score -= (myXSquares - oppXSquares) * 150;
+    if (patternsLoaded) {
+        // 패턴 테이블 (forPlayer 차례 기준 남은 점수 차, disc 단위)
+        uint16_t index[PATTERN_INSTANCES];
+        for (int p = 0; p < PATTERN_INSTANCES; p++) {
+            int weight = 1;
+            index[p] = 0;
+            for (int k = 0; k < PATTERN_LENGTH[PATTERN_LIST[p].type]; k++) {
+                int sq = PATTERN_LIST[p].squares[k];
+                index[p] += pattern_digit(board[sq / BOARD_SIZE][sq % BOARD_SIZE]) * weight;
+                weight *= 3;
+            }
+        }
+        score += pattern_score(index, forPlayer) * pieceValue / PATTERN_UNITS;
+    } else {
+        // 추가 패턴 평가
+        int myCorners = 0, oppCorners = 0;
+        int myXSquares = 0, oppXSquares = 0;
+        
+        // 코너 체크
+        if (board[0][0] == playerPiece) myCorners++;
+        if (board[0][7] == playerPiece) myCorners++;
+        if (board[7][0] == playerPiece) myCorners++;
+        if (board[7][7] == playerPiece) myCorners++;
+        
+        if (board[0][0] == opponentPiece) oppCorners++;
+        if (board[0][7] == opponentPiece) oppCorners++;
+        if (board[7][0] == opponentPiece) oppCorners++;
+        if (board[7][7] == opponentPiece) oppCorners++;
+        
+        // X-square 체크 (코너 소유 여부에 따라 다르게 평가)
+        if (board[1][1] == playerPiece && board[0][0] != playerPiece) myXSquares++;
+        if (board[1][6] == playerPiece && board[0][7] != playerPiece) myXSquares++;
+        if (board[6][1] == playerPiece && board[7][0] != playerPiece) myXSquares++;
+        if (board[6][6] == playerPiece && board[7][7] != playerPiece) myXSquares++;
+        
+        if (board[1][1] == opponentPiece && board[0][0] != opponentPiece) oppXSquares++;
+        if (board[1][6] == opponentPiece && board[0][7] != opponentPiece) oppXSquares++;
+        if (board[6][1] == opponentPiece && board[7][0] != opponentPiece) oppXSquares++;
+        if (board[6][6] == opponentPiece && board[7][7] != opponentPiece) oppXSquares++;
+        
+        // 코너와 X-square 보너스/페널티
+        score += (myCorners - oppCorners) * CORNER_BONUS;
+        score -= (myXSquares - oppXSquares) * X_SQUARE_PENALTY;
+    }
     
     // 기동성 (가능한 수의 개수)
     Move tempMoves[MAX_MOVES];
@@ -863,7 +1122,7 @@ double evaluateBoardPhased(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, Ga
     getAllValidMoves(board, forPlayer, tempMoves, &myMobility);
     getAllValidMoves(board, 1 - forPlayer, tempMoves, &oppMobility);
     
-    score += (myMobility - oppMobility) * 5;
+    score += (myMobility - oppMobility) * MOBILITY_WEIGHT;
     
     // 연결성 보너스
     int connectivity = 0;
@@ -883,28 +1142,361 @@ double evaluateBoardPhased(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, Ga
             }
         }
     }
-    score += connectivity * 3;
+    score += connectivity * CONNECTIVITY_WEIGHT;
+    
+    if (!patternsLoaded) {
+        // 엣지 제어 보너스
+        int edgeCount = 0;
+        for (int i = 0; i < BOARD_SIZE; i++) {
+            if (board[0][i] == playerPiece) edgeCount++;
+            if (board[7][i] == playerPiece) edgeCount++;
+            if (board[i][0] == playerPiece && i != 0 && i != 7) edgeCount++;
+            if (board[i][7] == playerPiece && i != 0 && i != 7) edgeCount++;
+        }
+        score += edgeCount * EDGE_WEIGHT;
+    }
     
-    // 엣지 제어 보너스
-    int edgeCount = 0;
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[0][i] == playerPiece) edgeCount++;
-        if (board[7][i] == playerPiece) edgeCount++;
-        if (board[i][0] == playerPiece && i != 0 && i != 7) edgeCount++;
-        if (board[i][7] == playerPiece && i != 0 && i != 7) edgeCount++;
+    return score;
+}
+
+// ===== OPENING BOOK =====
+
+// File layout (little-endian): this header, then count entries sorted by key
+typedef struct {
+    char magic[4];         // BOOK_FILE_MAGIC
+    uint32_t version;
+    uint32_t count;
+    uint32_t checksum;     // FNV-1a over the entries
+} BookFileHeader;
+
+// One book move. A position is stored under its sym_canonicalKey (xor
+// BOOK_SIDE_KEY when BLUE is to move), with from/to (r * 8 + c) in the
+// frame of that canonical image.
+typedef struct {
+    uint64_t key;
+    uint32_t count;        // Games that played this move
+    uint16_t weight;       // Its share of the position's games, in 1/65535
+    uint8_t from, to;
+} BookEntry;
+
+static struct {
+    const BookEntry* entries;
+    uint32_t count;
+    void* map;
+    size_t mapSize;
+} openingBook;
+
+// Map and validate a book file written by train_octoflip.py --export-book
+int book_load(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        safePrint("Book: cannot open %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(BookFileHeader)) {
+        safePrint("Book: %s is not a book file\n", path);
+        close(fd);
+        return 0;
+    }
+    
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        safePrint("Book: cannot map %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+    
+    const BookFileHeader* header = (const BookFileHeader*)map;
+    const BookEntry* entries = (const BookEntry*)(header + 1);
+    const char* error = NULL;
+    
+    if (memcmp(header->magic, BOOK_FILE_MAGIC, sizeof(header->magic)) != 0) {
+        error = "bad magic";
+    } else if (header->version != BOOK_FILE_VERSION) {
+        error = "unsupported version";
+    } else if ((size_t)st.st_size != sizeof(BookFileHeader) + (size_t)header->count * sizeof(BookEntry)) {
+        error = "wrong file size";
+    } else if (nnue_checksum((const unsigned char*)entries, header->count * sizeof(BookEntry)) != header->checksum) {
+        error = "checksum mismatch";
+    } else {
+        for (uint32_t i = 0; i < header->count && !error; i++) {
+            if (i > 0 && entries[i].key < entries[i - 1].key) {
+                error = "entries not sorted";
+            } else if (entries[i].from >= BOARD_SIZE * BOARD_SIZE || entries[i].to >= BOARD_SIZE * BOARD_SIZE) {
+                error = "bad square";
+            }
+        }
+    }
+    
+    if (error) {
+        safePrint("Book: %s: %s\n", path, error);
+        munmap(map, st.st_size);
+        return 0;
+    }
+    
+    openingBook.entries = entries;
+    openingBook.count = header->count;
+    openingBook.map = map;
+    openingBook.mapSize = st.st_size;
+    safePrint("Book: loaded %s (%u moves)\n", path, header->count);
+    return 1;
+}
+
+void book_init() {
+    if (!book_load(bookPath)) {
+        if (bookRequired) {
+            exit(1);
+        }
+        safePrint("Book: Disabled\n");
+    }
+}
+
+// Most played book move of this position that is in moves[] (the legal
+// moves); 0 when the position is not in the book
+int book_probe(char board[BOARD_SIZE][BOARD_SIZE], int player, Move* moves, int moveCount, Move* bookMove) {
+    if (openingBook.count == 0) return 0;
+    
+    Bitboard red, blue, blocked;
+    boardBitboards(board, &red, &blue, &blocked);
+    int t;
+    unsigned long long key = sym_canonicalKey(red, blue, blocked, &t) ^ (player == RED_TURN ? 0 : BOOK_SIDE_KEY);
+    
+    uint32_t lo = 0, hi = openingBook.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (openingBook.entries[mid].key < key) lo = mid + 1;
+        else hi = mid;
+    }
+    
+    int found = 0;
+    int bestWeight = -1;
+    for (uint32_t i = lo; i < openingBook.count && openingBook.entries[i].key == key; i++) {
+        const BookEntry* e = &openingBook.entries[i];
+        if (e->count < BOOK_MIN_COUNT || e->weight <= bestWeight) continue;
+        
+        int from = sym_square(sym_inverse(t), e->from);
+        int to = sym_square(sym_inverse(t), e->to);
+        
+        for (int m = 0; m < moveCount; m++) {
+            if (moves[m].r1 * BOARD_SIZE + moves[m].c1 == from &&
+                moves[m].r2 * BOARD_SIZE + moves[m].c2 == to) {
+                *bookMove = moves[m];
+                bestWeight = e->weight;
+                found = 1;
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+// ===== INCREMENTAL EVAL STATE =====
+
+void eval_refreshState(EvalState* es, char board[BOARD_SIZE][BOARD_SIZE]) {
+    memset(es, 0, sizeof(*es));
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        int r = sq / BOARD_SIZE, c = sq % BOARD_SIZE;
+        if (board[r][c] == RED || board[r][c] == BLUE) {
+            int side = (board[r][c] == RED) ? RED_TURN : BLUE_TURN;
+            if (side == RED_TURN) es->red |= 1ULL << sq;
+            else es->blue |= 1ULL << sq;
+            for (int t = 0; t < PST_TABLES; t++) {
+                es->pst[t][side] += POSITION_TABLES[t][r][c];
+            }
+        } else if (board[r][c] == EMPTY) {
+            es->empty |= 1ULL << sq;
+        }
+        
+        const PatternSquareRefs* refs = &patternRefs[sq];
+        for (int i = 0; i < refs->count; i++) {
+            es->pattern[refs->instance[i]] += pattern_digit(board[r][c]) * refs->weight[i];
+        }
+    }
+    es->hash = computeHash(board);
+}
+
+// Add (sign 1) or remove (sign -1) a piece of side on an otherwise empty square
+static inline void eval_togglePiece(EvalState* es, int side, int sq, int sign) {
+    int r = sq / BOARD_SIZE, c = sq % BOARD_SIZE;
+    Bitboard bit = 1ULL << sq;
+    if (side == RED_TURN) es->red ^= bit;
+    else es->blue ^= bit;
+    es->empty ^= bit;
+    for (int t = 0; t < PST_TABLES; t++) {
+        es->pst[t][side] += sign * POSITION_TABLES[t][r][c];
+    }
+    const PatternSquareRefs* refs = &patternRefs[sq];
+    for (int i = 0; i < refs->count; i++) {
+        es->pattern[refs->instance[i]] += sign * (side + 1) * refs->weight[i];
+    }
+    es->hash ^= zobristTable[r][c][side] ^ zobristTable[r][c][2];
+}
+
+// Change the owner of a piece
+static inline void eval_flipPiece(EvalState* es, int toSide, int sq) {
+    int r = sq / BOARD_SIZE, c = sq % BOARD_SIZE;
+    Bitboard bit = 1ULL << sq;
+    es->red ^= bit;
+    es->blue ^= bit;
+    for (int t = 0; t < PST_TABLES; t++) {
+        es->pst[t][toSide] += POSITION_TABLES[t][r][c];
+        es->pst[t][1 - toSide] -= POSITION_TABLES[t][r][c];
+    }
+    const PatternSquareRefs* refs = &patternRefs[sq];
+    for (int i = 0; i < refs->count; i++) {
+        // Digit 1 (red) <-> 2 (blue)
+        es->pattern[refs->instance[i]] += (toSide == BLUE_TURN ? 1 : -1) * refs->weight[i];
+    }
+    es->hash ^= zobristTable[r][c][0] ^ zobristTable[r][c][1];
+}
+
+// Update for a move just made with makeMoveWithUndo
+void eval_applyMove(EvalState* es, const MoveUndo* undo) {
+    int side = (undo->mover == RED) ? RED_TURN : BLUE_TURN;
+    
+    eval_togglePiece(es, side, undo->move.r2 * BOARD_SIZE + undo->move.c2, 1);
+    if (undo->move.moveType == JUMP) {
+        eval_togglePiece(es, side, undo->move.r1 * BOARD_SIZE + undo->move.c1, -1);
+    }
+    for (int i = 0; i < undo->flipCount; i++) {
+        eval_flipPiece(es, side, undo->flipped[i]);
+    }
+}
+
+// Exact inverse of eval_applyMove
+void eval_undoMove(EvalState* es, const MoveUndo* undo) {
+    int side = (undo->mover == RED) ? RED_TURN : BLUE_TURN;
+    
+    for (int i = 0; i < undo->flipCount; i++) {
+        eval_flipPiece(es, 1 - side, undo->flipped[i]);
+    }
+    if (undo->move.moveType == JUMP) {
+        eval_togglePiece(es, side, undo->move.r1 * BOARD_SIZE + undo->move.c1, 1);
+    }
+    eval_togglePiece(es, side, undo->move.r2 * BOARD_SIZE + undo->move.c2, -1);
+}
+
+// Classical evaluation from an EvalState; no per-square work
+static double evaluateTapered(const EvalState* es, int forPlayer) {
+    int redCount = __builtin_popcountll(es->red);
+    int blueCount = __builtin_popcountll(es->blue);
+    
+    // 게임 종료 체크
+    if (redCount == 0) {
+        return (forPlayer == BLUE_TURN) ? INF_SCORE : NEG_INF_SCORE;
+    }
+    if (blueCount == 0) {
+        return (forPlayer == RED_TURN) ? INF_SCORE : NEG_INF_SCORE;
+    }
+    
+    Bitboard mine = (forPlayer == RED_TURN) ? es->red : es->blue;
+    Bitboard theirs = (forPlayer == RED_TURN) ? es->blue : es->red;
+    
+    double score = 0.0;
+    int pieceDiff = (forPlayer == RED_TURN) ? (redCount - blueCount) : (blueCount - redCount);
+    
+    double pieceValue, tableWeight[PST_TABLES];
+    taperWeights(redCount + blueCount, __builtin_popcountll(es->empty), &pieceValue, tableWeight);
+    score += pieceDiff * pieceValue;
+    
+    for (int t = 0; t < PST_TABLES; t++) {
+        score += tableWeight[t] * (es->pst[t][forPlayer] - es->pst[t][1 - forPlayer]);
+    }
+    
+    if (patternsLoaded) {
+        // 패턴 테이블 (forPlayer 차례 기준 남은 점수 차, disc 단위)
+        score += pattern_score(es->pattern, forPlayer) * pieceValue / PATTERN_UNITS;
+    } else {
+        // 코너와 X-square 보너스/페널티
+        score += (__builtin_popcountll(mine & BB_CORNERS) - __builtin_popcountll(theirs & BB_CORNERS)) * CORNER_BONUS;
+        score -= (bb_xSquares(mine) - bb_xSquares(theirs)) * X_SQUARE_PENALTY;
+    }
+    
+    // 기동성
+    score += (bb_moveCount(mine, es->empty, MAX_MOVES) - bb_moveCount(theirs, es->empty, MAX_MOVES)) * MOBILITY_WEIGHT;
+    
+    // 연결성, 엣지
+    score += bb_connectivity(mine) * CONNECTIVITY_WEIGHT;
+    if (!patternsLoaded) {
+        score += __builtin_popcountll(mine & BB_EDGES) * EDGE_WEIGHT;
     }
-    score += edgeCount * 10;
     
     return score;
 }
 
-// Hybrid evaluation function for Tournament Beast
-double evaluateHybrid(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase) {
-    double classicEval = evaluateBoardPhased(board, forPlayer, phase);
+double evaluateBoardTapered(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer) {
+    if (!evalStateEnabled) {
+        return evaluateBoardReference(board, forPlayer);
+    }
     
-    #ifdef HAS_NNUE_WEIGHTS
-    double nnueEval = nnue_evaluate(board, forPlayer);
+    EvalState es;
+    eval_refreshState(&es, board);
+    return evaluateTapered(&es, forPlayer);
+}
+
+// Play a few random games (with blocked squares and take-backs) keeping an
+// EvalState in sync incrementally, and compare it with a fresh one and its
+// evaluation with the reference at every step
+static int verifyEvalState() {
+    unsigned int seed = 12345;
+    
+    for (int game = 0; game < 8; game++) {
+        char board[BOARD_SIZE][BOARD_SIZE];
+        memset(board, EMPTY, sizeof(board));
+        board[0][0] = RED;
+        board[7][7] = RED;
+        board[0][7] = BLUE;
+        board[7][0] = BLUE;
+        for (int i = 0; i < game; i++) {
+            int r = 1 + rand_r(&seed) % 6, c = 1 + rand_r(&seed) % 6;
+            board[r][c] = BLOCKED;
+        }
+        
+        EvalState es;
+        eval_refreshState(&es, board);
+        
+        int player = RED_TURN;
+        for (int ply = 0; ply < 80; ply++) {
+            EvalState fresh;
+            eval_refreshState(&fresh, board);
+            if (memcmp(&fresh, &es, sizeof(es)) != 0) {
+                return 0;
+            }
+            for (int side = RED_TURN; side <= BLUE_TURN; side++) {
+                if (evaluateTapered(&es, side) != evaluateBoardReference(board, side)) {
+                    return 0;
+                }
+            }
+            
+            Move moves[MAX_MOVES];
+            int moveCount;
+            getAllValidMoves(board, player, moves, &moveCount);
+            if (moveCount == 0) {
+                player = 1 - player;
+                getAllValidMoves(board, player, moves, &moveCount);
+                if (moveCount == 0) break;
+            }
+            
+            // Try one move and take it back before playing another
+            MoveUndo undo;
+            makeMoveWithUndo(board, moves[rand_r(&seed) % moveCount], &undo);
+            eval_applyMove(&es, &undo);
+            eval_undoMove(&es, &undo);
+            undoMove(board, &undo);
+            
+            makeMoveWithUndo(board, moves[rand_r(&seed) % moveCount], &undo);
+            eval_applyMove(&es, &undo);
+            player = 1 - player;
+        }
+    }
     
+    return 1;
+}
+
+// Phase-specific mix of the classical and NNUE scores
+static double blendHybrid(double classicEval, double nnueEval, GamePhase phase) {
     // Phase-specific blend weights
     double nnWeight;
     switch (phase) {
@@ -923,78 +1515,932 @@ double evaluateHybrid(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePha
     }
     
     return classicEval * (1.0 - nnWeight) + nnueEval * nnWeight;
-    #else
-    return classicEval;
-    #endif
+}
+
+// Hybrid evaluation function for Tournament Beast
+double evaluateHybrid(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase,
+                      const NNUEAccumulator* acc) {
+    double classicEval = evaluateBoardTapered(board, forPlayer);
+    
+    if (!nnue_available()) {
+        return classicEval;
+    }
+    
+    double nnueEval = acc ? nnue_evaluateAccumulator(acc, forPlayer) : nnue_evaluate(board, forPlayer);
+    
+    return blendHybrid(classicEval, nnueEval, phase);
+}
+
+void evalCache_clear() {
+    if (evalCache) {
+        memset(evalCache, 0, EVAL_CACHE_SIZE * sizeof(EvalCacheEntry));
+    }
+}
+
+void evalCache_resetStats() {
+    atomic_store(&evalCacheProbes, 0);
+    atomic_store(&evalCacheHits, 0);
+}
+
+void evalCache_printStats(const char* engine) {
+    long probes = atomic_load(&evalCacheProbes);
+    long hits = atomic_load(&evalCacheHits);
+    safePrint("%s eval cache: %ld/%ld hits (%.1f%%)\n", engine, hits, probes,
+              probes ? 100.0 * hits / probes : 0.0);
+}
+
+// TT and eval cache key. While SYMMETRY_MIN_EMPTY squares are empty the 8
+// symmetric images of a position share one entry: the key is canonical and
+// *symmetry maps this board onto the stored frame. Later positions rarely
+// meet their images again and keep the Zobrist hash (*symmetry = 0).
+// The classical eval is symmetric; an NNUE score is shared with the images
+// of its position, which the network only scores approximately alike.
+static inline unsigned long long searchKey(char board[BOARD_SIZE][BOARD_SIZE], const EvalState* es, int* symmetry) {
+    *symmetry = 0;
+    Bitboard red, blue, blocked;
+    if (evalStateEnabled) {
+        if (__builtin_popcountll(es->empty) < SYMMETRY_MIN_EMPTY) return es->hash;
+        red = es->red;
+        blue = es->blue;
+        blocked = ~(es->red | es->blue | es->empty);
+    } else {
+        boardBitboards(board, &red, &blue, &blocked);
+        if (64 - __builtin_popcountll(red | blue | blocked) < SYMMETRY_MIN_EMPTY) return computeHash(board);
+    }
+    return sym_canonicalKey(red, blue, blocked, symmetry);
+}
+
+// Leaf evaluation for negamaxPhased (evaluateHybrid or the classical eval)
+// through the eval cache. The two components are cached separately and
+// blended here, so the phase weights never invalidate an entry.
+static double evaluateLeaf(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer, GamePhase phase,
+                           bool useHybrid, const NNUEAccumulator* acc, const EvalState* es) {
+    bool wantNNUE = useHybrid && nnue_available();
+    int symmetry;
+    unsigned long long hash = searchKey(board, es, &symmetry);
+    unsigned long long key = hash ^ (forPlayer == RED_TURN ? 0 : EVAL_CACHE_SIDE_KEY);
+    EvalCacheEntry* entry = &evalCache[key & EVAL_CACHE_MASK];
+    
+    unsigned long long check = atomic_load_explicit(&entry->check, memory_order_relaxed);
+    unsigned long long classicBits = atomic_load_explicit(&entry->classic, memory_order_relaxed);
+    unsigned long long meta = atomic_load_explicit(&entry->meta, memory_order_relaxed);
+    if ((check ^ classicBits ^ meta) != key) {
+        meta = 0;  // Empty, another position, or torn
+    }
+    
+    bool haveClassic = (meta & EVAL_CACHE_HAS_CLASSIC) != 0;
+    bool haveNNUE = (meta & EVAL_CACHE_HAS_NNUE) != 0;
+    
+    atomic_fetch_add_explicit(&evalCacheProbes, 1, memory_order_relaxed);
+    if (haveClassic && (haveNNUE || !wantNNUE)) {
+        atomic_fetch_add_explicit(&evalCacheHits, 1, memory_order_relaxed);
+    }
+    
+    double classicEval;
+    if (haveClassic) {
+        memcpy(&classicEval, &classicBits, sizeof(classicEval));
+    } else {
+        classicEval = evalStateEnabled ? evaluateTapered(es, forPlayer) :
+                                         evaluateBoardReference(board, forPlayer);
+        memcpy(&classicBits, &classicEval, sizeof(classicBits));
+    }
+    
+    int nnueEval = 0;
+    if (haveNNUE) {
+        nnueEval = (int16_t)(meta & 0xFFFF);
+    } else if (wantNNUE) {
+        nnueEval = acc ? nnue_evaluateAccumulator(acc, forPlayer) : nnue_evaluate(board, forPlayer);
+        haveNNUE = true;
+    }
+    
+    if (!haveClassic || (wantNNUE && !(meta & EVAL_CACHE_HAS_NNUE))) {
+        unsigned long long newMeta = EVAL_CACHE_HAS_CLASSIC;
+        if (haveNNUE) {
+            newMeta |= EVAL_CACHE_HAS_NNUE | (uint16_t)nnueEval;
+        }
+        atomic_store_explicit(&entry->classic, classicBits, memory_order_relaxed);
+        atomic_store_explicit(&entry->meta, newMeta, memory_order_relaxed);
+        atomic_store_explicit(&entry->check, key ^ classicBits ^ newMeta, memory_order_relaxed);
+    }
+    
+    return wantNNUE ? blendHybrid(classicEval, nnueEval, phase) : classicEval;
 }
 
 // ===== NNUE EVALUATION =====
-#ifdef HAS_NNUE_WEIGHTS
-static int nnue_evaluate(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer) {
-    int16_t input[INPUT_SIZE] = {0};
+// Network file layout (little-endian): this header, then
+//   int8  w1[in][h1], int32 b1[h1]
+//   int8  w2[h1][h2], int32 b2[h2]
+//   int8  w3[h2][h3], int32 b3[h3]
+//   int16 w4[h3],     int32 b4[1]
+// (weights [in][out], batch norm already folded in by the exporter), then
+// testVectors x NNUETestVector. Hidden layer n outputs
+//   trunc(sum / (sum > 0 ? actDiv[n][0] : actDiv[n][1]))
+// which is the Leaky ReLU plus the requantization to the next layer's int16
+// units. The output is tanh(sum / outputDiv / 2) * 2 * outputScale, the same
+// squashing the trainer uses.
+typedef struct {
+    char magic[4];         // NNUE_FILE_MAGIC
+    uint32_t version;
+    uint32_t inputSize;
+    uint32_t hidden1;
+    uint32_t hidden2;
+    uint32_t hidden3;
+    double actDiv[3][2];   // {positive, negative} divisor per hidden layer
+    double outputDiv;
+    int32_t outputScale;
+    uint32_t testVectors;
+    uint32_t payloadBytes;
+    uint32_t checksum;     // FNV-1a over the payload
+} NNUEFileHeader;
+
+// Reference position with the exporter's output for it, checked at load
+typedef struct {
+    char board[BOARD_SIZE * BOARD_SIZE];  // row-major RED/BLUE/EMPTY/BLOCKED
+    int32_t expected;                     // output-layer sum before tanh, RED's view
+} NNUETestVector;
+
+_Static_assert(sizeof(NNUEFileHeader) == 96, "NNUEFileHeader must match the exporter");
+_Static_assert(sizeof(NNUETestVector) == 68, "NNUETestVector must match the exporter");
+
+#define NNUE_WEIGHT_BYTES (NNUE_INPUT_SIZE * NNUE_HIDDEN1_SIZE + 4 * NNUE_HIDDEN1_SIZE + \
+                           NNUE_HIDDEN1_SIZE * NNUE_HIDDEN2_SIZE + 4 * NNUE_HIDDEN2_SIZE + \
+                           NNUE_HIDDEN2_SIZE * NNUE_HIDDEN3_SIZE + 4 * NNUE_HIDDEN3_SIZE + \
+                           2 * NNUE_HIDDEN3_SIZE + 4)
+
+// The loaded network; tensors point into the read-only mapping
+typedef struct {
+    const int8_t* w1;
+    const int32_t* b1;
+    const int8_t* w2;
+    const int32_t* b2;
+    const int8_t* w3;
+    const int32_t* b3;
+    const int16_t* w4;
+    const int32_t* b4;
+    double actDiv[3][2];
+    double outputDiv;
+    int32_t outputScale;
+    void* map;             // NULL while no network is loaded
+    size_t mapSize;
+    struct stat st;        // to notice a replaced file between games
+} NNUENetwork;
+
+static NNUENetwork nnueNet;
+
+bool nnue_available() {
+    return nnueNet.map != NULL;
+}
+
+// Input feature for a square: RED at idx, BLUE at idx + 64, EMPTY at idx + 128
+static inline int nnue_feature(char piece, int sq) {
+    switch (piece) {
+        case RED: return sq;
+        case BLUE: return sq + 64;
+        case EMPTY: return sq + 128;
+        default: return -1;  // BLOCKED has no input
+    }
+}
+
+// The input is one-hot per square, so the first layer is just b1 plus one
+// weight row per occupied square. The rows are copied here packed to the
+// hidden width (int8, 24 KB) so a row add walks one short contiguous block.
+static int8_t nnue_w1Rows[NNUE_INPUT_SIZE][NNUE_HIDDEN1_SIZE];
+
+// Upper layers re-laid for the SIMD kernels: inputs 2j and 2j+1 sit next to
+// each other for every output, so one madd covers two inputs per lane. The
+// int8 weights are widened to int16 here since the activations are int16.
+static int16_t nnue_w2Pairs[NNUE_HIDDEN1_SIZE / 2][NNUE_HIDDEN2_SIZE][2] __attribute__((aligned(32)));
+static int16_t nnue_w3Pairs[NNUE_HIDDEN2_SIZE / 2][NNUE_HIDDEN3_SIZE][2] __attribute__((aligned(32)));
+static int32_t nnue_b2Aligned[NNUE_HIDDEN2_SIZE] __attribute__((aligned(32)));
+static int32_t nnue_b3Aligned[NNUE_HIDDEN3_SIZE] __attribute__((aligned(32)));
+
+_Static_assert(NNUE_HIDDEN1_SIZE % 8 == 0 && NNUE_HIDDEN2_SIZE % 8 == 0 &&
+               NNUE_HIDDEN3_SIZE % 8 == 0, "NNUE kernels need layer sizes in multiples of 8");
+
+typedef struct {
+    const char* name;
+    int (*supported)(void);
+    void (*accAdd)(int32_t* acc, const int8_t* row);
+    void (*accSub)(int32_t* acc, const int8_t* row);
+    int32_t (*forward)(const int32_t* acc);  // upper layers, output-layer sum
+} NNUEKernel;
+
+// ----- Scalar reference kernel -----
+static int nnue_supportsScalar(void) {
+    return 1;
+}
+
+static void nnue_accAddScalar(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+        acc[i] += row[i];
+    }
+}
+
+static void nnue_accSubScalar(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+        acc[i] -= row[i];
+    }
+}
+
+// Leaky ReLU + requantization of one hidden unit
+static inline int32_t nnue_leakyDiv(int32_t x, const double div[2]) {
+    return (int32_t)((double)x / (x > 0 ? div[0] : div[1]));
+}
+
+// nnue_leakyDiv saturated to int16, as the SIMD kernels do
+static inline int16_t nnue_leakyClamp(int32_t x, const double div[2]) {
+    int32_t y = nnue_leakyDiv(x, div);
+    return (int16_t)(y > INT16_MAX ? INT16_MAX : (y < INT16_MIN ? INT16_MIN : y));
+}
+
+// Straight from the mapped network; the test vectors and the SIMD kernels
+// are checked against this
+static int32_t nnue_forwardNet(const NNUENetwork* net, const int32_t* acc) {
+    // Layer 1 activation
+    int16_t acc1[NNUE_HIDDEN1_SIZE];
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+        acc1[i] = nnue_leakyClamp(acc[i], net->actDiv[0]);
+    }
+    
+    // Layer 2
+    int16_t acc2[NNUE_HIDDEN2_SIZE];
+    for (int i = 0; i < NNUE_HIDDEN2_SIZE; i++) {
+        int32_t sum = net->b2[i];
+        for (int j = 0; j < NNUE_HIDDEN1_SIZE; j++) {
+            sum += acc1[j] * net->w2[j * NNUE_HIDDEN2_SIZE + i];
+        }
+        acc2[i] = nnue_leakyClamp(sum, net->actDiv[1]);
+    }
+    
+    // Layer 3
+    int16_t acc3[NNUE_HIDDEN3_SIZE];
+    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
+        int32_t sum = net->b3[i];
+        for (int j = 0; j < NNUE_HIDDEN2_SIZE; j++) {
+            sum += acc2[j] * net->w3[j * NNUE_HIDDEN3_SIZE + i];
+        }
+        acc3[i] = nnue_leakyClamp(sum, net->actDiv[2]);
+    }
+    
+    // Output layer
+    int32_t output = net->b4[0];
+    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
+        output += acc3[i] * net->w4[i];
+    }
+    
+    return output;
+}
+
+static int32_t nnue_forwardScalar(const int32_t* acc) {
+    return nnue_forwardNet(&nnueNet, acc);
+}
+
+// Output layer is 32 MACs, not worth vectorizing
+static inline int32_t nnue_outputLayer(const int16_t* a3) {
+    int32_t output = nnueNet.b4[0];
+    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
+        output += a3[i] * nnueNet.w4[i];
+    }
+    return output;
+}
+
+#ifdef NNUE_X86_KERNELS
+// The x86 kernels do the leaky division in double precision, exactly the
+// operation nnue_leakyDiv performs, so the results match bit for bit.
+
+// ----- SSE4.1 kernel -----
+static int nnue_supportsSSE41(void) {
+    return __builtin_cpu_supports("sse4.1");
+}
+
+__attribute__((target("sse4.1")))
+static void nnue_accAddSSE41(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 16) {
+        __m128i w = _mm_loadu_si128((const __m128i*)(row + i));
+        for (int k = 0; k < 4; k++) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(acc + i + 4 * k));
+            _mm_storeu_si128((__m128i*)(acc + i + 4 * k), _mm_add_epi32(a, _mm_cvtepi8_epi32(w)));
+            w = _mm_srli_si128(w, 4);
+        }
+    }
+}
+
+__attribute__((target("sse4.1")))
+static void nnue_accSubSSE41(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 16) {
+        __m128i w = _mm_loadu_si128((const __m128i*)(row + i));
+        for (int k = 0; k < 4; k++) {
+            __m128i a = _mm_loadu_si128((const __m128i*)(acc + i + 4 * k));
+            _mm_storeu_si128((__m128i*)(acc + i + 4 * k), _mm_sub_epi32(a, _mm_cvtepi8_epi32(w)));
+            w = _mm_srli_si128(w, 4);
+        }
+    }
+}
+
+// 4 lanes of x / (x > 0 ? pos : neg), truncated
+__attribute__((target("sse4.1")))
+static inline __m128i nnue_leaky4SSE41(__m128i x, __m128d pos, __m128d neg) {
+    __m128d zero = _mm_setzero_pd();
+    __m128d lo = _mm_cvtepi32_pd(x);
+    __m128d hi = _mm_cvtepi32_pd(_mm_unpackhi_epi64(x, x));
+    lo = _mm_div_pd(lo, _mm_blendv_pd(neg, pos, _mm_cmpgt_pd(lo, zero)));
+    hi = _mm_div_pd(hi, _mm_blendv_pd(neg, pos, _mm_cmpgt_pd(hi, zero)));
+    return _mm_unpacklo_epi64(_mm_cvttpd_epi32(lo), _mm_cvttpd_epi32(hi));
+}
+
+// 8 lanes, saturated to int16
+__attribute__((target("sse4.1")))
+static inline __m128i nnue_leaky8SSE41(__m128i x0, __m128i x1, __m128d pos, __m128d neg) {
+    return _mm_packs_epi32(nnue_leaky4SSE41(x0, pos, neg), nnue_leaky4SSE41(x1, pos, neg));
+}
+
+__attribute__((target("sse4.1")))
+static int32_t nnue_forwardSSE41(const int32_t* acc) {
+    int16_t a1[NNUE_HIDDEN1_SIZE] __attribute__((aligned(16)));
+    int16_t a2[NNUE_HIDDEN2_SIZE] __attribute__((aligned(16)));
+    int16_t a3[NNUE_HIDDEN3_SIZE] __attribute__((aligned(16)));
+    const __m128d pos1 = _mm_set1_pd(nnueNet.actDiv[0][0]);
+    const __m128d neg1 = _mm_set1_pd(nnueNet.actDiv[0][1]);
+    const __m128d pos2 = _mm_set1_pd(nnueNet.actDiv[1][0]);
+    const __m128d neg2 = _mm_set1_pd(nnueNet.actDiv[1][1]);
+    const __m128d pos3 = _mm_set1_pd(nnueNet.actDiv[2][0]);
+    const __m128d neg3 = _mm_set1_pd(nnueNet.actDiv[2][1]);
+    
+    // Layer 1 activation
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 8) {
+        __m128i v0 = _mm_loadu_si128((const __m128i*)(acc + i));
+        __m128i v1 = _mm_loadu_si128((const __m128i*)(acc + i + 4));
+        _mm_store_si128((__m128i*)(a1 + i), nnue_leaky8SSE41(v0, v1, pos1, neg1));
+    }
+    
+    // Layer 2
+    __m128i sum2[NNUE_HIDDEN2_SIZE / 4];
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k++) {
+        sum2[k] = _mm_load_si128((const __m128i*)(nnue_b2Aligned + 4 * k));
+    }
+    for (int j = 0; j < NNUE_HIDDEN1_SIZE / 2; j++) {
+        int32_t pair;
+        memcpy(&pair, a1 + 2 * j, sizeof(pair));
+        __m128i in = _mm_set1_epi32(pair);
+        for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k++) {
+            __m128i w = _mm_load_si128((const __m128i*)nnue_w2Pairs[j][4 * k]);
+            sum2[k] = _mm_add_epi32(sum2[k], _mm_madd_epi16(w, in));
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k += 2) {
+        _mm_store_si128((__m128i*)(a2 + 4 * k),
+                        nnue_leaky8SSE41(sum2[k], sum2[k + 1], pos2, neg2));
+    }
+    
+    // Layer 3
+    __m128i sum3[NNUE_HIDDEN3_SIZE / 4];
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k++) {
+        sum3[k] = _mm_load_si128((const __m128i*)(nnue_b3Aligned + 4 * k));
+    }
+    for (int j = 0; j < NNUE_HIDDEN2_SIZE / 2; j++) {
+        int32_t pair;
+        memcpy(&pair, a2 + 2 * j, sizeof(pair));
+        __m128i in = _mm_set1_epi32(pair);
+        for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k++) {
+            __m128i w = _mm_load_si128((const __m128i*)nnue_w3Pairs[j][4 * k]);
+            sum3[k] = _mm_add_epi32(sum3[k], _mm_madd_epi16(w, in));
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k += 2) {
+        _mm_store_si128((__m128i*)(a3 + 4 * k),
+                        nnue_leaky8SSE41(sum3[k], sum3[k + 1], pos3, neg3));
+    }
+    
+    return nnue_outputLayer(a3);
+}
+
+// ----- AVX2 kernel -----
+static int nnue_supportsAVX2(void) {
+    return __builtin_cpu_supports("avx2");
+}
+
+__attribute__((target("avx2")))
+static void nnue_accAddAVX2(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 16) {
+        __m128i w = _mm_loadu_si128((const __m128i*)(row + i));
+        __m256i a0 = _mm256_loadu_si256((const __m256i*)(acc + i));
+        __m256i a1 = _mm256_loadu_si256((const __m256i*)(acc + i + 8));
+        a0 = _mm256_add_epi32(a0, _mm256_cvtepi8_epi32(w));
+        a1 = _mm256_add_epi32(a1, _mm256_cvtepi8_epi32(_mm_srli_si128(w, 8)));
+        _mm256_storeu_si256((__m256i*)(acc + i), a0);
+        _mm256_storeu_si256((__m256i*)(acc + i + 8), a1);
+    }
+}
+
+__attribute__((target("avx2")))
+static void nnue_accSubAVX2(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 16) {
+        __m128i w = _mm_loadu_si128((const __m128i*)(row + i));
+        __m256i a0 = _mm256_loadu_si256((const __m256i*)(acc + i));
+        __m256i a1 = _mm256_loadu_si256((const __m256i*)(acc + i + 8));
+        a0 = _mm256_sub_epi32(a0, _mm256_cvtepi8_epi32(w));
+        a1 = _mm256_sub_epi32(a1, _mm256_cvtepi8_epi32(_mm_srli_si128(w, 8)));
+        _mm256_storeu_si256((__m256i*)(acc + i), a0);
+        _mm256_storeu_si256((__m256i*)(acc + i + 8), a1);
+    }
+}
+
+// 8 lanes of x / (x > 0 ? pos : neg), truncated and saturated to int16
+__attribute__((target("avx2")))
+static inline __m128i nnue_leaky8AVX2(__m256i x, __m256d pos, __m256d neg) {
+    __m256d zero = _mm256_setzero_pd();
+    __m256d lo = _mm256_cvtepi32_pd(_mm256_castsi256_si128(x));
+    __m256d hi = _mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1));
+    lo = _mm256_div_pd(lo, _mm256_blendv_pd(neg, pos, _mm256_cmp_pd(lo, zero, _CMP_GT_OQ)));
+    hi = _mm256_div_pd(hi, _mm256_blendv_pd(neg, pos, _mm256_cmp_pd(hi, zero, _CMP_GT_OQ)));
+    return _mm_packs_epi32(_mm256_cvttpd_epi32(lo), _mm256_cvttpd_epi32(hi));
+}
+
+__attribute__((target("avx2")))
+static int32_t nnue_forwardAVX2(const int32_t* acc) {
+    int16_t a1[NNUE_HIDDEN1_SIZE] __attribute__((aligned(32)));
+    int16_t a2[NNUE_HIDDEN2_SIZE] __attribute__((aligned(32)));
+    int16_t a3[NNUE_HIDDEN3_SIZE] __attribute__((aligned(32)));
+    const __m256d pos1 = _mm256_set1_pd(nnueNet.actDiv[0][0]);
+    const __m256d neg1 = _mm256_set1_pd(nnueNet.actDiv[0][1]);
+    const __m256d pos2 = _mm256_set1_pd(nnueNet.actDiv[1][0]);
+    const __m256d neg2 = _mm256_set1_pd(nnueNet.actDiv[1][1]);
+    const __m256d pos3 = _mm256_set1_pd(nnueNet.actDiv[2][0]);
+    const __m256d neg3 = _mm256_set1_pd(nnueNet.actDiv[2][1]);
+    
+    // Layer 1 activation
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(acc + i));
+        _mm_store_si128((__m128i*)(a1 + i), nnue_leaky8AVX2(v, pos1, neg1));
+    }
+    
+    // Layer 2
+    __m256i sum2[NNUE_HIDDEN2_SIZE / 8];
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 8; k++) {
+        sum2[k] = _mm256_load_si256((const __m256i*)(nnue_b2Aligned + 8 * k));
+    }
+    for (int j = 0; j < NNUE_HIDDEN1_SIZE / 2; j++) {
+        int32_t pair;
+        memcpy(&pair, a1 + 2 * j, sizeof(pair));
+        __m256i in = _mm256_set1_epi32(pair);
+        for (int k = 0; k < NNUE_HIDDEN2_SIZE / 8; k++) {
+            __m256i w = _mm256_load_si256((const __m256i*)nnue_w2Pairs[j][8 * k]);
+            sum2[k] = _mm256_add_epi32(sum2[k], _mm256_madd_epi16(w, in));
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 8; k++) {
+        _mm_store_si128((__m128i*)(a2 + 8 * k), nnue_leaky8AVX2(sum2[k], pos2, neg2));
+    }
+    
+    // Layer 3
+    __m256i sum3[NNUE_HIDDEN3_SIZE / 8];
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 8; k++) {
+        sum3[k] = _mm256_load_si256((const __m256i*)(nnue_b3Aligned + 8 * k));
+    }
+    for (int j = 0; j < NNUE_HIDDEN2_SIZE / 2; j++) {
+        int32_t pair;
+        memcpy(&pair, a2 + 2 * j, sizeof(pair));
+        __m256i in = _mm256_set1_epi32(pair);
+        for (int k = 0; k < NNUE_HIDDEN3_SIZE / 8; k++) {
+            __m256i w = _mm256_load_si256((const __m256i*)nnue_w3Pairs[j][8 * k]);
+            sum3[k] = _mm256_add_epi32(sum3[k], _mm256_madd_epi16(w, in));
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 8; k++) {
+        _mm_store_si128((__m128i*)(a3 + 8 * k), nnue_leaky8AVX2(sum3[k], pos3, neg3));
+    }
+    
+    return nnue_outputLayer(a3);
+}
+#endif
+
+#ifdef NNUE_NEON_KERNEL
+// ----- NEON kernel (Raspberry Pi) -----
+static int nnue_supportsNEON(void) {
+    return 1;  // compiled in only when the target has NEON
+}
+
+static void nnue_accAddNEON(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 8) {
+        int16x8_t w = vmovl_s8(vld1_s8(row + i));
+        vst1q_s32(acc + i, vaddw_s16(vld1q_s32(acc + i), vget_low_s16(w)));
+        vst1q_s32(acc + i + 4, vaddw_s16(vld1q_s32(acc + i + 4), vget_high_s16(w)));
+    }
+}
+
+static void nnue_accSubNEON(int32_t* acc, const int8_t* row) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i += 8) {
+        int16x8_t w = vmovl_s8(vld1_s8(row + i));
+        vst1q_s32(acc + i, vsubw_s16(vld1q_s32(acc + i), vget_low_s16(w)));
+        vst1q_s32(acc + i + 4, vsubw_s16(vld1q_s32(acc + i + 4), vget_high_s16(w)));
+    }
+}
+
+static int32_t nnue_forwardNEON(const int32_t* acc) {
+    int16_t a1[NNUE_HIDDEN1_SIZE];
+    int16_t a2[NNUE_HIDDEN2_SIZE];
+    int16_t a3[NNUE_HIDDEN3_SIZE];
+    int32_t sum[NNUE_HIDDEN2_SIZE];
+    
+    // Layer 1 activation
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+        a1[i] = nnue_leakyClamp(acc[i], nnueNet.actDiv[0]);
+    }
     
-    // Encode board
+    // Layer 2 (vld2 splits each interleaved pair back into the two input rows)
+    int32x4_t sum2[NNUE_HIDDEN2_SIZE / 4];
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k++) {
+        sum2[k] = vld1q_s32(nnue_b2Aligned + 4 * k);
+    }
+    for (int j = 0; j < NNUE_HIDDEN1_SIZE / 2; j++) {
+        for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k++) {
+            int16x4x2_t w = vld2_s16(nnue_w2Pairs[j][4 * k]);
+            sum2[k] = vmlal_n_s16(sum2[k], w.val[0], a1[2 * j]);
+            sum2[k] = vmlal_n_s16(sum2[k], w.val[1], a1[2 * j + 1]);
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN2_SIZE / 4; k++) {
+        vst1q_s32(sum + 4 * k, sum2[k]);
+    }
+    for (int i = 0; i < NNUE_HIDDEN2_SIZE; i++) {
+        a2[i] = nnue_leakyClamp(sum[i], nnueNet.actDiv[1]);
+    }
+    
+    // Layer 3
+    int32x4_t sum3[NNUE_HIDDEN3_SIZE / 4];
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k++) {
+        sum3[k] = vld1q_s32(nnue_b3Aligned + 4 * k);
+    }
+    for (int j = 0; j < NNUE_HIDDEN2_SIZE / 2; j++) {
+        for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k++) {
+            int16x4x2_t w = vld2_s16(nnue_w3Pairs[j][4 * k]);
+            sum3[k] = vmlal_n_s16(sum3[k], w.val[0], a2[2 * j]);
+            sum3[k] = vmlal_n_s16(sum3[k], w.val[1], a2[2 * j + 1]);
+        }
+    }
+    for (int k = 0; k < NNUE_HIDDEN3_SIZE / 4; k++) {
+        vst1q_s32(sum + 4 * k, sum3[k]);
+    }
+    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
+        a3[i] = nnue_leakyClamp(sum[i], nnueNet.actDiv[2]);
+    }
+    
+    return nnue_outputLayer(a3);
+}
+#endif
+
+// Scalar first; nnue_init keeps the last entry that is supported and verified
+static const NNUEKernel nnueKernels[] = {
+    { "scalar", nnue_supportsScalar, nnue_accAddScalar, nnue_accSubScalar, nnue_forwardScalar },
+#ifdef NNUE_X86_KERNELS
+    { "sse4.1", nnue_supportsSSE41, nnue_accAddSSE41, nnue_accSubSSE41, nnue_forwardSSE41 },
+    { "avx2", nnue_supportsAVX2, nnue_accAddAVX2, nnue_accSubAVX2, nnue_forwardAVX2 },
+#endif
+#ifdef NNUE_NEON_KERNEL
+    { "neon", nnue_supportsNEON, nnue_accAddNEON, nnue_accSubNEON, nnue_forwardNEON },
+#endif
+};
+
+static const NNUEKernel* nnueKernel = &nnueKernels[0];
+
+static inline void nnue_addFeature(NNUEAccumulator* acc, int feature) {
+    if (feature < 0) return;
+    nnueKernel->accAdd(acc->v, nnue_w1Rows[feature]);
+}
+
+static inline void nnue_subFeature(NNUEAccumulator* acc, int feature) {
+    if (feature < 0) return;
+    nnueKernel->accSub(acc->v, nnue_w1Rows[feature]);
+}
+
+static void nnue_refreshWith(const NNUEKernel* kernel, NNUEAccumulator* acc,
+                             char board[BOARD_SIZE][BOARD_SIZE]) {
+    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+        acc->v[i] = nnueNet.b1[i];
+    }
+    
+    // Gather-sum of the active rows (one per non-blocked square)
     for (int i = 0; i < BOARD_SIZE; i++) {
         for (int j = 0; j < BOARD_SIZE; j++) {
-            int idx = i * 8 + j;
-            if (board[i][j] == RED) {
-                input[idx] = NNUE_SCALE;
-            } else if (board[i][j] == BLUE) {
-                input[idx + 64] = NNUE_SCALE;
-            } else if (board[i][j] == EMPTY) {
-                input[idx + 128] = NNUE_SCALE;
+            int feature = nnue_feature(board[i][j], i * 8 + j);
+            if (feature >= 0) kernel->accAdd(acc->v, nnue_w1Rows[feature]);
+        }
+    }
+}
+
+// Compare a kernel with the scalar reference over a few random games; a
+// kernel that disagrees on any position is not used
+static int nnue_verifyKernel(const NNUEKernel* kernel) {
+    unsigned int seed = 12345;
+    
+    for (int game = 0; game < 8; game++) {
+        char board[BOARD_SIZE][BOARD_SIZE];
+        memset(board, EMPTY, sizeof(board));
+        board[0][0] = RED;
+        board[7][7] = RED;
+        board[0][7] = BLUE;
+        board[7][0] = BLUE;
+        if (game & 1) {
+            board[3][3] = BLOCKED;
+            board[4][4] = BLOCKED;
+        }
+        
+        int player = RED_TURN;
+        for (int ply = 0; ply < 80; ply++) {
+            NNUEAccumulator ref, test;
+            nnue_refreshWith(&nnueKernels[0], &ref, board);
+            nnue_refreshWith(kernel, &test, board);
+            
+            if (memcmp(ref.v, test.v, sizeof(ref.v)) != 0 ||
+                nnue_forwardScalar(ref.v) != kernel->forward(test.v)) {
+                return 0;
+            }
+            
+            Move moves[MAX_MOVES];
+            int moveCount;
+            getAllValidMoves(board, player, moves, &moveCount);
+            if (moveCount == 0) {
+                player = 1 - player;
+                getAllValidMoves(board, player, moves, &moveCount);
+                if (moveCount == 0) break;
             }
+            makeMove(board, moves[rand_r(&seed) % moveCount]);
+            player = 1 - player;
+        }
+    }
+    
+    return 1;
+}
+
+// Pack the weight tables of the loaded network and pick the evaluation
+// kernel. -nnue-kernel <name> restricts the choice to one kernel.
+static void nnue_prepare() {
+    for (int j = 0; j < NNUE_INPUT_SIZE; j++) {
+        for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+            nnue_w1Rows[j][i] = nnueNet.w1[j * NNUE_HIDDEN1_SIZE + i];
+        }
+    }
+    
+    for (int j = 0; j < NNUE_HIDDEN1_SIZE; j++) {
+        for (int i = 0; i < NNUE_HIDDEN2_SIZE; i++) {
+            nnue_w2Pairs[j / 2][i][j % 2] = nnueNet.w2[j * NNUE_HIDDEN2_SIZE + i];
+        }
+    }
+    for (int j = 0; j < NNUE_HIDDEN2_SIZE; j++) {
+        for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
+            nnue_w3Pairs[j / 2][i][j % 2] = nnueNet.w3[j * NNUE_HIDDEN3_SIZE + i];
+        }
+    }
+    memcpy(nnue_b2Aligned, nnueNet.b2, sizeof(nnue_b2Aligned));
+    memcpy(nnue_b3Aligned, nnueNet.b3, sizeof(nnue_b3Aligned));
+    
+    bool autoSelect = strcmp(nnueKernelRequest, "auto") == 0;
+    bool found = autoSelect || strcmp(nnueKernelRequest, "scalar") == 0;
+    
+    nnueKernel = &nnueKernels[0];
+    for (size_t k = 1; k < sizeof(nnueKernels) / sizeof(nnueKernels[0]); k++) {
+        const NNUEKernel* kernel = &nnueKernels[k];
+        if (!autoSelect && strcmp(nnueKernelRequest, kernel->name) != 0) continue;
+        found = true;
+        
+        if (!kernel->supported()) {
+            if (!autoSelect) safePrint("NNUE kernel %s not supported by this CPU\n", kernel->name);
+            continue;
+        }
+        if (!nnue_verifyKernel(kernel)) {
+            safePrint("NNUE kernel %s disagrees with the scalar reference, not used\n", kernel->name);
+            continue;
         }
+        nnueKernel = kernel;
+    }
+    
+    if (!found) {
+        safePrint("Unknown NNUE kernel '%s'\n", nnueKernelRequest);
+    }
+    safePrint("NNUE kernel: %s\n", nnueKernel->name);
+}
+
+static uint32_t nnue_checksum(const unsigned char* data, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Run the exporter's reference positions through the plain reference path
+static int nnue_checkTestVectors(const NNUENetwork* net, const NNUETestVector* tests, uint32_t count) {
+    for (uint32_t t = 0; t < count; t++) {
+        int32_t acc[NNUE_HIDDEN1_SIZE];
+        for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+            acc[i] = net->b1[i];
+        }
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+            int feature = nnue_feature(tests[t].board[sq], sq);
+            if (feature < 0) continue;
+            for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
+                acc[i] += net->w1[feature * NNUE_HIDDEN1_SIZE + i];
+            }
+        }
+        
+        if (nnue_forwardNet(net, acc) != tests[t].expected) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Map and validate a network file. On any error the current network (if
+// any) stays in place.
+int nnue_loadNetwork(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        safePrint("NNUE: cannot open %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+    
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(NNUEFileHeader)) {
+        safePrint("NNUE: %s is not a network file\n", path);
+        close(fd);
+        return 0;
+    }
+    
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        safePrint("NNUE: cannot map %s: %s\n", path, strerror(errno));
+        return 0;
+    }
+    
+    const NNUEFileHeader* header = (const NNUEFileHeader*)map;
+    const char* error = NULL;
+    
+    if (memcmp(header->magic, NNUE_FILE_MAGIC, sizeof(header->magic)) != 0) {
+        error = "bad magic";
+    } else if (header->version != NNUE_FILE_VERSION) {
+        error = "unsupported version";
+    } else if (header->inputSize != NNUE_INPUT_SIZE || header->hidden1 != NNUE_HIDDEN1_SIZE ||
+               header->hidden2 != NNUE_HIDDEN2_SIZE || header->hidden3 != NNUE_HIDDEN3_SIZE) {
+        error = "layer sizes do not match this build";
+    } else if (header->testVectors == 0 || header->testVectors > 100000) {
+        error = "missing test vectors";
+    } else if (header->payloadBytes != NNUE_WEIGHT_BYTES + header->testVectors * sizeof(NNUETestVector) ||
+               (size_t)st.st_size != sizeof(NNUEFileHeader) + header->payloadBytes) {
+        error = "wrong file size";
+    } else if (nnue_checksum((const unsigned char*)(header + 1), header->payloadBytes) != header->checksum) {
+        error = "checksum mismatch";
+    }
+    
+    NNUENetwork net;
+    memset(&net, 0, sizeof(net));
+    
+    if (!error) {
+        for (int n = 0; n < 3; n++) {
+            if (!(header->actDiv[n][0] > 0.0) || !(header->actDiv[n][1] > 0.0)) {
+                error = "bad quantization scales";
+            }
+            net.actDiv[n][0] = header->actDiv[n][0];
+            net.actDiv[n][1] = header->actDiv[n][1];
+        }
+        if (!(header->outputDiv > 0.0) || header->outputScale <= 0) {
+            error = "bad quantization scales";
+        }
+    }
+    
+    if (!error) {
+        const unsigned char* p = (const unsigned char*)(header + 1);
+        net.w1 = (const int8_t*)p;  p += NNUE_INPUT_SIZE * NNUE_HIDDEN1_SIZE;
+        net.b1 = (const int32_t*)p; p += 4 * NNUE_HIDDEN1_SIZE;
+        net.w2 = (const int8_t*)p;  p += NNUE_HIDDEN1_SIZE * NNUE_HIDDEN2_SIZE;
+        net.b2 = (const int32_t*)p; p += 4 * NNUE_HIDDEN2_SIZE;
+        net.w3 = (const int8_t*)p;  p += NNUE_HIDDEN2_SIZE * NNUE_HIDDEN3_SIZE;
+        net.b3 = (const int32_t*)p; p += 4 * NNUE_HIDDEN3_SIZE;
+        net.w4 = (const int16_t*)p; p += 2 * NNUE_HIDDEN3_SIZE;
+        net.b4 = (const int32_t*)p; p += 4;
+        net.outputDiv = header->outputDiv;
+        net.outputScale = header->outputScale;
+        
+        if (!nnue_checkTestVectors(&net, (const NNUETestVector*)p, header->testVectors)) {
+            error = "test vectors do not match";
+        }
+    }
+    
+    if (error) {
+        safePrint("NNUE: %s: %s\n", path, error);
+        munmap(map, st.st_size);
+        return 0;
     }
     
-    // Layer 1
-    int32_t acc1[NNUE_HIDDEN1_SIZE];
-    for (int i = 0; i < NNUE_HIDDEN1_SIZE; i++) {
-        acc1[i] = nnue_b1[i] * NNUE_SCALE;
-        for (int j = 0; j < INPUT_SIZE; j++) {
-            acc1[i] += (int32_t)input[j] * nnue_w1[j][i];
-        }
-        acc1[i] = (acc1[i] > 0) ? acc1[i] : (acc1[i] / 100);  // Leaky ReLU
-        acc1[i] /= NNUE_SCALE;
+    if (nnueNet.map) {
+        munmap(nnueNet.map, nnueNet.mapSize);
     }
     
-    // Layer 2
-    int32_t acc2[NNUE_HIDDEN2_SIZE];
-    for (int i = 0; i < NNUE_HIDDEN2_SIZE; i++) {
-        acc2[i] = nnue_b2[i] * NNUE_SCALE;
-        for (int j = 0; j < NNUE_HIDDEN1_SIZE; j++) {
-            acc2[i] += acc1[j] * nnue_w2[j][i];
+    net.map = map;
+    net.mapSize = st.st_size;
+    net.st = st;
+    nnueNet = net;
+    evalCache_clear();  // Cached NNUE scores belong to the old network
+    
+    safePrint("NNUE: loaded %s (%d-%d-%d-%d int8, %u test vectors ok)\n", path, NNUE_INPUT_SIZE,
+              NNUE_HIDDEN1_SIZE, NNUE_HIDDEN2_SIZE, NNUE_HIDDEN3_SIZE, header->testVectors);
+    nnue_prepare();
+    return 1;
+}
+
+// Load the network at startup; without one the engines use the classical
+// evaluation only
+void nnue_init() {
+    if (!nnue_loadNetwork(nnueNetPath)) {
+        if (nnueNetRequired) {
+            exit(1);
         }
-        acc2[i] = (acc2[i] > 0) ? acc2[i] : (acc2[i] / 100);  // Leaky ReLU
-        acc2[i] /= NNUE_SCALE;
+        safePrint("NNUE: Disabled (classical evaluation only)\n");
+    }
+}
+
+// Called between games: pick up a network file that was replaced since it
+// was loaded (replace it with mv, not by rewriting it in place)
+void nnue_checkForUpdate() {
+    struct stat st;
+    if (stat(nnueNetPath, &st) < 0) return;
+    
+    if (nnueNet.map && st.st_ino == nnueNet.st.st_ino && st.st_size == nnueNet.st.st_size &&
+        st.st_mtime == nnueNet.st.st_mtime) {
+        return;
     }
     
-    // Layer 3
-    int32_t acc3[NNUE_HIDDEN3_SIZE];
-    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
-        acc3[i] = nnue_b3[i] * NNUE_SCALE;
-        for (int j = 0; j < NNUE_HIDDEN2_SIZE; j++) {
-            acc3[i] += acc2[j] * nnue_w3[j][i];
-        }
-        acc3[i] = (acc3[i] > 0) ? acc3[i] : (acc3[i] / 100);  // Leaky ReLU
-        acc3[i] /= NNUE_SCALE;
+    safePrint("NNUE: %s changed, reloading\n", nnueNetPath);
+    nnue_loadNetwork(nnueNetPath);
+}
+
+// Rebuild the accumulator from scratch (root of a search, start of a rollout)
+void nnue_refreshAccumulator(NNUEAccumulator* acc, char board[BOARD_SIZE][BOARD_SIZE]) {
+    if (!nnue_available()) {
+        memset(acc->v, 0, sizeof(acc->v));
+        return;
+    }
+    nnue_refreshWith(nnueKernel, acc, board);
+}
+
+// Apply the feature changes of a move already made with makeMoveWithUndo
+void nnue_applyMove(NNUEAccumulator* acc, const MoveUndo* undo) {
+    char mover = undo->mover;
+    char opponent = (mover == RED) ? BLUE : RED;
+    int to = undo->move.r2 * BOARD_SIZE + undo->move.c2;
+    
+    nnue_subFeature(acc, nnue_feature(EMPTY, to));
+    nnue_addFeature(acc, nnue_feature(mover, to));
+    
+    if (undo->move.moveType == JUMP) {
+        int from = undo->move.r1 * BOARD_SIZE + undo->move.c1;
+        nnue_subFeature(acc, nnue_feature(mover, from));
+        nnue_addFeature(acc, nnue_feature(EMPTY, from));
     }
     
-    // Output layer
-    int32_t output = nnue_b4[0] * NNUE_SCALE;
-    for (int i = 0; i < NNUE_HIDDEN3_SIZE; i++) {
-        output += acc3[i] * nnue_w4[i];
+    for (int i = 0; i < undo->flipCount; i++) {
+        nnue_subFeature(acc, nnue_feature(opponent, undo->flipped[i]));
+        nnue_addFeature(acc, nnue_feature(mover, undo->flipped[i]));
+    }
+}
+
+// Exact inverse of nnue_applyMove
+void nnue_undoMove(NNUEAccumulator* acc, const MoveUndo* undo) {
+    char mover = undo->mover;
+    char opponent = (mover == RED) ? BLUE : RED;
+    int to = undo->move.r2 * BOARD_SIZE + undo->move.c2;
+    
+    nnue_subFeature(acc, nnue_feature(mover, to));
+    nnue_addFeature(acc, nnue_feature(EMPTY, to));
+    
+    if (undo->move.moveType == JUMP) {
+        int from = undo->move.r1 * BOARD_SIZE + undo->move.c1;
+        nnue_subFeature(acc, nnue_feature(EMPTY, from));
+        nnue_addFeature(acc, nnue_feature(mover, from));
     }
     
-    output /= NNUE_SCALE;
+    for (int i = 0; i < undo->flipCount; i++) {
+        nnue_subFeature(acc, nnue_feature(mover, undo->flipped[i]));
+        nnue_addFeature(acc, nnue_feature(opponent, undo->flipped[i]));
+    }
+}
+
+// Upper layers only; the first layer comes from the accumulator
+static int nnue_evaluateAccumulator(const NNUEAccumulator* acc, int forPlayer) {
+    double z = nnueKernel->forward(acc->v) / nnueNet.outputDiv;
     
-    // Apply tanh-like bounding
-    if (output > NNUE_OUTPUT_SCALE) output = NNUE_OUTPUT_SCALE;
-    if (output < -NNUE_OUTPUT_SCALE) output = -NNUE_OUTPUT_SCALE;
+    // Bounded output, as in training: tanh(z / 2) * 2 * OUTPUT_SCALE
+    int output = (int)(tanh(z / 2.0) * 2.0 * nnueNet.outputScale);
     
     return (forPlayer == RED_TURN) ? output : -output;
 }
-#endif
+
+static int nnue_evaluate(char board[BOARD_SIZE][BOARD_SIZE], int forPlayer) {
+    NNUEAccumulator acc;
+    nnue_refreshAccumulator(&acc, board);
+    return nnue_evaluateAccumulator(&acc, forPlayer);
+}
 
 // ===== MCTS IMPLEMENTATION (Simplified and Optimized) =====
 
@@ -1012,6 +2458,7 @@ MCTSNode* mcts_createNode(Move move, int player, MCTSNode* parent) {
     node->childCount = 0;
     node->childCapacity = 0;
     node->fullyExpanded = 0;
+    node->amaf = NULL;
     
     return node;
 }
@@ -1024,6 +2471,7 @@ void mcts_freeTree(MCTSNode* root) {
     }
     
     if (root->children) free(root->children);
+    if (root->amaf) free(root->amaf);
     free(root);
 }
 
@@ -1040,13 +2488,33 @@ MCTSNode* mcts_selectChild(MCTSNode* node) {
         MCTSNode* child = node->children[i];
         if (!child) continue;
         
+        // AMAF estimate for this child's (target square, move type)
+        int amafVisits = 0;
+        double amafValue = 0.0;
+        if (node->amaf) {
+            int sq = child->move.r2 * BOARD_SIZE + child->move.c2;
+            int t = child->move.moveType - 1;
+            amafVisits = node->amaf->visits[sq][t];
+            if (amafVisits > 0) {
+                amafValue = node->amaf->totalScore[sq][t] / amafVisits;
+            }
+        }
+        
         double value;
         if (child->visits == 0) {
-            // Unvisited nodes get priority
-            value = 1e6 + (rand() % 1000);
+            // Unvisited nodes get priority (ordered by AMAF value when available)
+            if (amafVisits > 0) {
+                value = 1e6 + amafValue * 1000 + (rand() % 100);
+            } else {
+                value = 1e6 + (rand() % 1000);
+            }
         } else {
-            // UCB1 formula
+            // UCB1 formula, blended with AMAF using a decaying beta
             double exploitation = child->winRate;
+            if (amafVisits > 0) {
+                double beta = sqrt(MCTS_RAVE_EQUIV / (3.0 * child->visits + MCTS_RAVE_EQUIV));
+                exploitation = (1.0 - beta) * child->winRate + beta * amafValue;
+            }
             double exploration = MCTS_C * sqrt(logParent / child->visits);
             value = exploitation + exploration;
         }
@@ -1111,6 +2579,10 @@ void mcts_expand(MCTSNode* node, char board[BOARD_SIZE][BOARD_SIZE]) {
     
     node->childCapacity = maxChildren;
     
+    if (mctsRaveEnabled && !node->amaf) {
+        node->amaf = (MCTSAmafTable*)calloc(1, sizeof(MCTSAmafTable));
+    }
+    
     // Create child nodes for top moves
     for (int i = 0; i < maxChildren; i++) {
         node->children[i] = mcts_createNode(moves[i], nextPlayer, node);
@@ -1122,13 +2594,24 @@ void mcts_expand(MCTSNode* node, char board[BOARD_SIZE][BOARD_SIZE]) {
     node->fullyExpanded = (node->childCount == moveCount);
 }
 
-double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int startingPlayer, bool useNN) {
+double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int startingPlayer, bool useNN, MCTSTrace* trace) {
     char simBoard[BOARD_SIZE][BOARD_SIZE];
     copyBoard(simBoard, board);
     
     int currentPlayer = startingPlayer;
     int moveCount = 0;
     
+    if (trace) trace->length = 0;
+    
+    // Without a network the rollout is purely heuristic
+    useNN = useNN && nnue_available();
+    
+    // Accumulator for the NN-guided part of the rollout
+    NNUEAccumulator simAcc;
+    if (useNN) {
+        nnue_refreshAccumulator(&simAcc, simBoard);
+    }
+    
     // Run simulation
     while (moveCount < MCTS_SIMULATION_DEPTH) {
         Move moves[MAX_MOVES];
@@ -1141,27 +2624,27 @@ double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int startingPlayer, boo
         
         if (useNN && moveCount < 5) {
             // Use NNUE for first few moves
-            #ifdef HAS_NNUE_WEIGHTS
             Move bestMove = moves[0];
             int bestScore = NEG_INF_SCORE;
             
             // Evaluate top moves
             int evalCount = (numMoves < 10) ? numMoves : 10;
             for (int i = 0; i < evalCount; i++) {
-                char tempBoard[BOARD_SIZE][BOARD_SIZE];
-                copyBoard(tempBoard, simBoard);
-                makeMove(tempBoard, moves[i]);
+                MoveUndo undo;
+                makeMoveWithUndo(simBoard, moves[i], &undo);
+                nnue_applyMove(&simAcc, &undo);
+                
+                int score = nnue_evaluateAccumulator(&simAcc, currentPlayer);
+                
+                nnue_undoMove(&simAcc, &undo);
+                undoMove(simBoard, &undo);
                 
-                int score = nnue_evaluate(tempBoard, currentPlayer);
                 if (score > bestScore) {
                     bestScore = score;
                     bestMove = moves[i];
                 }
             }
             selectedMove = bestMove;
-            #else
-            selectedMove = moves[rand() % numMoves];
-            #endif
         } else {
             // Use heuristics for rest of simulation
             Move bestMove = moves[0];
@@ -1185,7 +2668,22 @@ double mcts_simulate(char board[BOARD_SIZE][BOARD_SIZE], int startingPlayer, boo
             }
         }
         
-        makeMove(simBoard, selectedMove);
+        if (useNN && moveCount < 4) {
+            // Keep the accumulator in sync while it is still needed
+            MoveUndo undo;
+            makeMoveWithUndo(simBoard, selectedMove, &undo);
+            nnue_applyMove(&simAcc, &undo);
+        } else {
+            makeMove(simBoard, selectedMove);
+        }
+        
+        if (trace && trace->length < MCTS_MAX_TRACE) {
+            trace->square[trace->length] = selectedMove.r2 * BOARD_SIZE + selectedMove.c2;
+            trace->type[trace->length] = selectedMove.moveType;
+            trace->player[trace->length] = currentPlayer;
+            trace->length++;
+        }
+        
         currentPlayer = 1 - currentPlayer;
         moveCount++;
     }
@@ -1217,6 +2715,54 @@ void mcts_backpropagate(MCTSNode* node, double score) {
     }
 }
 
+// RAVE: credit every move played below a node (tree path + playout) to that
+// node's AMAF table, as if it had been played first. Only the first occurrence
+// of each target square by the node's mover counts.
+void mcts_updateAmaf(MCTSNode* leaf, double score, const MCTSTrace* playout) {
+    MCTSNode* path[MCTS_MAX_TRACE];
+    int depth = 0;
+    for (MCTSNode* n = leaf; n != NULL && depth < MCTS_MAX_TRACE; n = n->parent) {
+        path[depth++] = n;
+    }
+    
+    // path[0] is the leaf; the score seen by the leaf's children is inverted
+    double childScore = 1.0 - score;
+    
+    for (int d = 0; d < depth; d++) {
+        MCTSNode* node = path[d];
+        
+        if (node->amaf) {
+            int mover = 1 - node->player;
+            unsigned long long seen = 0;
+            
+            // Tree moves below this node (its child on the path first)
+            for (int k = d - 1; k >= 0; k--) {
+                Move m = path[k]->move;
+                if (path[k]->player != mover || m.moveType < CLONE) continue;
+                int sq = m.r2 * BOARD_SIZE + m.c2;
+                if (seen & (1ULL << sq)) continue;
+                seen |= 1ULL << sq;
+                node->amaf->visits[sq][m.moveType - 1]++;
+                node->amaf->totalScore[sq][m.moveType - 1] += childScore;
+            }
+            
+            // Playout moves
+            if (playout) {
+                for (int k = 0; k < playout->length; k++) {
+                    if (playout->player[k] != mover) continue;
+                    int sq = playout->square[k];
+                    if (seen & (1ULL << sq)) continue;
+                    seen |= 1ULL << sq;
+                    node->amaf->visits[sq][playout->type[k] - 1]++;
+                    node->amaf->totalScore[sq][playout->type[k] - 1] += childScore;
+                }
+            }
+        }
+        
+        childScore = 1.0 - childScore;
+    }
+}
+
 Move mcts_getBestMove(MCTSNode* root) {
     if (!root || root->childCount == 0) {
         return (Move){0, 0, 0, 0, 0, 0};
@@ -1257,6 +2803,9 @@ typedef struct {
     bool useNN;
     int simulations;
     double totalScore;
+    bool recordTraces;
+    double scores[MCTS_SIMS_PER_THREAD];
+    MCTSTrace traces[MCTS_SIMS_PER_THREAD];
 } MCTSWorkerData;
 
 void* mcts_simulationWorker(void* arg) {
@@ -1264,7 +2813,10 @@ void* mcts_simulationWorker(void* arg) {
     
     data->totalScore = 0.0;
     for (int i = 0; i < data->simulations; i++) {
-        data->totalScore += mcts_simulate(data->board, data->player, data->useNN);
+        MCTSTrace* trace = (data->recordTraces && i < MCTS_SIMS_PER_THREAD) ? &data->traces[i] : NULL;
+        double score = mcts_simulate(data->board, data->player, data->useNN, trace);
+        if (i < MCTS_SIMS_PER_THREAD) data->scores[i] = score;
+        data->totalScore += score;
     }
     
     return NULL;
@@ -1344,13 +2896,14 @@ Move mcts_search(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, bool use
             pthread_t threads[MCTS_THREADS];
             MCTSWorkerData workerData[MCTS_THREADS];
             
-            int simsPerThread = 4;
+            int simsPerThread = MCTS_SIMS_PER_THREAD;
             
             for (int i = 0; i < MCTS_THREADS; i++) {
                 copyBoard(workerData[i].board, simBoard);
                 workerData[i].player = currentPlayer;
                 workerData[i].useNN = useNN;
                 workerData[i].simulations = simsPerThread;
+                workerData[i].recordTraces = mctsRaveEnabled;
                 pthread_create(&threads[i], NULL, mcts_simulationWorker, &workerData[i]);
             }
             
@@ -1361,9 +2914,23 @@ Move mcts_search(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, bool use
             }
             
             result = totalResult / (MCTS_THREADS * simsPerThread);
+            
+            // Every playout contributes its own AMAF sample
+            if (mctsRaveEnabled) {
+                for (int i = 0; i < MCTS_THREADS; i++) {
+                    for (int j = 0; j < simsPerThread; j++) {
+                        mcts_updateAmaf(current, workerData[i].scores[j], &workerData[i].traces[j]);
+                    }
+                }
+            }
         } else {
             // Single simulation for well-visited nodes
-            result = mcts_simulate(simBoard, currentPlayer, useNN);
+            MCTSTrace trace;
+            result = mcts_simulate(simBoard, currentPlayer, useNN, mctsRaveEnabled ? &trace : NULL);
+            
+            if (mctsRaveEnabled) {
+                mcts_updateAmaf(current, result, &trace);
+            }
         }
         
         // 4. Backpropagation - update all nodes in path
@@ -1380,7 +2947,8 @@ Move mcts_search(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer, bool use
     }
     
     const char* engineType = useNN ? "MCTS-NN" : "MCTS-Classic";
-    safePrint("%s: %d iterations in %.2fs\n", engineType, iterations, elapsedSeconds());
+    safePrint("%s%s: %d iterations in %.2fs\n", engineType, mctsRaveEnabled ? " (RAVE)" : "",
+              iterations, elapsedSeconds());
     
     // Get best move
     Move bestMove = mcts_getBestMove(root);
@@ -1529,6 +3097,7 @@ int eunsongNegamax(char board[BOARD_SIZE][BOARD_SIZE], char player, int depth, i
     if (n == 0) return eunsongEvaluate(board, player);
     
     // Move ordering
+    int (*history)[BOARD_SIZE * BOARD_SIZE] = ordering->history[player == 'R' ? RED_TURN : BLUE_TURN];
     for (int i = 0; i < n; i++) {
         char opp = (player == 'R') ? 'B' : 'R';
         int captures = 0;
@@ -1555,7 +3124,7 @@ int eunsongNegamax(char board[BOARD_SIZE][BOARD_SIZE], char player, int depth, i
         }
         
         moves[i].score = captures * 100 + posWeights[moves[i].r2][moves[i].c2] * 10;
-        moves[i].score += historyTable[moves[i].r1][moves[i].c1][moves[i].r2][moves[i].c2];
+        moves[i].score += history[moves[i].r1 * BOARD_SIZE + moves[i].c1][moves[i].r2 * BOARD_SIZE + moves[i].c2];
     }
     
     // Sort moves
@@ -1581,11 +3150,7 @@ int eunsongNegamax(char board[BOARD_SIZE][BOARD_SIZE], char player, int depth, i
             best = score;
             
             if (best >= beta) {
-                historyTable[moves[i].r1][moves[i].c1][moves[i].r2][moves[i].c2] += depth * depth;
-                if (depth < MAX_DEPTH) {
-                    killerMoves[depth][1] = killerMoves[depth][0];
-                    killerMoves[depth][0] = moves[i];
-                }
+                history[moves[i].r1 * BOARD_SIZE + moves[i].c1][moves[i].r2 * BOARD_SIZE + moves[i].c2] += depth * depth;
             }
         }
         
@@ -1598,6 +3163,7 @@ int eunsongNegamax(char board[BOARD_SIZE][BOARD_SIZE], char player, int depth, i
 
 void* eunsongThreadFunc(void* arg) {
     ThreadData* data = (ThreadData*)arg;
+    ordering = &orderingTables[data->threadId];
     char sim[8][8];
     copyBoard(sim, data->board);
     eunsongApplyMove(sim, data->move.r1, data->move.c1, data->move.r2, data->move.c2, data->player);
@@ -1615,6 +3181,7 @@ Move getEunsongMove(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
     }
     
     eunsongStartTime = time(NULL);
+    ordering_age();
     atomic_store(&nodeCount, 0);
     
     int maxDepth = 4;
@@ -1624,11 +3191,11 @@ Move getEunsongMove(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
     int bestScore = NEG_INF_SCORE;
     
     for (int depth = 1; depth <= maxDepth && time(NULL) - eunsongStartTime < (int)(TIME_LIMIT * 0.9); depth++) {
-        pthread_t threads[4];
-        ThreadData data[4];
+        pthread_t threads[MINIMAX_THREADS];  // threadId picks an ordering slot
+        ThreadData data[MINIMAX_THREADS];
         
-        for (int i = 0; i < n; i += 4) {
-            int batch = (i + 4 > n) ? (n - i) : 4;
+        for (int i = 0; i < n; i += MINIMAX_THREADS) {
+            int batch = (i + MINIMAX_THREADS > n) ? (n - i) : MINIMAX_THREADS;
             
             for (int j = 0; j < batch; j++) {
                 copyBoard(data[j].board, board);
@@ -1636,6 +3203,7 @@ Move getEunsongMove(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
                 data[j].player = player;
                 data[j].score = NEG_INF_SCORE;
                 data[j].depth = depth;
+                data[j].threadId = j;
                 pthread_create(&threads[j], NULL, eunsongThreadFunc, &data[j]);
             }
             
@@ -1661,40 +3229,182 @@ Move getEunsongMove(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
     return bestMove;
 }
 
+// ===== MOVE ORDERING TABLES =====
+
+// Called before each search: history is halved so that it follows the game,
+// and killers (relative to the old root) are cleared. Counter-moves stay.
+void ordering_age() {
+    for (int slot = 0; slot < ORDERING_SLOTS; slot++) {
+        OrderingTables* tables = &orderingTables[slot];
+        memset(tables->killers, 0, sizeof(tables->killers));
+        int* history = &tables->history[0][0][0];
+        for (size_t i = 0; i < sizeof(tables->history) / sizeof(int); i++) {
+            history[i] >>= 1;
+        }
+    }
+}
+
+// ===== STAGED MOVE ORDERING =====
+// negamaxPhased takes its moves in stages: the TT move, then captures (most
+// opponent pieces taken first), then the killers and the counter-move, then
+// the rest by history (from the thread's OrderingTables).
+// A stage is scored only when it is reached and its moves are picked by
+// selection, so a cutoff on an early move leaves the rest unscored.
+
+enum { PICK_TT, PICK_CAPTURES, PICK_KILLERS, PICK_QUIET, PICK_DONE };
+
+typedef struct {
+    Move* moves;
+    int count;
+    int next;       // moves[0 .. next) have been handed out
+    int stageEnd;   // moves[next .. stageEnd) belong to the current stage
+    int stage;      // next stage to fill
+    const Move* ttMove;
+    const Move* killers;     // Killer pair of this ply, or NULL
+    int counterMove;         // from << 6 | to, 0 = none
+    const int (*history)[BOARD_SIZE * BOARD_SIZE];
+    Bitboard opponent;
+} MovePicker;
+
+static inline bool sameSquares(const Move* a, const Move* b) {
+    return a->r1 == b->r1 && a->c1 == b->c1 && a->r2 == b->r2 && a->c2 == b->c2;
+}
+
+// Opponent pieces next to sq: the ones a move to sq flips
+static inline int captureCount(Bitboard opponent, int sq) {
+    Bitboard bit = 1ULL << sq;
+    Bitboard row = bit | bb_shift(bit, 0, -1) | bb_shift(bit, 0, 1);
+    return __builtin_popcountll((row | row << 8 | row >> 8) & opponent);
+}
+
+static inline int squarePair(const Move* m) {
+    return (m->r1 * BOARD_SIZE + m->c1) << 6 | (m->r2 * BOARD_SIZE + m->c2);
+}
+
+static void picker_init(MovePicker* mp, Move* moves, int count, const Move* ttMove, int ply,
+                        const Move* lastMove, int side, Bitboard opponent) {
+    mp->moves = moves;
+    mp->count = count;
+    mp->next = 0;
+    mp->stageEnd = 0;
+    mp->stage = PICK_TT;
+    mp->ttMove = ttMove;
+    mp->killers = ply < MAX_DEPTH ? ordering->killers[ply] : NULL;
+    mp->counterMove = 0;
+    if (lastMove) {
+        int prev = squarePair(lastMove);
+        mp->counterMove = ordering->counterMoves[prev >> 6][prev & 63];
+    }
+    mp->history = ordering->history[side];
+    mp->opponent = opponent;
+}
+
+// Move the remaining moves of stage to moves[next ..] and score them
+static void picker_fillStage(MovePicker* mp, int stage) {
+    int end = mp->next;
+    for (int i = mp->next; i < mp->count; i++) {
+        Move* m = &mp->moves[i];
+        bool take = false;
+        
+        switch (stage) {
+            case PICK_TT:
+                take = mp->ttMove && sameSquares(m, mp->ttMove);
+                break;
+            case PICK_CAPTURES: {
+                int captures = captureCount(mp->opponent, m->r2 * BOARD_SIZE + m->c2);
+                take = captures > 0;
+                m->score = 2 * captures + (m->moveType == CLONE);  // Disc difference gained
+                break;
+            }
+            case PICK_KILLERS:
+                if (mp->killers && sameSquares(m, &mp->killers[0])) {
+                    take = true;
+                    m->score = 2;
+                } else if (mp->killers && sameSquares(m, &mp->killers[1])) {
+                    take = true;
+                    m->score = 1;
+                } else if (mp->counterMove && squarePair(m) == mp->counterMove) {
+                    take = true;
+                    m->score = 0;
+                }
+                break;
+            default:
+                take = true;
+                m->score = 2 * mp->history[m->r1 * BOARD_SIZE + m->c1][m->r2 * BOARD_SIZE + m->c2] +
+                           (m->moveType == CLONE);
+                break;
+        }
+        
+        if (take) {
+            Move tmp = mp->moves[end];
+            mp->moves[end++] = *m;
+            *m = tmp;
+        }
+    }
+    mp->stageEnd = end;
+}
+
+static bool picker_next(MovePicker* mp, Move* move) {
+    while (mp->next >= mp->stageEnd) {
+        if (mp->stage == PICK_DONE) return false;
+        picker_fillStage(mp, mp->stage++);
+    }
+    
+    int best = mp->next;
+    for (int i = mp->next + 1; i < mp->stageEnd; i++) {
+        if (mp->moves[i].score > mp->moves[best].score) best = i;
+    }
+    Move tmp = mp->moves[mp->next];
+    mp->moves[mp->next] = mp->moves[best];
+    mp->moves[best] = tmp;
+    
+    *move = mp->moves[mp->next++];
+    return true;
+}
+
 // ===== MODIFIED NEGAMAX FOR HYBRID EVALUATION =====
 
-int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int beta, 
-                  int currentPlayer, Move* bestMove, GamePhase phase, bool useHybrid) {
+// The board (and accumulator, if given) are updated in place with
+// make/undo and are back in their original state on return. ply counts from
+// the search root and lastMove is the opponent's move into this position
+// (NULL after a pass).
+int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int ply, int alpha, int beta, 
+                  int currentPlayer, const Move* lastMove, Move* bestMove, GamePhase phase, bool useHybrid,
+                  NNUEAccumulator* acc, EvalState* es) {
     atomic_fetch_add(&nodeCount, 1);
     
     // Time check
     if ((atomic_load(&nodeCount) & 127) == 0) {
         if (elapsedSeconds() > timeAllocated * 0.85) {
             atomic_store(&timeUp, 1);
-            return useHybrid ? evaluateHybrid(board, currentPlayer, phase) : 
-                              evaluateBoardPhased(board, currentPlayer, phase);
+            return evaluateLeaf(board, currentPlayer, phase, useHybrid, acc, es);
         }
     }
     
     if (atomic_load(&timeUp)) {
-        return useHybrid ? evaluateHybrid(board, currentPlayer, phase) : 
-                          evaluateBoardPhased(board, currentPlayer, phase);
+        return evaluateLeaf(board, currentPlayer, phase, useHybrid, acc, es);
     }
     
     // Terminal node or depth limit
     if (depth == 0) {
-        return useHybrid ? evaluateHybrid(board, currentPlayer, phase) : 
-                          evaluateBoardPhased(board, currentPlayer, phase);
+        return evaluateLeaf(board, currentPlayer, phase, useHybrid, acc, es);
     }
     
-    // Transposition table lookup
-    unsigned long long hash = computeHash(board);
+    // Transposition table lookup (moves are stored in the key's frame)
+    int symmetry;
+    unsigned long long hash = searchKey(board, es, &symmetry);
     int ttIndex = (hash & HASH_MASK);
     TTEntry* ttEntry = &transpositionTable[ttIndex];
     
-    if (ttEntry->hash == hash && ttEntry->depth >= depth) {
+    Move ttMove;
+    bool hasTTMove = ttEntry->hash == hash;
+    if (hasTTMove) {
+        ttMove = symmetricMove(ttEntry->bestMove, sym_inverse(symmetry));
+    }
+    
+    if (hasTTMove && ttEntry->depth >= depth) {
         if (ttEntry->flag == 0) {  // Exact
-            if (bestMove) *bestMove = ttEntry->bestMove;
+            if (bestMove) *bestMove = ttMove;
             return ttEntry->score;
         } else if (ttEntry->flag == 1) {  // Lower bound
             alpha = (alpha > ttEntry->score) ? alpha : ttEntry->score;
@@ -1703,7 +3413,7 @@ int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int
         }
         
         if (alpha >= beta) {
-            if (bestMove) *bestMove = ttEntry->bestMove;
+            if (bestMove) *bestMove = ttMove;
             return ttEntry->score;
         }
     }
@@ -1715,11 +3425,21 @@ int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int
     
     // No moves - pass turn
     if (moveCount == 0) {
-        return -negamaxPhased(board, depth - 1, -beta, -alpha, 1 - currentPlayer, NULL, phase, useHybrid);
+        return -negamaxPhased(board, depth - 1, ply + 1, -beta, -alpha, 1 - currentPlayer, NULL, NULL, phase, useHybrid,
+                              acc, es);
     }
     
     // Move ordering
-    orderMovesPhased(moves, moveCount, board, currentPlayer, depth, phase);
+    Bitboard opponent;
+    if (evalStateEnabled) {
+        opponent = (currentPlayer == RED_TURN) ? es->blue : es->red;
+    } else {
+        Bitboard red, blue, blocked;
+        boardBitboards(board, &red, &blue, &blocked);
+        opponent = (currentPlayer == RED_TURN) ? blue : red;
+    }
+    MovePicker picker;
+    picker_init(&picker, moves, moveCount, hasTTMove ? &ttMove : NULL, ply, lastMove, currentPlayer, opponent);
     
     Move localBestMove = moves[0];
     int bestScore = NEG_INF_SCORE;
@@ -1731,30 +3451,43 @@ int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int
         maxMovesToEval = 10;
     }
     
-    for (int i = 0; i < maxMovesToEval && !atomic_load(&timeUp); i++) {
-        char newBoard[BOARD_SIZE][BOARD_SIZE];
-        copyBoard(newBoard, board);
-        makeMove(newBoard, moves[i]);
+    Move move;
+    for (int i = 0; i < maxMovesToEval && !atomic_load(&timeUp) && picker_next(&picker, &move); i++) {
+        MoveUndo undo;
+        makeMoveWithUndo(board, move, &undo);
+        if (acc) nnue_applyMove(acc, &undo);
+        eval_applyMove(es, &undo);
         
         // Negamax recursion
-        int score = -negamaxPhased(newBoard, depth - 1, -beta, -alpha, 
-                                  1 - currentPlayer, NULL, phase, useHybrid);
+        int score = -negamaxPhased(board, depth - 1, ply + 1, -beta, -alpha, 
+                                  1 - currentPlayer, &move, NULL, phase, useHybrid, acc, es);
+        
+        eval_undoMove(es, &undo);
+        if (acc) nnue_undoMove(acc, &undo);
+        undoMove(board, &undo);
         
         if (score > bestScore) {
             bestScore = score;
-            localBestMove = moves[i];
+            localBestMove = move;
             
             if (score > alpha) {
                 alpha = score;
                 flag = 0;  // Exact
                 
                 if (alpha >= beta) {
-                    // Update history and killer moves
-                    if (depth < MAX_DEPTH) {
-                        killerMoves[depth][1] = killerMoves[depth][0];
-                        killerMoves[depth][0] = moves[i];
+                    // Update history, killer and counter-moves (captures are ordered on their own)
+                    if (captureCount(opponent, move.r2 * BOARD_SIZE + move.c2) == 0) {
+                        if (ply < MAX_DEPTH && !sameSquares(&move, &ordering->killers[ply][0])) {
+                            ordering->killers[ply][1] = ordering->killers[ply][0];
+                            ordering->killers[ply][0] = move;
+                        }
+                        if (lastMove) {
+                            int prev = squarePair(lastMove);
+                            ordering->counterMoves[prev >> 6][prev & 63] = squarePair(&move);
+                        }
                     }
-                    historyTable[moves[i].r1][moves[i].c1][moves[i].r2][moves[i].c2] += depth * depth;
+                    ordering->history[currentPlayer][move.r1 * BOARD_SIZE + move.c1][move.r2 * BOARD_SIZE + move.c2] +=
+                        depth * depth;
                     
                     flag = 1;  // Lower bound
                     break;
@@ -1769,7 +3502,7 @@ int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int
         ttEntry->score = bestScore;
         ttEntry->depth = depth;
         ttEntry->flag = flag;
-        ttEntry->bestMove = localBestMove;
+        ttEntry->bestMove = symmetricMove(localBestMove, symmetry);
     }
     
     if (bestMove) *bestMove = localBestMove;
@@ -1779,6 +3512,7 @@ int negamaxPhased(char board[BOARD_SIZE][BOARD_SIZE], int depth, int alpha, int
 // Thread worker for parallel search
 void* minimaxWorkerPhased(void* arg) {
     ThreadData* data = (ThreadData*)arg;
+    ordering = &orderingTables[data->threadId];
     
     char tempBoard[BOARD_SIZE][BOARD_SIZE];
     copyBoard(tempBoard, data->board);
@@ -1787,9 +3521,17 @@ void* minimaxWorkerPhased(void* arg) {
     GamePhase phase = getGamePhase(tempBoard);
     int player = (data->player == 'R') ? RED_TURN : BLUE_TURN;
     
-    data->score = -negamaxPhased(tempBoard, data->depth - 1, 
+    NNUEAccumulator acc;
+    if (data->useHybrid) {
+        nnue_refreshAccumulator(&acc, tempBoard);
+    }
+    EvalState es;
+    eval_refreshState(&es, tempBoard);
+    
+    data->score = -negamaxPhased(tempBoard, data->depth - 1, 1,
                                 NEG_INF_SCORE, INF_SCORE, 
-                                1 - player, NULL, phase, data->useHybrid);
+                                1 - player, &data->move, NULL, phase, data->useHybrid,
+                                data->useHybrid ? &acc : NULL, &es);
     
     return NULL;
 }
@@ -1806,8 +3548,9 @@ Move getMinimaxMoveClassic(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer
     clock_gettime(CLOCK_MONOTONIC, &searchStart);
     atomic_store(&timeUp, 0);
     atomic_store(&nodeCount, 0);
+    evalCache_resetStats();
     
-    memset(killerMoves, 0, sizeof(killerMoves));
+    ordering_age();
     
     GamePhase phase = getGamePhase(board);
     
@@ -1855,7 +3598,7 @@ Move getMinimaxMoveClassic(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer
             }
         }
         
-        orderMovesPhased(moves, moveCount, board, currentPlayer, depth, phase);
+        orderMovesPhased(moves, moveCount, board, currentPlayer, phase);
         
         // Parallel search for first few moves
         int parallelMoves = (moveCount < MINIMAX_THREADS) ? moveCount : MINIMAX_THREADS;
@@ -1893,9 +3636,11 @@ Move getMinimaxMoveClassic(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer
                 char tempBoard[BOARD_SIZE][BOARD_SIZE];
                 copyBoard(tempBoard, board);
                 makeMove(tempBoard, moves[i]);
+                EvalState es;
+                eval_refreshState(&es, tempBoard);
                 
-                int score = -negamaxPhased(tempBoard, depth - 1, NEG_INF_SCORE, INF_SCORE,
-                                          1 - currentPlayer, NULL, phase, false);
+                int score = -negamaxPhased(tempBoard, depth - 1, 1, NEG_INF_SCORE, INF_SCORE,
+                                          1 - currentPlayer, &moves[i], NULL, phase, false, NULL, &es);
                 
                 if (score > bestScore) {
                     bestScore = score;
@@ -1913,9 +3658,11 @@ Move getMinimaxMoveClassic(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer
                 char tempBoard[BOARD_SIZE][BOARD_SIZE];
                 copyBoard(tempBoard, board);
                 makeMove(tempBoard, moves[i]);
+                EvalState es;
+                eval_refreshState(&es, tempBoard);
                 
-                int score = -negamaxPhased(tempBoard, depth - 1, NEG_INF_SCORE, INF_SCORE,
-                                          1 - currentPlayer, NULL, phase, false);
+                int score = -negamaxPhased(tempBoard, depth - 1, 1, NEG_INF_SCORE, INF_SCORE,
+                                          1 - currentPlayer, &moves[i], NULL, phase, false, NULL, &es);
                 
                 if (score > bestScore) {
                     bestScore = score;
@@ -1938,6 +3685,8 @@ Move getMinimaxMoveClassic(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer
         }
     }
     
+    evalCache_printStats("Minimax Classic");
+    
     // Fallback if no good move found
     if (bestMove.r1 == 0 && bestMove.c1 == 0 && 
         bestMove.r2 == 0 && bestMove.c2 == 0) {
@@ -1980,8 +3729,9 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
     clock_gettime(CLOCK_MONOTONIC, &searchStart);
     atomic_store(&timeUp, 0);
     atomic_store(&nodeCount, 0);
+    evalCache_resetStats();
     
-    memset(killerMoves, 0, sizeof(killerMoves));
+    ordering_age();
     
     GamePhase phase = getGamePhase(board);
     
@@ -2014,6 +3764,12 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
     // Filter bad moves first
     filterBadMoves(moves, &moveCount, board, currentPlayer);
     
+    // Root accumulator; children are derived from it incrementally
+    NNUEAccumulator rootAcc;
+    nnue_refreshAccumulator(&rootAcc, board);
+    EvalState rootState;
+    eval_refreshState(&rootState, board);
+    
     // Iterative deepening with HYBRID evaluation
     for (int depth = 1; depth <= maxDepth && !atomic_load(&timeUp); depth++) {
         // Use previous best move for move ordering
@@ -2029,7 +3785,7 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
             }
         }
         
-        orderMovesPhased(moves, moveCount, board, currentPlayer, depth, phase);
+        orderMovesPhased(moves, moveCount, board, currentPlayer, phase);
         
         // Parallel search for first few moves
         int parallelMoves = (moveCount < MINIMAX_THREADS) ? moveCount : MINIMAX_THREADS;
@@ -2066,10 +3822,15 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
             for (int i = parallelMoves; i < moveCount && !atomic_load(&timeUp); i++) {
                 char tempBoard[BOARD_SIZE][BOARD_SIZE];
                 copyBoard(tempBoard, board);
-                makeMove(tempBoard, moves[i]);
+                MoveUndo undo;
+                makeMoveWithUndo(tempBoard, moves[i], &undo);
+                NNUEAccumulator acc = rootAcc;
+                nnue_applyMove(&acc, &undo);
+                EvalState es = rootState;
+                eval_applyMove(&es, &undo);
                 
-                int score = -negamaxPhased(tempBoard, depth - 1, NEG_INF_SCORE, INF_SCORE,
-                                          1 - currentPlayer, NULL, phase, true);
+                int score = -negamaxPhased(tempBoard, depth - 1, 1, NEG_INF_SCORE, INF_SCORE,
+                                          1 - currentPlayer, &moves[i], NULL, phase, true, &acc, &es);
                 
                 if (score > bestScore) {
                     bestScore = score;
@@ -2086,10 +3847,15 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
             for (int i = 0; i < moveCount && !atomic_load(&timeUp); i++) {
                 char tempBoard[BOARD_SIZE][BOARD_SIZE];
                 copyBoard(tempBoard, board);
-                makeMove(tempBoard, moves[i]);
+                MoveUndo undo;
+                makeMoveWithUndo(tempBoard, moves[i], &undo);
+                NNUEAccumulator acc = rootAcc;
+                nnue_applyMove(&acc, &undo);
+                EvalState es = rootState;
+                eval_applyMove(&es, &undo);
                 
-                int score = -negamaxPhased(tempBoard, depth - 1, NEG_INF_SCORE, INF_SCORE,
-                                          1 - currentPlayer, NULL, phase, true);
+                int score = -negamaxPhased(tempBoard, depth - 1, 1, NEG_INF_SCORE, INF_SCORE,
+                                          1 - currentPlayer, &moves[i], NULL, phase, true, &acc, &es);
                 
                 if (score > bestScore) {
                     bestScore = score;
@@ -2112,6 +3878,8 @@ Move getMinimaxMoveNN(char board[BOARD_SIZE][BOARD_SIZE], int currentPlayer) {
         }
     }
     
+    evalCache_printStats("Minimax-Hybrid");
+    
     // Fallback if no good move found
     if (bestMove.r1 == 0 && bestMove.c1 == 0 && 
         bestMove.r2 == 0 && bestMove.c2 == 0) {
@@ -2211,6 +3979,17 @@ Move generate_move() {
         return instantWin;
     }
     
+    Move bookMove;
+    if (book_probe(board, currentPlayer, moves, moveCount, &bookMove)) {
+        safePrint("Book move: (%d,%d) -> (%d,%d)\n", bookMove.r1, bookMove.c1, bookMove.r2, bookMove.c2);
+        bookMove.r1++;
+        bookMove.c1++;
+        bookMove.r2++;
+        bookMove.c2++;
+        totalMoveCount++;
+        return bookMove;
+    }
+    
     // 나쁜 수 필터링
     filterBadMoves(moves, &moveCount, board, currentPlayer);
     
@@ -2223,16 +4002,16 @@ Move generate_move() {
     // Time allocation based on phase
     switch (currentPhase) {
         case PHASE_OPENING:
-            timeAllocated = TIME_LIMIT * 0.7;
+            timeAllocated = moveTimeLimit * 0.7;
             break;
         case PHASE_MIDGAME:
-            timeAllocated = TIME_LIMIT * 0.8;
+            timeAllocated = moveTimeLimit * 0.8;
             break;
         case PHASE_ENDGAME_EARLY:
-            timeAllocated = TIME_LIMIT * 0.85;
+            timeAllocated = moveTimeLimit * 0.85;
             break;
         case PHASE_ENDGAME_LATE:
-            timeAllocated = TIME_LIMIT * 0.9;
+            timeAllocated = moveTimeLimit * 0.9;
             break;
     }
     
@@ -2267,7 +4046,7 @@ Move generate_move() {
 }
 
 void orderMovesPhased(Move* moves, int moveCount, char board[BOARD_SIZE][BOARD_SIZE], 
-                      int currentPlayer, int depth, GamePhase phase) {
+                      int currentPlayer, GamePhase phase) {
     char playerPiece = (currentPlayer == RED_TURN) ? RED : BLUE;
     char opponentPiece = (currentPlayer == RED_TURN) ? BLUE : RED;
     
@@ -2293,23 +4072,13 @@ void orderMovesPhased(Move* moves, int moveCount, char board[BOARD_SIZE][BOARD_S
     for (int i = 0; i < moveCount; i++) {
         moves[i].score = 0;
         
-        // 1. Killer move bonus
-        if (depth < MAX_DEPTH) {
-            if ((moves[i].r1 == killerMoves[depth][0].r1 && 
-                 moves[i].c1 == killerMoves[depth][0].c1 &&
-                 moves[i].r2 == killerMoves[depth][0].r2 && 
-                 moves[i].c2 == killerMoves[depth][0].c2) ||
-                (moves[i].r1 == killerMoves[depth][1].r1 && 
-                 moves[i].c1 == killerMoves[depth][1].c1 &&
-                 moves[i].r2 == killerMoves[depth][1].r2 && 
-                 moves[i].c2 == killerMoves[depth][1].c2)) {
-                moves[i].score += 900;
-            }
+        // 1-2. History heuristic (the root has no killers: they are kept per ply below it)
+        int from = moves[i].r1 * BOARD_SIZE + moves[i].c1;
+        int to = moves[i].r2 * BOARD_SIZE + moves[i].c2;
+        for (int slot = 0; slot < ORDERING_SLOTS; slot++) {
+            moves[i].score += orderingTables[slot].history[currentPlayer][from][to];
         }
         
-        // 2. History heuristic
-        moves[i].score += historyTable[moves[i].r1][moves[i].c1][moves[i].r2][moves[i].c2];
-        
         // 3. 수를 적용한 후의 보드 상태 계산
         char tempBoard[BOARD_SIZE][BOARD_SIZE];
         copyBoard(tempBoard, board);
@@ -2428,31 +4197,73 @@ void sendJSON(cJSON* json) {
     
     char* json_str = cJSON_PrintUnformatted(json);
     if (json_str) {
-        send(sockfd, json_str, strlen(json_str), 0);
-        send(sockfd, "\n", 1, 0);
+        // Payload and newline in one syscall
+        struct iovec parts[2] = {
+            { json_str, strlen(json_str) },
+            { "\n", 1 }
+        };
+        writev(sockfd, parts, 2);
         safePrint("[CLIENT->SERVER] %s\n", json_str);
         free(json_str);
     }
 }
 
+void sendFrame(const uint8_t* payload, size_t len) {
+    if (sockfd < 0) return;
+    
+    uint8_t frame[WIRE_MAX_HEADER + WIRE_MAX_FRAME];
+    size_t header = wire_putHeader(frame, len);
+    memcpy(frame + header, payload, len);
+    send(sockfd, frame, header + len, 0);
+}
+
 void sendRegister(const char* username) {
+    if (atomic_load(&wireActive)) {
+        uint8_t payload[2 + 258];
+        size_t n = 0;
+        payload[n++] = WIRE_REGISTER;
+        payload[n++] = 0;  // AI player
+        n += wire_putString(payload + n, username);
+        sendFrame(payload, n);
+        return;
+    }
+    
     cJSON* message = cJSON_CreateObject();
     cJSON_AddStringToObject(message, "type", "register");
     cJSON_AddStringToObject(message, "username", username);
+    if (wireRequested) {
+        cJSON_AddStringToObject(message, "protocol", WIRE_PROTOCOL_NAME);
+    }
     sendJSON(message);
     cJSON_Delete(message);
 }
 
 void sendMove(int sx, int sy, int tx, int ty) {
-    cJSON* message = cJSON_CreateObject();
-    cJSON_AddStringToObject(message, "type", "move");
-    cJSON_AddStringToObject(message, "username", my_username);
-    cJSON_AddNumberToObject(message, "sx", sx);
-    cJSON_AddNumberToObject(message, "sy", sy);
-    cJSON_AddNumberToObject(message, "tx", tx);
-    cJSON_AddNumberToObject(message, "ty", ty);
-    sendJSON(message);
-    cJSON_Delete(message);
+    if (atomic_load(&wireActive)) {
+        uint8_t payload[3];
+        payload[0] = WIRE_MOVE;
+        wire_putMove(payload + 1, wire_packMove(sx, sy, tx, ty));
+        sendFrame(payload, sizeof(payload));
+        safePrint("[CLIENT->SERVER] move (%d,%d)->(%d,%d)\n", sx, sy, tx, ty);
+        return;
+    }
+    
+    // Only the coordinates change between moves: the escaped username is
+    // printed once and every move is formatted on the stack
+    static char movePrefix[600];
+    if (!movePrefix[0]) {
+        cJSON* name = cJSON_CreateString(my_username);
+        char* quoted = name ? cJSON_PrintUnformatted(name) : NULL;
+        snprintf(movePrefix, sizeof(movePrefix), "{\"type\":\"move\",\"username\":%s", quoted ? quoted : "\"\"");
+        free(quoted);
+        cJSON_Delete(name);
+    }
+    
+    char line[sizeof(movePrefix) + 64];
+    int len = snprintf(line, sizeof(line), "%s,\"sx\":%d,\"sy\":%d,\"tx\":%d,\"ty\":%d}\n",
+                       movePrefix, sx, sy, tx, ty);
+    send(sockfd, line, len, 0);
+    safePrint("[CLIENT->SERVER] %.*s\n", len - 1, line);
 }
 
 void updateBoardFromJSON(cJSON* board_array) {
@@ -2493,6 +4304,84 @@ void printBoard() {
     safePrint("You are: %s (%c)\n", my_color == RED ? "Red" : "Blue", my_color);
 }
 
+// ===== SERVER EVENTS =====
+// Shared by the JSON and the binary protocol once a message is decoded
+
+void onGameStart(const char* redPlayer) {
+    safePrint("\n🎮 GAME STARTED! 🎮\n");
+    
+    if (redPlayer) {
+        if (strcmp(my_username, redPlayer) == 0) {
+            my_color = RED;
+            currentPlayer = RED_TURN;
+        } else {
+            my_color = BLUE;
+            currentPlayer = BLUE_TURN;
+        }
+    }
+    
+    atomic_store(&gameStarted, 1);
+    totalMoveCount = 0;
+    positionHistoryCount = 0;
+    moveHistoryCount = 0;
+    
+    nnue_checkForUpdate();
+    
+    updateLEDDisplay();
+}
+
+// board already holds the position; timeLeftMs < 0 when the server sent none
+void onYourTurn(double timeLeftMs) {
+    // The server's deadline is exact to the millisecond, so the budget is
+    // what is left of it minus a margin; older servers only send "timeout"
+    moveTimeLimit = TIME_LIMIT;
+    if (timeLeftMs >= 0) {
+        moveTimeLimit = timeLeftMs / 1000.0 - DEADLINE_MARGIN;
+        if (moveTimeLimit < SAFETY_MARGIN) moveTimeLimit = SAFETY_MARGIN;
+    }
+    
+    atomic_store(&myTurn, 1);
+    
+    Move bestMove = generate_move();
+    
+    sendMove(bestMove.r1, bestMove.c1, bestMove.r2, bestMove.c2);
+    
+    atomic_store(&myTurn, 0);
+}
+
+void onGameOver(int my_score, int opponent_score) {
+    safePrint("\n🏁 GAME OVER! 🏁\n");
+    
+    safePrint("\nFinal Scores:\n");
+    safePrint("  You: %d\n", my_score);
+    safePrint("  Opponent: %d\n", opponent_score);
+    
+    if (my_score > opponent_score) {
+        safePrint("\n🎉 VICTORY! 🎉\n");
+    } else if (opponent_score > my_score) {
+        safePrint("\n😔 DEFEAT 😔\n");
+    } else {
+        safePrint("\n🤝 DRAW! 🤝\n");
+    }
+    
+    if (led_initialized) {
+        int red_count = countPieces(board, RED);
+        int blue_count = countPieces(board, BLUE);
+        show_game_over_animation(red_count, blue_count);
+    }
+    
+    printBoard();
+    
+    // Stay for the next game; the session ends when the server closes the connection
+    if (rejoinEnabled) {
+        atomic_store(&gameStarted, 0);
+        resetBoard();
+        sendRegister(my_username);
+        return;
+    }
+    atomic_store(&gameOver, 1);
+}
+
 void handleServerMessage(const char* json_str) {
     cJSON* message = cJSON_Parse(json_str);
     if (!message) {
@@ -2512,6 +4401,14 @@ void handleServerMessage(const char* json_str) {
     
     if (strcmp(type_str, "register_ack") == 0) {
         safePrint("✓ Registration successful!\n");
+        
+        // Frames follow from here on if the server took the binary protocol
+        cJSON* protocol = cJSON_GetObjectItem(message, "protocol");
+        if (wireRequested && protocol && cJSON_IsString(protocol) &&
+            strcmp(protocol->valuestring, WIRE_PROTOCOL_NAME) == 0) {
+            safePrint("Protocol: binary\n");
+            atomic_store(&wireActive, 1);
+        }
     }
     else if (strcmp(type_str, "register_nack") == 0) {
         safePrint("✗ Registration failed!\n");
@@ -2519,30 +4416,18 @@ void handleServerMessage(const char* json_str) {
         exit(1);
     }
     else if (strcmp(type_str, "game_start") == 0) {
-        safePrint("\n🎮 GAME STARTED! 🎮\n");
-        
+        const char* redPlayer = NULL;
         cJSON* players = cJSON_GetObjectItem(message, "players");
         if (players && cJSON_IsArray(players)) {
             cJSON* player1 = cJSON_GetArrayItem(players, 0);
             cJSON* player2 = cJSON_GetArrayItem(players, 1);
             
-            if (player1 && player2) {
-                if (strcmp(my_username, player1->valuestring) == 0) {
-                    my_color = RED;
-                    currentPlayer = RED_TURN;
-                } else {
-                    my_color = BLUE;
-                    currentPlayer = BLUE_TURN;
-                }
+            if (player1 && player2 && cJSON_IsString(player1)) {
+                redPlayer = player1->valuestring;
             }
         }
         
-        atomic_store(&gameStarted, 1);
-        totalMoveCount = 0;
-        positionHistoryCount = 0;
-        moveHistoryCount = 0;
-        
-        updateLEDDisplay();
+        onGameStart(redPlayer);
     }
     else if (strcmp(type_str, "your_turn") == 0) {
         safePrint("\n=== YOUR TURN ===\n");
@@ -2553,13 +4438,8 @@ void handleServerMessage(const char* json_str) {
             printBoard();
         }
         
-        atomic_store(&myTurn, 1);
-        
-        Move bestMove = generate_move();
-        
-        sendMove(bestMove.r1, bestMove.c1, bestMove.r2, bestMove.c2);
-        
-        atomic_store(&myTurn, 0);
+        cJSON* time_left = cJSON_GetObjectItem(message, "time_left_ms");
+        onYourTurn(time_left && cJSON_IsNumber(time_left) ? time_left->valuedouble : -1);
     }
     else if (strcmp(type_str, "move_ok") == 0 || strcmp(type_str, "invalid_move") == 0) {
         cJSON* board_json = cJSON_GetObjectItem(message, "board");
@@ -2569,12 +4449,10 @@ void handleServerMessage(const char* json_str) {
         }
     }
     else if (strcmp(type_str, "game_over") == 0) {
-        safePrint("\n🏁 GAME OVER! 🏁\n");
-        
         cJSON* scores = cJSON_GetObjectItem(message, "scores");
+        int my_score = 0, opponent_score = 0;
         if (scores && cJSON_IsObject(scores)) {
             cJSON* score = NULL;
-            int my_score = 0, opponent_score = 0;
             
             cJSON_ArrayForEach(score, scores) {
                 if (cJSON_IsNumber(score)) {
@@ -2585,28 +4463,9 @@ void handleServerMessage(const char* json_str) {
                     }
                 }
             }
-            
-            safePrint("\nFinal Scores:\n");
-            safePrint("  You: %d\n", my_score);
-            safePrint("  Opponent: %d\n", opponent_score);
-            
-            if (my_score > opponent_score) {
-                safePrint("\n🎉 VICTORY! 🎉\n");
-            } else if (opponent_score > my_score) {
-                safePrint("\n😔 DEFEAT 😔\n");
-            } else {
-                safePrint("\n🤝 DRAW! 🤝\n");
-            }
-            
-            if (led_initialized) {
-                int red_count = countPieces(board, RED);
-                int blue_count = countPieces(board, BLUE);
-                show_game_over_animation(red_count, blue_count);
-            }
         }
         
-        atomic_store(&gameOver, 1);
-        printBoard();
+        onGameOver(my_score, opponent_score);
     }
     else if (strcmp(type_str, "pass") == 0) {
         safePrint("Turn passed\n");
@@ -2615,6 +4474,78 @@ void handleServerMessage(const char* json_str) {
     cJSON_Delete(message);
 }
 
+// Same events as handleServerMessage, decoded from a wire.h frame
+void handleServerFrame(const uint8_t* payload, size_t len) {
+    const uint8_t* p = payload + 1;
+    size_t left = len - 1;
+    
+    safePrint("[SERVER->CLIENT] frame type %d, %zu bytes\n", payload[0], len);
+    
+    switch (payload[0]) {
+        case WIRE_REGISTER_ACK:
+            safePrint("✓ Registration successful!\n");
+            break;
+        
+        case WIRE_REGISTER_NACK:
+            safePrint("✗ Registration failed!\n");
+            cleanup();
+            exit(1);
+        
+        case WIRE_GAME_START: {
+            char red[256], blue[256];
+            size_t n = wire_getString(p, left, red, sizeof(red));
+            if (!n || !wire_getString(p + n, left - n, blue, sizeof(blue))) break;
+            onGameStart(red);
+            break;
+        }
+        
+        case WIRE_YOUR_TURN: {
+            uint64_t timeout, timeLeft;
+            if (left < WIRE_BOARD_BYTES) break;
+            int n = wire_getVarint(p + WIRE_BOARD_BYTES, left - WIRE_BOARD_BYTES, &timeout);
+            if (n <= 0) break;
+            int m = wire_getVarint(p + WIRE_BOARD_BYTES + n, left - WIRE_BOARD_BYTES - n, &timeLeft);
+            if (m <= 0) break;
+            
+            safePrint("\n=== YOUR TURN ===\n");
+            wire_getBoard(p, board);
+            updateLEDDisplay();
+            printBoard();
+            onYourTurn((double)timeLeft);
+            break;
+        }
+        
+        case WIRE_MOVE_OK:
+        case WIRE_INVALID_MOVE:
+            if (payload[0] == WIRE_INVALID_MOVE) {
+                if (left < 1 || !(p[0] & 1)) break;  // No board: not our turn
+                p++;
+                left--;
+            }
+            if (left < WIRE_BOARD_BYTES + 3) break;
+            wire_getBoard(p, board);
+            updateLEDDisplay();
+            safePrint("Board updated after move feedback\n");
+            break;
+        
+        case WIRE_PASS:
+            safePrint("Turn passed\n");
+            break;
+        
+        case WIRE_GAME_OVER: {
+            uint64_t red, blue;
+            int n = wire_getVarint(p, left, &red);
+            if (n <= 0 || wire_getVarint(p + n, left - n, &blue) <= 0) break;
+            if (my_color == RED) {
+                onGameOver((int)red, (int)blue);
+            } else {
+                onGameOver((int)blue, (int)red);
+            }
+            break;
+        }
+    }
+}
+
 void* receiveMessages(void* arg) {
     (void)arg;
     char buffer[BUFFER_SIZE];
@@ -2637,12 +4568,30 @@ void* receiveMessages(void* arg) {
             recv_buffer[recv_len] = '\0';
             
             char* start = recv_buffer;
-            char* newline = NULL;
             
-            while ((newline = strchr(start, '\n')) != NULL) {
-                *newline = '\0';
-                handleServerMessage(start);
-                start = newline + 1;
+            // The register_ack can switch the stream to frames mid-buffer
+            while (!atomic_load(&gameOver)) {
+                size_t available = recv_len - (start - recv_buffer);
+                
+                if (atomic_load(&wireActive)) {
+                    const uint8_t* payload;
+                    size_t len;
+                    int span = wire_nextFrame((const uint8_t*)start, available, &payload, &len);
+                    if (span < 0) {
+                        safePrint("\n💔 Corrupt frame from server.\n");
+                        atomic_store(&gameOver, 1);
+                        break;
+                    }
+                    if (span == 0) break;
+                    handleServerFrame(payload, len);
+                    start += span;
+                } else {
+                    char* newline = memchr(start, '\n', available);
+                    if (!newline) break;
+                    *newline = '\0';
+                    handleServerMessage(start);
+                    start = newline + 1;
+                }
             }
             
             int remaining = recv_len - (start - recv_buffer);
@@ -2656,12 +4605,32 @@ void* receiveMessages(void* arg) {
     return NULL;
 }
 
+void resetBoard() {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            board[i][j] = EMPTY;
+        }
+    }
+    board[0][0] = RED;
+    board[0][7] = BLUE;
+    board[7][0] = BLUE;
+    board[7][7] = RED;
+}
+
 void initializeAISystem() {
     safePrint("Initializing AI System (RPi optimized)...\n");
     
     srand(time(NULL));
     
     initZobrist();
+    nnue_init();
+    pattern_init();
+    book_init();
+    
+    if (!verifyEvalState()) {
+        safePrint("Incremental evaluation mismatch, using the reference evaluator\n");
+        evalStateEnabled = 0;
+    }
     
     // Allocate transposition table (smaller for RPi)
     size_t ttSize = HASH_SIZE * sizeof(TTEntry);
@@ -2671,20 +4640,16 @@ void initializeAISystem() {
         exit(1);
     }
     
-    // Initialize board
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            board[i][j] = EMPTY;
-        }
+    evalCache = (EvalCacheEntry*)calloc(EVAL_CACHE_SIZE, sizeof(EvalCacheEntry));
+    if (!evalCache) {
+        safePrint("Failed to allocate evaluation cache\n");
+        exit(1);
     }
-    board[0][0] = RED;
-    board[0][7] = BLUE;
-    board[7][0] = BLUE;
-    board[7][7] = RED;
+    
+    resetBoard();
     
     // Clear history tables
-    memset(historyTable, 0, sizeof(historyTable));
-    memset(killerMoves, 0, sizeof(killerMoves));
+    memset(orderingTables, 0, sizeof(orderingTables));
     memset(positionHistory, 0, sizeof(positionHistory));
     memset(moveHistory, 0, sizeof(moveHistory));
     
@@ -2696,6 +4661,10 @@ void cleanupAISystem() {
         free(transpositionTable);
         transpositionTable = NULL;
     }
+    if (evalCache) {
+        free(evalCache);
+        evalCache = NULL;
+    }
 }
 
 void cleanup() {
@@ -2740,6 +4709,23 @@ int main(int argc, char *argv[]) {
             }
         } else if (strcmp(argv[i], "-no-board") == 0) {
             boardServerEnabled = 0;
+        } else if (strcmp(argv[i], "-rave") == 0) {
+            mctsRaveEnabled = 1;
+        } else if (strcmp(argv[i], "-nnue-kernel") == 0 && i + 1 < argc) {
+            nnueKernelRequest = argv[++i];
+        } else if (strcmp(argv[i], "-net") == 0 && i + 1 < argc) {
+            snprintf(nnueNetPath, sizeof(nnueNetPath), "%s", argv[++i]);
+            nnueNetRequired = 1;
+        } else if (strcmp(argv[i], "-patterns") == 0 && i + 1 < argc) {
+            snprintf(patternPath, sizeof(patternPath), "%s", argv[++i]);
+            patternRequired = 1;
+        } else if (strcmp(argv[i], "-book") == 0 && i + 1 < argc) {
+            snprintf(bookPath, sizeof(bookPath), "%s", argv[++i]);
+            bookRequired = 1;
+        } else if (strcmp(argv[i], "-binary") == 0) {
+            wireRequested = 1;
+        } else if (strcmp(argv[i], "-rejoin") == 0) {
+            rejoinEnabled = 1;
         }
     }
     
@@ -2764,18 +4750,13 @@ int main(int argc, char *argv[]) {
     printf("AI Engine: %s\n", engineNames[(int)aiEngine]);
     printf("LED Display: %s\n", boardServerEnabled ? "Enabled" : "Disabled");
     printf("Time limit: %.1f seconds\n", TIME_LIMIT);
+    printf("MCTS RAVE: %s\n", mctsRaveEnabled ? "Enabled" : "Disabled");
     
-    #ifdef HAS_NNUE_WEIGHTS
-    printf("NNUE: Enabled (Deep 4-layer network)\n");
-    #else
-    printf("NNUE: Disabled\n");
-    #endif
-    
-    #ifdef HAS_OPENING_BOOK
-    printf("Opening Book: Enabled\n");
-    #else
-    printf("Opening Book: Disabled\n");
-    #endif
+    printf("NNUE network: %s\n", nnueNetPath);
+    printf("Pattern tables: %s\n", patternPath);
+    printf("Opening book: %s\n", bookPath);
+    printf("Protocol: %s\n", wireRequested ? "binary (if the server accepts it)" : "JSON");
+    printf("After game over: %s\n", rejoinEnabled ? "register again" : "exit");
     
     initializeAISystem();
     initLEDDisplay();
@@ -2811,6 +4792,10 @@ int main(int argc, char *argv[]) {
     
     printf("✅ Connected to server!\n\n");
     
+    // Moves are single small writes; send them without waiting on Nagle
+    int nodelay = 1;
+    setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    
     sendRegister(my_username);
     
     pthread_t receiver_thread;
@@ -0,0 +1,109 @@
+// eval_terms.h - Terms of the classical OctaFlip evaluation
+// Shared by the client and the texel_tune tool, so both score a board alike
+#ifndef EVAL_TERMS_H
+#define EVAL_TERMS_H
+
+#include <stdint.h>
+#include "eval_weights.h"
+
+#define PST_TABLES 3
+static const double (*const POSITION_TABLES[PST_TABLES])[8] = {
+    POSITION_WEIGHTS_OPENING, POSITION_WEIGHTS_MIDGAME, POSITION_WEIGHTS_ENDGAME
+};
+
+// Tapered classical eval: each GamePhase's piece value and position table
+// apply fully at the given board fill (pieces / (pieces + empty), in 1/256)
+// and are blended linearly in between
+static const int TAPER_FILL[4] = {77, 141, 192, 230};
+static const int TAPER_TABLE[4] = {0, 1, 2, 2};
+
+// Bit r * 8 + c is square (r, c)
+typedef uint64_t Bitboard;
+
+#define BB_FILE_0 0x0101010101010101ULL
+#define BB_EDGES 0xFF818181818181FFULL
+#define BB_CORNERS 0x8100000000000081ULL
+#define BB_X_SQUARES 0x0042000000004200ULL
+
+// Squares that stay on the board after a column step of dc, indexed by dc + 2
+static const Bitboard BB_COLUMN_OK[5] = {
+    ~(BB_FILE_0 | BB_FILE_0 << 1),
+    ~BB_FILE_0,
+    ~0ULL,
+    ~(BB_FILE_0 << 7),
+    ~(BB_FILE_0 << 6 | BB_FILE_0 << 7)
+};
+
+static const int BB_DIRS[8][2] = {
+    {-1, -1}, {-1, 0}, {-1, 1},
+    { 0, -1},          { 0, 1},
+    { 1, -1}, { 1, 0}, { 1, 1}
+};
+
+// Move every bit by (dr, dc), dropping the ones that leave the board
+static inline Bitboard bb_shift(Bitboard bb, int dr, int dc) {
+    int shift = dr * 8 + dc;
+    bb &= BB_COLUMN_OK[dc + 2];
+    return shift >= 0 ? bb << shift : bb >> -shift;
+}
+
+// Same count as the client's getAllValidMoves: one clone per (piece, target)
+// pair plus jumps, capped at the size of its move list
+static inline int bb_moveCount(Bitboard own, Bitboard empty, int cap) {
+    int count = 0;
+    for (int d = 0; d < 8; d++) {
+        count += __builtin_popcountll(bb_shift(own, BB_DIRS[d][0], BB_DIRS[d][1]) & empty);
+        count += __builtin_popcountll(bb_shift(own, 2 * BB_DIRS[d][0], 2 * BB_DIRS[d][1]) & empty);
+    }
+    return count < cap ? count : cap;
+}
+
+// Own neighbours summed over own pieces
+static inline int bb_connectivity(Bitboard own) {
+    int count = 0;
+    for (int d = 0; d < 8; d++) {
+        count += __builtin_popcountll(own & bb_shift(own, BB_DIRS[d][0], BB_DIRS[d][1]));
+    }
+    return count;
+}
+
+// X-squares held without the corner next to them
+static inline int bb_xSquares(Bitboard own) {
+    Bitboard corners = own & BB_CORNERS;
+    Bitboard covered = bb_shift(corners, 1, 1) | bb_shift(corners, 1, -1) |
+                       bb_shift(corners, -1, 1) | bb_shift(corners, -1, -1);
+    return __builtin_popcountll(own & BB_X_SQUARES & ~covered);
+}
+
+// TAPER_FILL segment the board fill falls in, and how far along it (0..1)
+static inline void taperSegment(int pieces, int empty, int* segment, double* t) {
+    int fill = (pieces + empty) ? pieces * 256 / (pieces + empty) : 256;
+    int k = 0;
+    
+    if (fill <= TAPER_FILL[0]) {
+        *t = 0.0;
+    } else if (fill >= TAPER_FILL[3]) {
+        k = 2;
+        *t = 1.0;
+    } else {
+        while (fill > TAPER_FILL[k + 1]) k++;
+        *t = (double)(fill - TAPER_FILL[k]) / (TAPER_FILL[k + 1] - TAPER_FILL[k]);
+    }
+    *segment = k;
+}
+
+// Piece value and position table weights for the current board fill
+static inline void taperWeights(int pieces, int empty, double* pieceValue, double tableWeight[PST_TABLES]) {
+    int k;
+    double t;
+    taperSegment(pieces, empty, &k, &t);
+    
+    *pieceValue = TAPER_PIECE_VALUE[k] * (1.0 - t) + TAPER_PIECE_VALUE[k + 1] * t;
+    for (int i = 0; i < PST_TABLES; i++) {
+        tableWeight[i] = 0.0;
+    }
+    tableWeight[TAPER_TABLE[k]] += 1.0 - t;
+    tableWeight[TAPER_TABLE[k + 1]] += t;
+}
+
+#endif // EVAL_TERMS_H
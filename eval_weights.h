@@ -0,0 +1,51 @@
+// eval_weights.h - Weights of the classical OctaFlip evaluation
+// Hand-tuned values; texel_tune can refit them from game logs (make tune)
+#ifndef EVAL_WEIGHTS_H
+#define EVAL_WEIGHTS_H
+
+// Opening: 중앙 제어 + 초기 위치 활용
+static const double POSITION_WEIGHTS_OPENING[8][8] = {
+    { 20, -10,  10,   5,   5,  10, -10,  20},
+    {-10, -20,   5,   5,   5,   5, -20, -10},
+    { 10,   5,  15,  20,  20,  15,   5,  10},
+    {  5,   5,  20,  25,  25,  20,   5,   5},
+    {  5,   5,  20,  25,  25,  20,   5,   5},
+    { 10,   5,  15,  20,  20,  15,   5,  10},
+    {-10, -20,   5,   5,   5,   5, -20, -10},
+    { 20, -10,  10,   5,   5,  10, -10,  20}
+};
+
+// Midgame: 안정성 vs 기동성 균형
+static const double POSITION_WEIGHTS_MIDGAME[8][8] = {
+    { 50, -20,  20,  10,  10,  20, -20,  50},
+    {-20, -40,   0,   0,   0,   0, -40, -20},
+    { 20,   0,  10,  10,  10,  10,   0,  20},
+    { 10,   0,  10,  15,  15,  10,   0,  10},
+    { 10,   0,  10,  15,  15,  10,   0,  10},
+    { 20,   0,  10,  10,  10,  10,   0,  20},
+    {-20, -40,   0,   0,   0,   0, -40, -20},
+    { 50, -20,  20,  10,  10,  20, -20,  50}
+};
+
+// Endgame: 코너와 엣지가 결정적
+static const double POSITION_WEIGHTS_ENDGAME[8][8] = {
+    {100, -40,  40,  30,  30,  40, -40, 100},
+    {-40, -80, -10, -10, -10, -10, -80, -40},
+    { 40, -10,  10,   0,   0,  10, -10,  40},
+    { 30, -10,   0,   0,   0,   0, -10,  30},
+    { 30, -10,   0,   0,   0,   0, -10,  30},
+    { 40, -10,  10,   0,   0,  10, -10,  40},
+    {-40, -80, -10, -10, -10, -10, -80, -40},
+    {100, -40,  40,  30,  30,  40, -40, 100}
+};
+
+// Piece value at each TAPER_FILL point
+static const double TAPER_PIECE_VALUE[4] = {80.0, 100.0, 120.0, 200.0};
+
+#define CORNER_BONUS 300.0
+#define X_SQUARE_PENALTY 150.0
+#define MOBILITY_WEIGHT 5.0
+#define CONNECTIVITY_WEIGHT 3.0
+#define EDGE_WEIGHT 10.0
+
+#endif // EVAL_WEIGHTS_H
@@ -0,0 +1,71 @@
+// event_log.h - Compact binary game event log
+// Written by the server's logger thread with -event-log FILE and read back
+// by the event_log_dump pretty-printer
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "wire.h"
+
+// The file starts with the magic, then records back to back
+#define EVENT_LOG_MAGIC "OFEVLOG1"
+#define EVENT_LOG_MAGIC_SIZE 8
+
+// Record header: u64 time (ms since the epoch), u32 game, u8 type, u8 seat,
+// u16 data length, all little-endian, then the data
+#define EVENT_LOG_HEADER 16
+#define EVENT_LOG_MAX_DATA 600
+
+typedef enum {
+    EVENT_START = 1,    // board (wire.h bitboards), string red player, string blue player
+    EVENT_MOVE,         // move (wire.h), u64 red delta, u64 blue delta (XOR with the previous board)
+    EVENT_INVALID,      // move; WIRE_PASS_MOVE for a pass refused while moves exist,
+                        // EVENT_OFF_BOARD_MOVE for coordinates outside the board
+    EVENT_PASS,         // (empty) - the player passed
+    EVENT_TIMEOUT,      // (empty) - the server passed for the player
+    EVENT_DISCONNECT,   // (empty)
+    EVENT_END           // varint red score, varint blue score, varint moves
+} EventType;
+
+// An invalid move whose coordinates cannot be packed, as on the wire
+#define EVENT_OFF_BOARD_MOVE WIRE_OFF_BOARD_MOVE
+
+typedef struct {
+    uint64_t time_ms;
+    uint32_t game;
+    uint8_t type;
+    uint8_t seat;
+    uint16_t len;
+    uint8_t data[EVENT_LOG_MAX_DATA];
+} EventRecord;
+
+// Record header and data as one buffer; returns its size
+static inline size_t eventLog_encode(const EventRecord* r, uint8_t* out) {
+    wire_putU64(out, r->time_ms);
+    for (int i = 0; i < 4; i++) out[8 + i] = (uint8_t)(r->game >> (8 * i));
+    out[12] = r->type;
+    out[13] = r->seat;
+    out[14] = (uint8_t)r->len;
+    out[15] = (uint8_t)(r->len >> 8);
+    memcpy(out + EVENT_LOG_HEADER, r->data, r->len);
+    return EVENT_LOG_HEADER + r->len;
+}
+
+// Next record of an open log; 1 on success, 0 at the end or on a torn record
+static inline int eventLog_read(FILE* file, EventRecord* r) {
+    uint8_t header[EVENT_LOG_HEADER];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header)) return 0;
+    
+    r->time_ms = wire_getU64(header);
+    r->game = (uint32_t)header[8] | (uint32_t)header[9] << 8 |
+              (uint32_t)header[10] << 16 | (uint32_t)header[11] << 24;
+    r->type = header[12];
+    r->seat = header[13];
+    r->len = (uint16_t)(header[14] | header[15] << 8);
+    if (r->len > EVENT_LOG_MAX_DATA) return 0;
+    return fread(r->data, 1, r->len, file) == r->len;
+}
+
+#endif // EVENT_LOG_H
@@ -0,0 +1,179 @@
+// event_log_dump.c - Pretty-printer for the server's binary event log
+// Usage: event_log_dump [-game N] [-boards] events.bin ...
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "event_log.h"
+
+// Board of every game seen so far, rebuilt from START and MOVE deltas
+typedef struct {
+    uint32_t game;
+    uint64_t red, blue, blocked;
+    char players[2][256];
+} GameBoard;
+
+static GameBoard* games = NULL;
+static int gameCount = 0;
+static int gameCapacity = 0;
+
+static GameBoard* findGame(uint32_t id, int create) {
+    for (int i = gameCount - 1; i >= 0; i--) {
+        if (games[i].game == id) return &games[i];
+    }
+    if (!create) return NULL;
+    
+    if (gameCount == gameCapacity) {
+        gameCapacity = gameCapacity ? gameCapacity * 2 : 64;
+        games = realloc(games, gameCapacity * sizeof(GameBoard));
+        if (!games) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    GameBoard* g = &games[gameCount++];
+    memset(g, 0, sizeof(*g));
+    g->game = id;
+    return g;
+}
+
+static void printBoard(const GameBoard* g) {
+    printf("    1 2 3 4 5 6 7 8\n");
+    for (int r = 0; r < 8; r++) {
+        printf("  %d ", r + 1);
+        for (int c = 0; c < 8; c++) {
+            uint64_t bit = 1ULL << (r * 8 + c);
+            printf("%c ", (g->red & bit) ? 'R' : (g->blue & bit) ? 'B' : (g->blocked & bit) ? '#' : '.');
+        }
+        printf("\n");
+    }
+}
+
+static void formatMove(uint16_t move, char* out, size_t size) {
+    if (move == WIRE_PASS_MOVE) {
+        snprintf(out, size, "pass");
+        return;
+    }
+    if (move == EVENT_OFF_BOARD_MOVE) {
+        snprintf(out, size, "off-board move");
+        return;
+    }
+    int sx, sy, tx, ty;
+    wire_unpackMove(move, &sx, &sy, &tx, &ty);
+    snprintf(out, size, "(%d,%d) -> (%d,%d)", sx, sy, tx, ty);
+}
+
+static void printRecord(const EventRecord* r, int showBoards) {
+    time_t seconds = (time_t)(r->time_ms / 1000);
+    struct tm tm_info;
+    char stamp[32];
+    localtime_r(&seconds, &tm_info);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &tm_info);
+    
+    GameBoard* g = findGame(r->game, r->type == EVENT_START);
+    const char* player = g && g->players[r->seat & 1][0] ? g->players[r->seat & 1] : (r->seat ? "Blue" : "Red");
+    char move[32];
+    
+    printf("[%s.%03d] game %u: ", stamp, (int)(r->time_ms % 1000), r->game);
+    
+    switch (r->type) {
+        case EVENT_START: {
+            size_t n = WIRE_BOARD_BYTES;
+            if (r->len < n) break;
+            char board[8][8];
+            wire_getBoard(r->data, board);
+            g->red = g->blue = g->blocked = 0;
+            for (int sq = 0; sq < 64; sq++) {
+                char cell = board[sq >> 3][sq & 7];
+                if (cell == 'R') g->red |= 1ULL << sq;
+                else if (cell == 'B') g->blue |= 1ULL << sq;
+                else if (cell == '#') g->blocked |= 1ULL << sq;
+            }
+            size_t m = wire_getString(r->data + n, r->len - n, g->players[0], sizeof(g->players[0]));
+            if (m) wire_getString(r->data + n + m, r->len - n - m, g->players[1], sizeof(g->players[1]));
+            printf("start, %s (Red) vs %s (Blue)\n", g->players[0], g->players[1]);
+            if (showBoards) printBoard(g);
+            break;
+        }
+        case EVENT_MOVE:
+            if (r->len < 18) break;
+            formatMove(wire_getMove(r->data), move, sizeof(move));
+            if (g) {
+                g->red ^= wire_getU64(r->data + 2);
+                g->blue ^= wire_getU64(r->data + 10);
+            }
+            printf("%s %s\n", player, move);
+            if (showBoards && g) printBoard(g);
+            break;
+        case EVENT_INVALID:
+            if (r->len < 2) break;
+            formatMove(wire_getMove(r->data), move, sizeof(move));
+            printf("%s invalid %s\n", player, move);
+            break;
+        case EVENT_PASS:
+            printf("%s pass\n", player);
+            break;
+        case EVENT_TIMEOUT:
+            printf("%s timed out, forced pass\n", player);
+            break;
+        case EVENT_DISCONNECT:
+            printf("%s disconnected\n", player);
+            break;
+        case EVENT_END: {
+            uint64_t red = 0, blue = 0, moves = 0;
+            int n = wire_getVarint(r->data, r->len, &red);
+            int m = n > 0 ? wire_getVarint(r->data + n, r->len - n, &blue) : 0;
+            if (m > 0) wire_getVarint(r->data + n + m, r->len - n - m, &moves);
+            printf("game over, Red=%llu Blue=%llu after %llu moves\n",
+                   (unsigned long long)red, (unsigned long long)blue, (unsigned long long)moves);
+            break;
+        }
+        default:
+            printf("unknown event %d (%u bytes)\n", r->type, r->len);
+            break;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int showBoards = 0;
+    long onlyGame = -1;
+    int files = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-boards") == 0) {
+            showBoards = 1;
+            continue;
+        }
+        if (strcmp(argv[i], "-game") == 0 && i + 1 < argc) {
+            onlyGame = atol(argv[++i]);
+            continue;
+        }
+        
+        FILE* file = fopen(argv[i], "rb");
+        if (!file) {
+            fprintf(stderr, "Cannot open %s\n", argv[i]);
+            return 1;
+        }
+        char magic[EVENT_LOG_MAGIC_SIZE];
+        if (fread(magic, 1, sizeof(magic), file) != sizeof(magic) ||
+            memcmp(magic, EVENT_LOG_MAGIC, EVENT_LOG_MAGIC_SIZE) != 0) {
+            fprintf(stderr, "%s is not an event log\n", argv[i]);
+            fclose(file);
+            return 1;
+        }
+        
+        static EventRecord r;
+        while (eventLog_read(file, &r)) {
+            if (onlyGame >= 0 && r.game != (uint32_t)onlyGame) continue;
+            printRecord(&r, showBoards);
+        }
+        fclose(file);
+        files++;
+    }
+    
+    if (files == 0) {
+        fprintf(stderr, "Usage: %s [-game N] [-boards] events.bin ...\n", argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,127 @@
+// game_log.h - Reader for the server's octaflip_game_*.log files and -archive files
+// Shared by the pattern_fit and texel_tune tools
+#ifndef GAME_LOG_H
+#define GAME_LOG_H
+
+#include <stdio.h>
+#include <string.h>
+#include "game_record.h"
+
+#define GAME_LOG_MAX_BOARDS 256
+#define GAME_LOG_LINE_SIZE 512
+
+// One finished game: the initial board and the board after every move or
+// pass, without the repeated final board. Forced passes (timeouts and
+// disconnects) log no board, so the side to move is kept per board.
+typedef struct {
+    char boards[GAME_LOG_MAX_BOARDS][8][8];
+    int toMove[GAME_LOG_MAX_BOARDS];  // 0 when red is to move on boards[i], 1 for blue
+    int boardCount;
+    int red, blue;  // Final score
+} GameLogGame;
+
+// Replay every game of a -archive file; the archive also records forced
+// passes, so its boards alternate strictly
+static int gameLog_readArchive(const char* path, void (*onGame)(const GameLogGame* game, void* ctx), void* ctx) {
+    GameArchive archive;
+    if (!gameArchive_open(&archive, path)) {
+        fprintf(stderr, "Cannot map archive %s (and %s.idx)\n", path, path);
+        return 0;
+    }
+    
+    static GameLogGame game;
+    GameRecord record;
+    int games = 0;
+    for (size_t id = 0; id < archive.count; id++) {
+        if (!gameArchive_get(&archive, id, &record)) continue;
+        game.boardCount = gameRecord_replay(&record, game.boards, GAME_LOG_MAX_BOARDS);
+        for (int i = 0; i < game.boardCount; i++) {
+            game.toMove[i] = i % 2;
+        }
+        game.red = record.redScore;
+        game.blue = record.blueScore;
+        onGame(&game, ctx);
+        games++;
+    }
+    
+    gameArchive_close(&archive);
+    return games;
+}
+
+// Seat (0 red, 1 blue) of the player a "Player <name>: ..." move line is
+// about, or -1 for any other line
+static int gameLog_moverSeat(const char* line, char players[2][GAME_LOG_LINE_SIZE]) {
+    if (strncmp(line, "Player ", 7) != 0) return -1;
+    for (int seat = 0; seat < 2; seat++) {
+        size_t len = strlen(players[seat]);
+        if (len && strncmp(line + 7, players[seat], len) == 0 && line[7 + len] == ':') return seat;
+    }
+    return -1;
+}
+
+// Call onGame for every finished game in one log or archive; returns how many there were
+static int gameLog_read(const char* path, void (*onGame)(const GameLogGame* game, void* ctx), void* ctx) {
+    FILE* file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 0;
+    }
+    
+    char magic[GAME_ARCHIVE_MAGIC_SIZE];
+    if (fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+        memcmp(magic, GAME_ARCHIVE_MAGIC, GAME_ARCHIVE_MAGIC_SIZE) == 0) {
+        fclose(file);
+        return gameLog_readArchive(path, onGame, ctx);
+    }
+    rewind(file);
+    
+    static GameLogGame game;
+    static char players[2][GAME_LOG_LINE_SIZE];
+    int games = 0;
+    int gameOver = 0;
+    int toMove = 0;  // Opponent of whoever made the last move line
+    char line[GAME_LOG_LINE_SIZE];
+    game.boardCount = 0;
+    
+    while (fgets(line, sizeof(line), file)) {
+        int seat;
+        const char* vs;
+        if (strncmp(line, "=== OctaFlip Game Log ===", 25) == 0) {
+            game.boardCount = 0;  // Drop boards of an unfinished game
+            toMove = 0;
+        } else if (strncmp(line, "Game #", 6) == 0 && strchr(line, ':') && (vs = strstr(line, " (Red) vs "))) {
+            const char* red = strchr(line, ':') + 2;
+            const char* blue = vs + 10;
+            const char* blueEnd = strstr(blue, " (Blue)");
+            snprintf(players[0], sizeof(players[0]), "%.*s", (int)(vs - red), red);
+            snprintf(players[1], sizeof(players[1]), "%.*s", blueEnd ? (int)(blueEnd - blue) : 0, blue);
+        } else if ((seat = gameLog_moverSeat(line, players)) >= 0) {
+            toMove = 1 - seat;
+        } else if (line[0] == '[') {
+            gameOver = strstr(line, "Game Over") != NULL;
+        } else if (strncmp(line, "Board State:", 12) == 0) {
+            char board[8][8];
+            int ok = fgets(line, sizeof(line), file) != NULL;  // Column header
+            
+            for (int r = 0; r < 8 && ok; r++) {
+                ok = fgets(line, sizeof(line), file) != NULL && strlen(line) >= 2 + 2 * 8;
+                for (int c = 0; c < 8 && ok; c++) {
+                    board[r][c] = line[2 + 2 * c];
+                }
+            }
+            if (ok && !gameOver && game.boardCount < GAME_LOG_MAX_BOARDS) {
+                game.toMove[game.boardCount] = toMove;
+                memcpy(game.boards[game.boardCount++], board, sizeof(board));
+            }
+        } else if (sscanf(line, "Final Score: Red=%d, Blue=%d", &game.red, &game.blue) == 2) {
+            onGame(&game, ctx);
+            game.boardCount = 0;
+            games++;
+        }
+    }
+    
+    fclose(file);
+    return games;
+}
+
+#endif // GAME_LOG_H
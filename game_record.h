@@ -0,0 +1,225 @@
+// game_record.h - Compact records of finished games and their indexed archive
+// The server appends one record per game with -archive FILE; game_log.h
+// replays archives for pattern_fit and texel_tune. Readers map the archive
+// and its index and reach any game by its archive ID in O(1).
+#ifndef GAME_RECORD_H
+#define GAME_RECORD_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "wire.h"
+
+// FILE starts with GAME_ARCHIVE_MAGIC followed by records back to back.
+// FILE.idx starts with GAME_INDEX_MAGIC followed by one entry per record:
+// u64 offset, u32 length, u32 server game number. A game's archive ID is
+// its entry number.
+#define GAME_ARCHIVE_MAGIC "OFGAMES1"
+#define GAME_INDEX_MAGIC "OFINDEX1"
+#define GAME_ARCHIVE_MAGIC_SIZE 8
+#define GAME_INDEX_ENTRY 16
+
+// Record, little-endian:
+//   u64 start time (ms since the epoch), u32 server game number
+//   start board (wire.h bitboards, blocked cells included)
+//   u8 red score, u8 blue score, u8 end (GameEnd), u8 reserved
+//   string red player, string blue player (wire.h strings)
+//   u16 move count, then per move u16 code and u16 milliseconds the mover used
+// Codes are wire.h moves, WIRE_PASS_MOVE for a pass and GAME_RECORD_FORCED
+// for a pass the server made on the mover's behalf (timeout, disconnect).
+#define GAME_RECORD_FORCED 0xFFFE
+#define GAME_RECORD_FIXED (8 + 4 + WIRE_BOARD_BYTES + 4)
+#define GAME_RECORD_MAX_MOVES 4096
+
+typedef enum {
+    GAME_END_NORMAL,
+    GAME_END_DISCONNECT       // A player left before the end
+} GameEnd;
+
+typedef struct {
+    uint64_t time_ms;
+    uint32_t game;
+    uint64_t red, blue, blocked;   // Start position
+    int redScore, blueScore;
+    int end;
+    char players[2][256];
+    int moveCount;
+    const uint8_t* moves;          // moveCount (code, ms) pairs of 4 bytes, read in place
+} GameRecord;
+
+static inline uint16_t gameRecord_move(const GameRecord* r, int i) {
+    return (uint16_t)(r->moves[4 * i] | r->moves[4 * i + 1] << 8);
+}
+
+static inline uint16_t gameRecord_time(const GameRecord* r, int i) {
+    return (uint16_t)(r->moves[4 * i + 2] | r->moves[4 * i + 3] << 8);
+}
+
+// Upper bound of an encoded record
+static inline size_t gameRecord_size(const GameRecord* r) {
+    return GAME_RECORD_FIXED + 2 * (2 + 255) + 2 + 4 * (size_t)r->moveCount;
+}
+
+static inline size_t gameRecord_encode(const GameRecord* r, uint8_t* out) {
+    size_t n = 0;
+    wire_putU64(out, r->time_ms);
+    for (int i = 0; i < 4; i++) out[8 + i] = (uint8_t)(r->game >> (8 * i));
+    n = 12;
+    wire_putU64(out + n, r->red);
+    wire_putU64(out + n + 8, r->blue);
+    wire_putU64(out + n + 16, r->blocked);
+    n += WIRE_BOARD_BYTES;
+    out[n++] = (uint8_t)r->redScore;
+    out[n++] = (uint8_t)r->blueScore;
+    out[n++] = (uint8_t)r->end;
+    out[n++] = 0;
+    n += wire_putString(out + n, r->players[0]);
+    n += wire_putString(out + n, r->players[1]);
+    out[n++] = (uint8_t)r->moveCount;
+    out[n++] = (uint8_t)(r->moveCount >> 8);
+    memcpy(out + n, r->moves, 4 * (size_t)r->moveCount);
+    return n + 4 * (size_t)r->moveCount;
+}
+
+// 1 if p holds a whole record; r->moves then points into p
+static inline int gameRecord_decode(const uint8_t* p, size_t len, GameRecord* r) {
+    if (len < GAME_RECORD_FIXED) return 0;
+    
+    r->time_ms = wire_getU64(p);
+    r->game = (uint32_t)p[8] | (uint32_t)p[9] << 8 | (uint32_t)p[10] << 16 | (uint32_t)p[11] << 24;
+    r->red = wire_getU64(p + 12);
+    r->blue = wire_getU64(p + 20);
+    r->blocked = wire_getU64(p + 28);
+    r->redScore = p[36];
+    r->blueScore = p[37];
+    r->end = p[38];
+    
+    size_t n = GAME_RECORD_FIXED;
+    size_t m = wire_getString(p + n, len - n, r->players[0], sizeof(r->players[0]));
+    if (!m) return 0;
+    n += m;
+    m = wire_getString(p + n, len - n, r->players[1], sizeof(r->players[1]));
+    if (!m || n + m + 2 > len) return 0;
+    n += m;
+    
+    r->moveCount = p[n] | p[n + 1] << 8;
+    r->moves = p + n + 2;
+    return n + 2 + 4 * (size_t)r->moveCount <= len;
+}
+
+// Position before every move and after the last: boards[0] is the start,
+// boards[i] the position the i-th mover saw (red moves on even i). Returns
+// how many boards were written.
+static inline int gameRecord_replay(const GameRecord* r, char boards[][8][8], int maxBoards) {
+    char board[8][8];
+    for (int sq = 0; sq < 64; sq++) {
+        uint64_t bit = 1ULL << sq;
+        board[sq >> 3][sq & 7] = (r->red & bit) ? 'R' : (r->blue & bit) ? 'B' : (r->blocked & bit) ? '#' : '.';
+    }
+    
+    int count = 0;
+    for (int i = 0; i <= r->moveCount && count < maxBoards; i++) {
+        memcpy(boards[count++], board, sizeof(board));
+        if (i == r->moveCount) break;
+        
+        uint16_t code = gameRecord_move(r, i);
+        if (code == WIRE_PASS_MOVE || code == GAME_RECORD_FORCED) continue;
+        
+        int sx, sy, tx, ty;
+        wire_unpackMove(code, &sx, &sy, &tx, &ty);
+        sx--; sy--; tx--; ty--;
+        char me = board[sx][sy];
+        char opponent = me == 'R' ? 'B' : 'R';
+        int dr = tx > sx ? tx - sx : sx - tx;
+        int dc = ty > sy ? ty - sy : sy - ty;
+        
+        board[tx][ty] = me;
+        if (dr == 2 || dc == 2) board[sx][sy] = '.';  // Jump
+        for (int r2 = tx - 1; r2 <= tx + 1; r2++) {
+            for (int c2 = ty - 1; c2 <= ty + 1; c2++) {
+                if (r2 >= 0 && r2 < 8 && c2 >= 0 && c2 < 8 && board[r2][c2] == opponent) {
+                    board[r2][c2] = me;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+// ===== ARCHIVE =====
+
+typedef struct {
+    const uint8_t* data;
+    size_t dataSize;
+    const uint8_t* index;
+    size_t indexSize;
+    size_t count;                  // Games in the archive
+} GameArchive;
+
+static inline const uint8_t* gameArchive_map(const char* path, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) return NULL;
+    
+    struct stat st;
+    const uint8_t* map = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size >= GAME_ARCHIVE_MAGIC_SIZE) {
+        void* m = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (m != MAP_FAILED) {
+            map = m;
+            *size = st.st_size;
+        }
+    }
+    close(fd);
+    return map;
+}
+
+static inline void gameArchive_close(GameArchive* a) {
+    if (a->data) munmap((void*)a->data, a->dataSize);
+    if (a->index) munmap((void*)a->index, a->indexSize);
+    memset(a, 0, sizeof(*a));
+}
+
+// Map FILE and FILE.idx; 1 on success
+static inline int gameArchive_open(GameArchive* a, const char* path) {
+    char indexPath[4096];
+    memset(a, 0, sizeof(*a));
+    snprintf(indexPath, sizeof(indexPath), "%s.idx", path);
+    
+    a->data = gameArchive_map(path, &a->dataSize);
+    a->index = gameArchive_map(indexPath, &a->indexSize);
+    if (!a->data || !a->index ||
+        memcmp(a->data, GAME_ARCHIVE_MAGIC, GAME_ARCHIVE_MAGIC_SIZE) != 0 ||
+        memcmp(a->index, GAME_INDEX_MAGIC, GAME_ARCHIVE_MAGIC_SIZE) != 0) {
+        gameArchive_close(a);
+        return 0;
+    }
+    a->count = (a->indexSize - GAME_ARCHIVE_MAGIC_SIZE) / GAME_INDEX_ENTRY;
+    return 1;
+}
+
+// Record with archive ID id; 0 if it is out of range or torn
+static inline int gameArchive_get(const GameArchive* a, size_t id, GameRecord* r) {
+    if (id >= a->count) return 0;
+    
+    const uint8_t* entry = a->index + GAME_ARCHIVE_MAGIC_SIZE + id * GAME_INDEX_ENTRY;
+    uint64_t offset = wire_getU64(entry);
+    uint32_t length = (uint32_t)entry[8] | (uint32_t)entry[9] << 8 |
+                      (uint32_t)entry[10] << 16 | (uint32_t)entry[11] << 24;
+    if (offset < GAME_ARCHIVE_MAGIC_SIZE || offset + length > a->dataSize) return 0;
+    return gameRecord_decode(a->data + offset, length, r);
+}
+
+// Index entry for a record appended at offset
+static inline void gameArchive_indexEntry(uint8_t* out, uint64_t offset, uint32_t length, uint32_t game) {
+    wire_putU64(out, offset);
+    for (int i = 0; i < 4; i++) {
+        out[8 + i] = (uint8_t)(length >> (8 * i));
+        out[12 + i] = (uint8_t)(game >> (8 * i));
+    }
+}
+
+#endif // GAME_RECORD_H
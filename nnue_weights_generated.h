@@ -1,676 +0,0 @@
-// Auto-generated Deep NNUE weights from Python training v7.0
-// 4-layer structure with batch normalization
-// Leaky ReLU activation
-
-
-#include <stdint.h>
-
-#ifndef NNUE_WEIGHTS_GENERATED_H
-#define NNUE_WEIGHTS_GENERATED_H
-
-// NN 구조 정의
-#define INPUT_SIZE 192
-#define NNUE_HIDDEN1_SIZE 64
-#define NNUE_HIDDEN2_SIZE 32
-#define NNUE_HIDDEN3_SIZE 16
-#define NNUE_OUTPUT_SCALE 1000
-#define NNUE_SCALE 1000
-
-#define HAS_NNUE_WEIGHTS
-
-
-static const int16_t nnue_w1[192][128] = {
-    {    -6,     -5,     -2,      0,      9,     -9,      5,      3,      1,      0,      1,      1,     -6,      4,    -13,      2,     -2,     -2,      5,     -3,    -10,     -6,     -5,      9,      3,      2,      7,     -3,     -1,      0,     -8,     16,      2,    -11,      2,      9,      5,     15,      2,      1,      1,     -2,      0,      3,      0,    -12,      0,     10,     -9,      3,     -5,     -8,      2,     -3,      4,     12,     10,      0,     -1,     -3,     -1,     -2,      7,      1,     -3,      0,     -7,      2,     -2,      4,     -2,     -6,     -1,     -1,     12,     10,      9,     -2,      4,     -3,      1,      6,      1,     -2,      9,     -4,     -7,      2,     -1,      8,      2,     -5,     -5,     -4,      8,      5,      7,     -4,      9,     -1,     -7,     11,      1,     -2,     -1,      9,    -11,     -3,      0,      4,      4,      6,     13,     -2,     12,     -5,      8,      2,      1,      1,     -5,      0,      8,     15,      1,     -2,      0,     -2},
-    {     3,      6,      3,      1,     -5,      6,      1,      0,     -1,      0,      4,      2,     -3,      3,     -9,      4,      0,     -4,      5,      5,     -9,      3,     -2,     -2,      3,      2,     -7,      7,      4,      3,      4,     14,      3,     -6,      0,     11,     -6,     -6,      1,      0,     -5,      3,      1,     -8,      1,     -4,      2,     -4,     -4,      4,      3,      8,      3,     -4,     12,      1,    -19,     14,      1,      1,     -6,      6,     -3,      1,     -5,     -1,      0,      0,      4,     -2,      0,      1,     13,     -6,     -2,     14,      8,      6,     -1,      1,     -8,      7,     -8,      5,      3,     -1,      5,     -4,      0,     -2,      1,      2,      1,     -4,     -1,      7,     -4,      2,     12,      3,      1,     12,      6,     -4,     -1,     -4,     -3,      0,      1,    -15,      2,     14,      6,      7,     -3,      1,      4,     -1,     -3,     -3,      7,     -8,     -3,    -10,     -3,      1,      2,     -2},
-    {    13,      3,      0,      1,     -7,      1,      1,     -1,      2,     -5,      9,      1,     -5,      1,      9,      1,     -2,      8,      3,      3,     -9,     10,     -4,      6,      1,     -7,      1,     -5,      7,    -10,      1,      9,     -8,     -4,     -1,      6,     -6,     -7,     -5,     -4,      1,     -4,     -1,     -6,      6,      5,     -1,     -2,     -3,      0,     -8,     12,     -1,     -2,      7,      5,      0,      7,     10,      4,     -1,      0,      6,     -2,      0,      0,     -4,      0,      5,     -4,     -2,     -6,      2,      5,     -5,      2,     -1,     -3,     -3,      3,      4,      0,      2,     -2,      5,      5,     -6,      7,      3,      4,     -9,      0,     13,     -2,     -5,      5,     -5,      0,     -2,      1,     -1,      4,    -11,     -7,     -2,    -11,     -4,      0,     -6,     -7,     10,      5,     -4,     -9,      2,      1,      0,      2,     -7,     -6,      2,    -11,      2,     10,      5,      0,      6,      3},
-    {    -2,      9,     10,     -4,     -2,     -1,      0,      1,     -3,     -3,      4,      8,      4,      0,     -1,     -4,     -1,      6,      1,     -3,    -11,     -8,      0,      5,      8,      4,     -1,      4,     -6,      1,      4,      7,      5,      1,      3,      6,      3,     -3,      0,     -8,     -2,      3,     -6,     -5,      3,     -1,     -4,      9,     -2,      3,      4,     -6,      1,      1,      2,      8,      3,     -2,      5,      1,     -7,      9,      3,     -4,     -3,     -6,      1,      0,      5,     -6,     -4,      7,      1,     -3,      6,     10,     -1,      3,      2,      5,     -2,     -6,     -3,     -4,     -3,      3,      0,     -2,     -7,      7,      1,     -5,      4,      1,      3,      3,      1,      3,      8,     15,      1,      6,      3,      5,     -5,     -3,     -1,     -2,     -1,     -9,      3,     -2,     18,     -4,      6,      4,    -13,      0,      1,      3,      8,      1,      7,      7,      1,     -5,     -2,      1},
-    {     3,     11,      3,      1,     -5,     12,     -2,     -5,     -6,      5,      9,      8,     -3,      0,     -1,      4,     -6,     -5,      0,    -11,    -11,    -11,    -13,      4,      3,    -12,     -4,      8,     -3,      6,     -3,      0,     -1,     -2,      9,      3,     -1,      8,     -7,     -5,     -9,     -5,     -3,    -12,      4,     -2,    -11,      0,     -7,     12,     -8,    -10,      6,     -1,      0,      4,      0,      3,     -5,     -1,    -10,     -5,      4,     -1,     -5,     -2,     -6,     -1,     -6,    -15,      8,      2,      2,      7,    -10,     -3,      4,     -6,      2,     -1,      1,     -7,     -2,     -4,      4,      3,     -4,      0,     -8,      4,      4,     -1,      7,      3,      5,      7,     -2,     -3,     -1,      3,      2,     -6,      4,      2,     -7,     -4,     -1,      3,     -8,    -21,      6,     -7,      9,     -6,      1,      5,    -12,      7,      2,     -2,      1,    -17,      2,     18,      2,      6,     -4,      4},
-    {    -3,      1,      7,      3,     11,     -6,      1,     -3,     -1,      1,      5,      0,      7,      3,     -2,      2,     -3,      2,      7,      5,      2,     -8,     -8,     -1,      1,      3,     -5,      8,     -2,      1,      9,     -9,      4,      3,     -2,      4,     -5,      0,     -5,     -1,     -7,     -5,      7,     -6,      6,      2,      3,     -1,     -1,      1,      1,    -10,     -7,      0,     -1,      6,      2,      3,      0,      5,      2,      0,     12,      2,      4,    -11,      4,      0,     -6,     -3,      9,     -4,      3,     -2,      2,     -5,      4,     -1,     -1,      4,      4,     -6,      0,     -1,      4,     -2,      0,      1,      2,      4,     -2,      5,      2,      3,     -9,     -8,     -2,     -2,      2,     -1,      0,     11,      0,     -6,      3,     -2,     -7,      1,      9,      3,      4,      6,      6,     -5,     -7,      4,     -5,     -4,      5,      5,    -11,      1,      0,      0,      4,     -3,      4,     -3},
-    {    -2,      1,      2,     -1,     14,      0,     -4,     -9,     -2,      1,     -3,      4,     -3,      2,     -2,     -1,      3,      1,     -1,     -5,      2,      9,     -7,     -2,      2,      9,     -6,     10,     -2,      4,      4,      1,     -5,      6,      0,     -1,     10,     -3,     -4,     -6,     -8,      1,      0,     -2,     -1,      0,     -1,     -2,      9,     -5,      3,      0,     -2,     -1,      4,     -3,      1,     -2,     13,      2,     -7,     -2,      6,      4,      7,     -1,     -3,     -2,      0,      0,      4,     -5,      3,      2,      0,     -4,     -1,      2,      3,     11,      3,     -5,     -5,      0,      1,     12,     -2,      4,     -1,     -2,      0,      4,      0,      6,     -1,      0,      3,     -1,      1,     15,     -4,      0,      5,     -2,      5,     -5,     -2,     -2,      4,     -7,      1,     -1,     -4,      1,     -2,     -1,      4,      0,      0,     -4,      1,      1,     -3,      2,     -9,      4,      4,      0},
-    {     4,      2,      0,      0,      0,      4,      0,     -1,      4,      0,      2,      4,      0,      3,      2,     -2,      2,     -3,     -6,     -2,    -10,     -5,     -5,     -3,      0,      3,     -4,      5,      2,      0,     -2,      0,     -4,      9,      1,      2,      4,     -5,     -2,     -6,     -4,      0,     -4,      3,      8,      1,      2,      1,      9,      1,      5,     -2,      5,     -3,      0,     -1,      5,      1,      0,      0,     -5,      0,     -3,     -4,      5,     -6,     -4,     -5,      1,     -1,      5,     -5,      0,      0,      0,     -1,      0,     -3,     -2,     -6,      4,     -4,     -4,    -13,      2,      0,     -1,     -2,      3,     -4,      0,      0,      4,      5,      0,      0,     -2,     -1,     11,      5,      0,     13,      7,     -6,      1,     -3,     -9,      0,      0,      1,     -1,     -4,      4,     -6,      0,      0,      6,      1,      9,      1,      0,      3,     -1,     -3,      2,      3,      1,     -4},
-    {     1,     -4,     -1,      0,      7,     -1,     -7,     -1,      7,      5,      1,     -2,      3,      7,      4,      3,     -2,      3,      8,     -1,    -14,     -8,     -6,     -5,      8,      0,     -6,      5,    -11,    -10,     -9,      9,      7,     10,      1,      7,     -8,    -26,     -2,     -9,     -1,     -1,     -1,      5,      0,      9,      6,      5,     -2,     -5,     -1,     -3,      0,     -3,     -2,     -3,      1,      1,     -1,      4,     -7,      7,      3,    -10,      4,    -11,     -1,     -7,      7,     -5,      3,      5,      9,      1,      0,      3,      3,     -5,     -3,      0,     -3,     -1,    -11,      3,     13,      1,      0,      2,      2,     -3,      3,     -5,     -4,      2,      3,      3,     -7,      5,      7,      7,     -6,     -3,      5,    -10,      6,      0,     -2,     -2,     10,     -4,      2,     -4,      5,      6,      2,      0,    -20,     -5,     -1,      9,      5,     -4,      5,     -6,      4,    -12,      1,      3},
-    {     5,      1,     15,     -3,     -4,      4,    -15,     -2,      3,      6,      1,      1,     -4,     13,     -4,      7,      0,      0,      5,      1,    -13,      0,      1,     -7,      9,     -3,      4,     -5,      4,     -2,      6,     -1,      0,     -1,      9,     -3,     -4,     -1,     -1,      0,     -4,    -13,      3,     -7,      2,     -7,      1,      1,     -8,      0,     -4,      5,     -2,      2,     -4,      8,     -1,      3,      4,     -7,     -3,     -5,      8,     -2,      3,      2,     -3,     -3,      7,     -7,     -1,     -2,      2,     -4,     -3,      1,      8,     -1,     -2,      2,     -6,      2,     -3,     -7,     -2,      5,     -8,     10,      1,      7,      4,      1,     -3,      1,     -2,      9,      1,     -1,     11,      2,      4,      5,     -1,     -3,     -3,     -3,     -3,     -3,      5,     -3,     16,     -2,      7,     -4,     -6,     -2,      5,     -2,     11,     -6,      6,     -4,     -5,      6,      0,      3,      4,      6},
-    {     8,      1,      0,     -1,      6,      4,      2,      2,      2,      2,      9,      1,      1,    -14,     -6,      7,     -2,      4,      7,     -4,     -4,      2,     -9,     14,      4,     -2,      4,     -2,      4,      3,     -3,      2,     -3,      1,      4,      1,      1,     -3,     -3,      4,     -5,     -8,     -5,      0,     -8,     12,      0,     -9,      4,     -8,    -20,      8,     -7,      6,      2,      8,     -7,      2,      3,      3,     -2,      1,      3,     -1,      0,     -1,     -2,     -3,      6,     -2,      3,      1,     -4,      3,      3,     -9,      1,     -2,      0,      0,      2,      4,     -6,    -10,     -4,      4,     -8,      7,      4,      4,      8,      5,      2,      1,     20,     15,     -7,     -3,     -1,      7,     -2,     -5,      0,     -3,     -8,     -4,     14,     -4,      5,    -12,     -2,     -4,      2,      1,    -12,     -2,     -1,      7,     -3,     -4,      4,      8,     -2,      3,      0,     -4,      5,      0},
-    {     7,      3,      0,     -7,     -9,      2,      8,      1,      7,      0,      0,      2,     -6,      2,     -9,      2,     -2,      9,     -3,     -3,      6,     -9,    -12,     -5,      5,     -3,      2,      4,      9,    -11,     -3,      0,      9,      8,      1,      2,     -4,      3,      0,      0,     -1,     -4,     -5,     -2,      0,      0,      4,      0,     -4,     -1,     -2,      1,      4,      0,      2,      6,     -9,      7,     10,      4,     -5,      7,     11,     -5,      5,     -1,      3,     -2,      6,     -7,      9,      2,      0,      4,      3,    -22,      1,     -7,      2,     10,      0,     -3,      4,     -4,      3,      6,     -3,      3,     -2,      9,      3,      4,      0,     -3,      1,     -5,     -1,     -2,      0,      8,      1,    -13,      3,     -7,    -10,      7,     -3,     -6,     -9,    -17,      3,      2,     -4,      3,     -6,     -1,      7,      0,      2,     16,     -3,      6,     -3,      4,     -2,      1,      5,     -2},
-    {     0,     -4,      1,      3,     14,      6,      6,     -9,     -2,     -7,      4,      2,      3,      3,     -9,      1,     -1,     -8,      6,     -1,     -2,      3,     -3,     -4,     15,     -6,     -5,      5,     -3,     -4,      2,    -16,     -5,     -2,     -1,      4,      2,      5,     -1,     -2,      4,     10,     -9,     -3,      2,     -8,      0,      0,     -3,     -3,      0,     -3,     -2,      4,      9,     11,      3,      7,      6,      4,      4,      2,      5,     -5,     -5,     -1,      3,      3,     -1,      1,     -1,      7,      1,     -4,     -4,     -2,     -3,     -1,     -2,      1,      1,     -4,     13,      4,     12,      3,     -3,      4,      4,      2,     -1,     12,      2,      5,     11,     -1,     -5,    -10,     -2,     13,      7,     -7,     13,     -4,     -2,     -3,     -3,      3,     10,      0,      6,     -4,      1,      6,     -1,     10,     -7,      2,     -1,      0,      0,      0,      8,     -5,      7,     -3,     -4,     -1},
-    {     6,      0,     12,      0,      8,      5,      0,      0,     -2,     -8,      5,      3,      1,      0,      7,      1,     -2,     -8,      6,     -5,     -8,     -6,     -1,     -5,      4,     -4,      0,     -1,     -4,      2,      9,    -10,      7,     -2,     -1,     15,     -9,     -5,      0,     -8,     -3,     12,     -2,      6,      2,     -7,      4,      0,      6,      4,     -7,     -6,      6,      4,      4,      1,    -10,      7,      0,     -3,     -6,     -2,      5,     -2,      2,      3,     -6,      0,      6,    -10,      4,      7,      6,     -2,      4,    -15,     -3,     -5,     -1,     -5,     -1,    -11,      0,     -8,      4,      4,     -3,      4,      5,      3,     -6,      5,     -3,      3,     14,     -2,      0,      4,     -6,      7,      2,     -7,      3,     -7,     -5,      4,     -6,      7,      4,      0,     -1,     -3,     -6,     -8,     -4,     -3,    -11,     -2,     -1,     -1,     -2,     -9,      3,     -4,      5,     -7,     -2,      4},
-    {     7,      3,      1,      2,      1,     -1,      5,      2,    -10,      0,      1,      2,      9,      2,      0,     13,     -2,     -6,     -2,      3,     -1,      1,     -6,      0,      4,     -1,     -2,     -4,      4,      1,     -6,      0,      4,      9,     -1,      1,      2,     -6,      0,     -4,     -1,      0,     -8,      0,      7,      3,      1,      2,      8,     -4,      1,     -1,      5,      0,     -2,      1,      1,      8,      8,     -1,      9,      5,     -2,      1,      7,     -1,     -6,      2,      0,      0,      2,      1,      6,      8,      1,     -3,      2,     -4,      0,     -5,     -7,    -11,     -3,    -14,      4,      3,     -2,      8,     10,      4,     -3,      2,     -2,      0,     11,      4,     -3,      0,     -5,     -4,      3,     -1,      8,      1,     -5,     -3,      0,    -10,     -2,    -16,      0,     -6,      6,     -3,      2,      0,     -1,     -6,     -1,      0,     -6,    -10,     -3,      6,      1,      4,     -2,      0},
-    {     9,      1,     -3,     -2,      2,      3,      7,      1,     -1,      0,      5,     -2,      3,      3,      5,      2,      6,      4,      6,     -2,      1,     -5,    -11,      1,      6,      2,     -8,      8,     -1,      7,      7,      3,      3,     -4,     -6,      2,      6,     -5,     -2,     -1,     -2,     -6,     -5,      0,      6,     -2,     -4,     -1,     -1,      6,      3,      1,      6,     -1,      3,      3,      2,      7,      1,      9,      0,     -1,      0,      1,      5,      0,      1,      2,      2,     -1,      9,     -3,      1,     -1,      3,     -4,      3,     -7,      4,     -2,      2,      2,     -4,     -7,      8,      3,     -3,      1,      1,     -6,     -1,     -3,     -1,      4,     -6,      0,      3,     -1,      0,      3,      0,      4,     -5,     -3,      4,     -8,     -5,     -4,     -7,      0,      2,      5,      0,      0,      4,      7,      2,      3,      0,      7,     -1,      3,     -2,      6,      5,      0,     -1,     -1},
-    {   -10,     -3,     12,      0,      0,      4,     13,     -2,     -6,     10,     -5,      5,      2,      4,     -4,      1,      0,      9,      4,     -3,     -5,     -1,     -4,      7,     -1,      4,     -3,     -5,     -3,     -5,      0,    -14,     -2,      0,     -2,      4,     13,     -2,      3,     -1,      2,     -7,     -8,      5,      3,      7,     -2,      4,      0,     -5,      3,     -1,     -5,     -2,      6,      5,      7,      1,      6,     10,     -7,      1,     10,     -9,      7,     -5,    -10,     -7,      7,     -5,      5,      0,     -1,      9,      5,     20,      0,     -7,      0,     -2,     10,     -3,     -8,      9,      7,     13,     -6,      5,      0,     -2,      1,      9,     -2,      3,     -5,     -1,     -7,      5,      4,      2,     -6,     15,      4,    -11,      6,    -10,    -11,    -11,     -4,     -8,      1,      5,      5,      2,     -7,     19,    -11,      8,     -3,     -3,      4,      0,     -2,     14,      2,     -3,     13,      0},
-    {     2,      1,      7,     -1,     -9,      5,      4,     -1,     -3,     -4,      3,     10,      1,      5,     -1,     -5,      1,     -2,      6,     -9,      0,     -8,    -11,     -6,      2,     -4,     -8,      1,      6,     -4,      6,    -13,     -5,      2,      7,      7,    -13,     10,     -4,     -3,     -2,      7,     -5,     -2,     -5,      6,     -9,     -3,    -10,      3,     -2,      1,     -1,     -5,      0,      9,     -2,      2,      5,      2,     -9,      7,      7,     -4,     -1,      0,     -4,     -1,     -5,    -10,      5,      7,      3,      6,      1,     -8,     -2,     -5,     -4,     -5,      0,    -10,     -3,     -6,      8,     -2,     -1,      1,      0,     13,      1,     -3,      2,      5,      1,      7,      6,      2,      0,      1,      3,      8,      6,      0,     -5,     -1,    -15,    -15,     12,     -4,     -4,     -6,      3,     -2,     -2,      2,    -18,     -2,     -2,     -1,     -4,     -3,      2,      1,      4,      1,     -2,     -3},
-    {    -7,     -3,     -6,      0,      2,      0,     -4,      1,     -1,      2,     -3,     -3,     -3,      3,     -6,      1,     -5,     -1,     -4,      2,     -6,     -7,      5,     -7,      8,      9,     -3,      7,      3,     -4,      9,      1,      3,      0,      0,      1,     -5,     -3,     -2,    -11,      0,    -11,     -5,     -6,      3,      7,     -4,     -3,     -3,      0,    -15,      2,     -2,      6,     -1,      6,      1,     11,      4,      0,     -4,     -4,      1,     -1,      8,      9,     -2,     -3,      2,     -1,     -3,     -6,      4,      7,     -1,     12,      1,      1,     -6,     -6,     -8,     -3,     -2,     -3,     -5,      8,     -3,      3,      3,     -1,     -2,     -1,     -7,      3,      2,      6,     -1,      6,      7,     -3,      1,      3,      3,      1,     -2,     -7,     -1,     -7,    -16,      5,      9,      3,     -2,      1,     -4,     -4,      3,      0,      1,      5,      4,     -2,      4,      2,     -4,     -4,      5,      0},
-    {    -3,     -3,      3,     -1,      0,     -7,     -7,     -3,     -8,      6,      1,     -6,     10,     -1,     -6,     -1,     -3,      4,      0,     -2,     -3,     -1,      2,      1,     12,     -3,     -1,      3,     12,     -6,      0,      0,      9,      5,      8,     -1,    -10,      0,      0,     -1,      5,     -4,     -2,      5,      7,     -5,      0,     -4,      3,      2,     -1,      2,     -1,     -3,     16,      3,      0,      6,      5,     -3,     -4,     -3,     -2,     -2,      9,     -2,     -5,     -1,      6,     -2,      0,      1,      1,     -5,      4,      1,     -3,      0,      1,      5,      5,     -1,     -1,     -4,      2,     -9,     -3,      7,      0,     -3,      8,      6,     -1,      0,     -3,      0,     -3,     -7,     10,     -5,     -2,     -2,     10,    -13,      5,      0,     -3,     -5,     -3,      0,      1,     -1,      5,     -1,      1,      0,     -1,     -1,      1,     11,      1,     -4,      3,    -11,     -4,      3,     -2,      0},
-    {    11,     -4,     12,     -1,      6,      0,     -3,      3,      0,     -7,      5,    -13,      3,     -3,     -1,      0,     -7,     -1,     -3,      0,    -14,    -11,    -15,      7,     -1,      0,      8,     -6,      2,      0,      3,     -4,      1,     -8,      9,      1,      0,     -4,     -5,      0,     -5,     11,     -1,     -6,      2,      7,     -5,      3,     10,      1,      9,     10,     -6,     -2,      7,      6,      3,     -3,      8,      7,      0,     -1,      2,     -3,      6,      9,     -2,     -9,     -5,     -1,      5,      8,      4,     -2,     -2,     -5,     -2,     -3,     -4,      3,      7,      1,     -1,    -12,      1,     10,     -5,     -2,     10,     -1,     -4,      0,      4,      3,      5,      1,      8,    -11,     13,      3,      6,     -1,     -4,     -2,      5,     -1,      2,     -4,      5,      8,      1,      8,      6,      1,      1,     14,     -1,      2,      4,      3,      0,     -3,     -2,     -1,     -1,      5,     -1,     -2},
-    {     1,      3,     -2,      1,      6,      7,     -1,      3,     -6,     -2,      2,     -2,      9,      0,    -11,      0,     -2,      5,     -3,      3,     -4,     -2,    -18,      7,     -1,     11,      2,     -6,      6,      4,      6,     -7,     -2,      3,     -1,      6,     14,      1,      3,     -8,    -12,      5,      8,     -7,     -9,      3,     -1,     -6,     -3,      6,      8,     -1,      1,      6,     -3,     -3,      1,     -1,     -8,      8,      6,      6,     -5,      0,      6,      3,     -2,     -4,     -2,      2,      3,      7,     -2,      1,      2,    -13,      0,      1,      2,     -5,      1,     -2,      4,     -6,      3,      0,     -5,      8,     10,      3,      5,      4,      3,      0,      8,      2,      4,      0,     -2,     -3,      1,      6,      8,     -1,     -1,     -3,    -10,    -10,      2,      2,      4,     14,     -7,     -1,     -1,      6,      6,      6,      0,      9,     16,    -11,      6,      1,     -5,      7,      3,      1},
-    {     6,      2,     -4,     -3,     -4,    -13,     -8,     -3,     -4,     -2,      1,     -3,      6,      2,     -7,      0,      1,      0,     -3,      8,      4,      1,     -3,    -15,      5,      5,      0,      4,      2,      2,      6,      0,     -2,      4,     -6,      5,     -5,     -8,     -8,     -3,      3,      1,      3,      1,      6,     -1,     -1,      5,      0,     -1,     -3,      5,      1,      7,      4,      0,     -9,      5,      2,      2,     -9,     -5,      3,     -1,      8,      4,     -4,      1,      2,     -4,     -3,      1,      4,      2,      2,      8,     -1,     -4,      2,     -1,     -6,     -5,      1,     -5,     -6,      7,     -3,     -1,      6,     -1,      0,      1,     -2,      4,     -4,      2,      5,      4,      1,     -2,     -6,      1,     -2,      0,      7,     -6,      9,     -2,      4,     -9,      4,      0,      8,     -3,      2,      0,      2,     -4,     -1,      0,      0,     -7,      1,      3,     -1,      5,     -1,     -7},
-    {     3,     -3,      1,     -1,      6,     -7,      3,     -2,     -3,      0,      0,     -2,      1,      0,     -6,     -5,      0,      6,      0,      1,      0,    -11,     -7,     -9,      3,     -1,     -7,      2,      9,     -2,      3,     -4,      5,      2,      0,      2,      1,     -3,     -9,      3,     -3,     -3,     -3,      3,     -1,      1,     -2,      4,      1,      1,      5,     -3,      8,      4,     11,      6,      5,      2,      0,     -8,     -5,      2,      6,     -1,      3,     -2,     -1,      2,     -1,      3,     -8,      3,      6,      5,     -2,     -5,      4,     -4,     -2,      5,      7,      2,      6,     -9,     -3,      0,     -2,     -3,      0,      0,      1,      3,      3,      2,      1,     -1,      5,     -2,      5,     -4,      5,     -9,      2,     -3,     -1,     -2,     -6,      2,      7,      1,      1,      2,      2,     -1,     -9,     -2,      0,     -1,     -1,      7,     -6,      0,      7,      2,     -7,      3,     -2,      3},
-    {    -3,      1,      5,     -5,     11,     -1,     -3,     -2,      7,     -7,      4,     -1,      2,      1,      1,      0,     -1,      5,     13,    -12,      1,    -11,    -12,      4,      6,     -7,     -3,     -2,     -5,     -9,    -10,     -2,     -4,     -2,     15,      5,      2,    -13,      1,     -4,      3,      3,      0,     -4,     10,     -2,      7,     18,      2,     -4,     -4,     -1,      2,     -1,      7,     -2,     -1,      5,      7,     -5,     -6,      0,     -7,     -2,     -3,      0,     -1,      1,      8,    -11,     13,      2,      3,     -1,      1,      5,      7,      3,     10,      1,      3,    -11,      1,     -3,      3,      7,     -4,     -1,      5,      3,     -2,     -7,      0,      1,     -3,     10,      1,     -7,     -5,      1,      7,    -10,      0,      0,     -6,     -3,     -7,     -3,     -8,     -2,     12,      0,      2,      5,      4,     11,      1,     -4,     -3,      0,      8,     -6,      1,      9,    -11,      1,      6,     -1},
-    {    -1,      3,      7,     -7,      7,     -2,     -6,      7,      0,      5,      4,      6,     16,      4,     -2,      0,      1,      5,     10,    -14,     -6,    -13,      2,    -11,      3,     -3,      3,      0,     10,    -11,     -3,      0,      4,     -1,     -6,     -3,      0,     -9,     -3,     -1,     -1,     -6,     -2,      6,      6,     -6,      5,      0,     -6,     -6,     -6,     -1,     -4,      4,     10,      2,     -1,      5,      3,     -7,      3,      3,      2,     -6,     11,     -5,      4,     -6,      6,    -13,     13,      4,      3,      1,     -5,     -6,     -6,     -1,    -10,     -4,      0,    -11,      1,    -13,      8,      6,     -7,      7,      0,      8,     -5,      2,      3,      1,     -1,     11,     -4,    -11,      0,      2,      1,      3,      6,      2,     -5,     -2,     -4,     -1,      1,     -7,      1,      1,      2,     -3,      2,      6,     -2,      7,      8,      4,     -4,     -4,     -1,     10,     -2,     -2,      6,      6},
-    {    -2,      5,      5,      9,      6,      0,      8,     -4,      6,      0,      3,      3,     -9,      1,    -12,      7,      1,      1,     -3,      2,     -8,     -8,    -17,      3,      3,     -3,     -4,      7,      3,     -2,      4,     -5,      8,     -1,     12,     10,    -13,      0,      0,     -6,      1,     12,      0,     -3,     -5,      1,      3,     -2,      4,      2,      0,     10,     -8,      0,      7,      6,     -8,     -4,     12,      0,     -7,      4,      3,     -7,      4,      1,      1,      2,     14,     -6,      4,      5,     -3,     -1,     -6,     -5,     -1,     -2,      9,      8,      9,      1,     -7,     -2,      3,      7,     -6,     -1,      3,      4,     15,      2,     -1,      2,     -9,      7,      2,     -1,      4,      0,      7,      7,      5,     -5,      2,     -7,      3,      3,     15,    -12,      0,     -8,     -2,      6,      3,      1,     -5,     -2,      0,     -4,     12,      4,      4,      6,      3,     -8,     -3,     -2},
-    {     2,      3,     -6,     -5,     -9,     -3,      6,     -1,     -2,      4,      5,      3,      3,      8,      7,     -7,     -3,     -3,      2,     -3,     -5,     -1,      2,     -3,     -1,     -7,     -3,      3,     -2,      3,     -3,    -10,     -7,     11,     10,     10,     -3,      6,     -3,     -8,    -10,     -2,     -2,      3,     10,      4,      9,     -6,     12,     20,      1,      8,     -3,     -4,     11,      0,    -16,     -1,     -3,      2,     -5,      3,      9,      1,      5,      1,    -11,      2,      5,     -7,      7,      5,      4,     -1,     -4,     -5,      3,     -5,      9,     -2,     -5,     -6,     -4,    -10,      6,     -7,     -5,     -1,      5,      5,    -13,     -2,      5,      1,      0,      1,     -2,     -2,      5,     -5,     -4,    -16,      1,     -9,      7,    -15,     -4,    -12,     -1,    -10,      3,     -4,     -3,      2,     -4,     -3,     -9,      7,      1,     -9,     11,     -4,      9,      8,      5,      1,     -3,     -3},
-    {     8,      3,      4,      1,      1,      0,      6,     -1,      2,     -7,      4,     -2,      3,      3,      3,     -6,     -7,     -2,     -8,     -8,      6,     -4,    -14,      2,      4,      5,     -2,     21,      1,     -2,      0,    -13,      2,      1,      7,      0,     -1,     -2,     -1,     -4,     -3,     -3,     -8,     -6,      5,      2,     -5,     -2,      4,     -1,      1,      8,     -5,      3,      9,      7,     -9,      7,      8,      3,     -6,     -8,     -4,     -3,     -1,     -6,      2,     -8,      9,     -4,      4,      0,     -7,      8,     16,     -9,     -5,    -10,     -2,     -9,      0,     -4,     -4,     -7,      7,      0,      5,      4,      0,     -2,      5,      3,     -5,      5,      2,      4,      3,      0,      3,     -5,      7,     -7,      2,      3,      1,     -6,     -6,      7,      0,      0,      1,      0,      7,      6,     -5,      8,     -5,      1,      1,      1,      0,     -4,     -2,     -6,      0,     -4,     -4,      0},
-    {    -4,      2,      8,      1,      7,      2,     15,      4,      4,      9,      4,      5,      5,      4,     -8,      4,     -3,      6,     10,      1,      0,      2,     14,      4,     -1,     10,      2,     -3,     -2,     -6,      0,      9,      5,      7,      1,      0,    -14,     -8,      1,      0,     -1,     -2,     -3,      7,      3,     -1,      6,     -1,      4,      7,     10,      5,     -2,      2,      8,     13,      3,      3,      2,      9,     -2,      3,     -3,      2,     -3,      1,     -5,     -1,      5,     -4,      6,     -6,      1,      6,      0,      1,     -2,      2,      7,      1,     -2,     -5,     -4,     -2,      6,      3,      4,      4,     -3,     -9,     -3,      8,      0,      3,      7,     -2,      6,      7,      4,      5,      6,     -1,      5,     -3,      1,     -7,     -1,      2,     11,      5,     -5,      6,      2,     -1,     -1,      2,     -8,     -4,      4,     10,      8,     -4,      2,      3,     -8,     -2,     -1,      0},
-    {    -3,      0,      2,      2,     -7,      2,      1,     -3,      2,      1,      0,      1,      3,     -2,     -2,     -4,      0,    -10,      1,      0,     -3,     -5,    -25,     -1,     -1,      4,     -3,      9,     10,     -2,     -5,     -2,      7,      2,     -6,     -2,     -3,     -9,     -5,     -7,     -4,      5,      4,     -1,     -1,      3,      1,     -3,     -6,     -4,      2,      4,      4,      6,      1,      5,    -14,      9,     -7,      0,     -7,      1,      8,     -2,      6,      4,      2,      1,     -1,      3,      8,      0,      5,     -2,     -1,     -3,      4,    -11,     -6,     -4,      0,      1,      0,     -4,      2,      3,     -7,      1,      3,     -3,      1,      5,      6,      4,     -3,     -2,      4,     -3,     -5,      0,      7,    -11,     -3,     -2,     -3,      0,      0,     -9,     -1,    -14,     -3,      8,      2,     -4,     10,      4,     -5,      2,      2,      0,     -6,     -8,     -2,     -1,      3,      7,      0,      0},
-    {     3,      1,      7,     -2,      0,     -3,     -3,      2,      2,      2,     -4,     -7,     -7,      4,      4,     -1,     -3,      2,      9,     -1,      3,     -2,    -10,    -11,     -1,      0,     -4,     13,      9,      1,     -6,    -13,      7,      4,      1,      0,      8,     -7,     -4,     -4,      2,      4,      2,     -7,     -6,     -5,      2,      2,      3,      4,     -4,      7,      1,      6,     -2,     -1,      0,      0,     -2,     -5,      1,     -1,      5,     -2,      0,      6,      0,     -2,      2,      0,     -1,      1,     -4,      3,      6,      9,      4,     -6,     -1,     -6,      2,      2,      0,     -7,     -6,      9,     -3,      2,      7,      3,     -1,      0,      3,      7,     -6,     -2,      7,     -4,      9,      5,     -1,     -1,     -4,     -1,     -4,      1,     -2,      2,      3,    -16,      1,     -5,     -1,      1,     -7,     -1,     -2,      0,     -8,      5,     -2,      1,      3,    -10,      1,     -5,      1,      0},
-    {    -7,     -2,     -2,      2,      0,      3,      1,     -6,     -6,     -6,      0,     -5,     -6,     -2,    -13,      0,     -2,    -11,     -3,     -5,     -1,    -10,    -16,    -11,      5,     -2,     -6,     -2,     -2,     -3,      6,      9,     -2,      3,     -8,      4,      2,     -3,     -3,     -4,     -1,     -3,     -9,     -5,      3,     -5,      1,     10,      1,      7,     -5,      0,     -5,     -1,     -6,      0,     -8,      3,     -7,      0,    -10,      4,     -2,      1,     -2,     -2,     -3,     -1,      6,      5,     14,     -5,      3,      3,     -6,     -9,      3,     -3,     -5,      2,     -3,    -11,     -5,     -8,      0,      2,     -3,     10,     -7,      0,      7,      0,     -1,      1,     -3,      3,      2,     -3,     -7,      6,     -5,      4,      8,      3,     -3,      2,     -6,     -5,     -3,    -11,      1,      4,      3,     -1,      3,     -8,      2,      2,      1,     -6,      4,    -15,      2,      8,     -2,      1,     -4,     -2},
-    {    -2,      7,      0,      2,      8,      1,      4,      1,     -8,      5,     -3,      2,      3,     -2,     -1,      2,     -3,      0,      5,     -8,      2,    -11,     -8,    -14,      4,     -2,     -1,      2,      1,      2,     -1,     -7,      5,     -6,      1,     -4,     -3,      3,      1,     -7,     -4,      8,     -3,     -2,     13,      1,     -2,     -2,     -2,      4,      4,     -1,      1,      1,     10,      2,     -5,     -8,      1,     -5,    -15,      2,     11,     -3,     -4,     -8,     -4,     -4,      6,    -10,      2,      4,      5,     -2,     -1,      1,     -1,     10,     -2,      8,      1,     -2,      1,    -15,     -3,      5,     -3,     -2,     -3,      1,      3,      4,     -3,      1,      2,      0,      5,      4,      5,     -3,     -2,     -4,      2,     -6,     -5,      3,     -2,      0,      3,     -7,      2,      2,     -7,     -6,     -7,      2,     -8,      2,    -10,      5,      7,     -5,      6,      0,     -3,     -2,     -2,      2},
-    {    -1,      3,      3,      1,      0,      3,      0,     -2,      2,      5,      1,     -1,     -5,      5,     -2,      7,      1,      3,     10,     -8,     -5,      4,     -2,     13,      6,      4,     -9,      3,      4,     -3,      4,     -3,      6,      5,      9,      5,     -6,      2,     -3,      1,     -7,      3,     -2,      2,      1,     -9,      9,     -6,     -4,      3,      7,      2,     -2,      0,      6,      9,      2,     13,      2,     -2,    -15,     -3,      8,     -1,      4,    -10,      2,     -1,      6,      1,     -5,     -2,      9,     -1,     -6,     -1,     -5,      6,     -1,      5,      0,      4,     -2,     -9,      2,      3,     -7,      7,      3,     10,      4,     -3,      0,     13,      3,      7,      0,     -3,      9,     -1,     -3,    -13,      1,     -8,      1,      5,     -9,     -2,     -1,     -9,     -1,      1,      1,     -4,     -8,      5,      0,      4,      1,     12,     -3,     -5,      6,     -1,     -5,      1,      2,      3},
-    {    10,     -5,      4,     -2,      1,     -8,      4,      1,     -3,     -2,      5,     -3,     -1,      3,      2,      2,     -3,      0,     -3,      1,      0,      1,     -2,      1,      2,     -5,     -7,      7,      4,      8,    -15,     -9,      5,      6,      3,      3,      1,     -1,     -1,     -6,    -13,      1,     -7,     -2,      6,     -2,      9,      3,     -5,     -1,      7,      7,      6,      1,      1,     -1,     -6,      3,     -7,     10,     -6,      0,      6,      1,      8,     -4,     -5,      2,     -1,      3,      7,     -2,      1,      7,     -5,     -2,     -7,      2,      5,     -1,      8,    -10,      0,     -6,      5,      0,     -2,     10,      4,     15,      1,      5,      6,      5,      7,      1,     -1,      8,     14,      0,     -4,     -3,      1,      2,      4,     -7,     -5,     -3,     -1,     -4,      9,      7,      0,      2,     -7,      2,    -12,      4,     -5,      8,     -6,      7,      1,     -3,      1,      3,      2,     -5},
-    {     3,      1,      3,      3,      5,      3,     -1,      0,      3,     -1,      4,      6,     -8,     11,     11,      3,    -11,     -5,     -7,      7,      4,      6,     -2,     -7,     -4,     -5,    -10,     10,      5,      9,      1,      2,     -1,      0,      0,      0,     -5,      0,      1,      1,      4,     -1,      0,      4,     -1,     -5,      2,      5,      0,     15,      6,      9,     -3,     -2,      5,      2,      4,      8,      6,      2,      0,     -7,      6,     -3,      9,     -2,      4,     -6,      2,     -5,     12,     -2,     -1,      7,      9,     -3,     -1,      6,      8,      4,      2,     -3,      4,      2,     -7,      3,     -9,      4,      7,     -2,      5,      1,     -1,     -1,     -1,      1,      6,     -1,      5,      5,      6,     -1,      0,    -12,    -14,      0,      7,      2,     12,     -1,      2,     -3,     -1,      0,     -3,      3,      0,      8,      5,      1,      2,      1,      2,     -1,      5,     -3,     -1,      0},
-    {     8,     -4,      1,      1,      3,      3,      1,     -4,     -4,     -3,      4,     -7,      0,     -2,      1,     -4,     -1,     -1,      2,     -2,     -3,      4,    -11,      3,      0,      0,      5,      9,     -3,     -3,      6,     -5,     -2,      0,     -1,      2,     -2,     -2,     -4,     -4,     -5,      1,     -5,    -12,      0,      3,      2,      1,     -6,      6,     -5,      4,      3,     -7,      6,      0,      5,      2,      1,     -2,     -1,     -2,      3,     -2,      4,     -3,     -7,      2,      3,     -1,      8,      6,     -4,     -5,      3,      2,      4,      0,      0,      4,     -1,     -3,      0,     -2,      2,      4,      1,      1,      4,      4,     -4,      5,      2,      6,      3,      1,      7,     -2,      3,      6,      3,     15,     -5,     -8,      1,      2,     -2,     -7,      0,    -12,     -1,      3,      3,      2,     -2,     -6,      2,     -1,     12,     -8,      1,      5,      4,     -4,      7,      5,      0,      1},
-    {     1,     -1,      1,      0,      0,      3,     -3,      5,      3,     -9,      7,      7,      0,     -7,     -1,      2,      0,     -4,      0,     -3,      3,      3,    -11,    -17,      2,     -6,      5,      2,      0,     -2,     -2,    -11,      2,      7,      1,      1,     -8,     -6,     -4,      1,      6,      2,     -4,     -6,     -3,     -4,      4,     -2,     -4,      3,      3,      5,     12,     -3,      3,      5,     -6,      7,     -3,      9,      1,      1,      9,      1,     -6,      3,      1,     -1,     -1,      2,      4,      0,      1,     -6,      5,     -2,      2,     -8,      5,      6,     -7,     -2,     -1,    -12,    -11,     -3,     -5,     -1,      4,      2,      0,     -2,     -3,     -1,     -4,      0,     -1,     -1,      0,      1,     -1,      3,     -2,      6,     -4,     -2,      9,    -10,      2,     -8,      1,     -8,     -3,     -1,     -5,     -6,     -6,     -2,      1,      2,     -7,     -9,     -2,     -4,      2,      1,      0,     -1},
-    {     1,      7,     -6,     -4,      2,     -1,     -7,      2,      4,      0,      7,     -5,     -2,     -3,      5,      4,     -3,      1,      0,     -4,      7,     -2,    -10,     -3,      1,     -6,     -1,      9,     -8,      1,     -7,     -2,      1,     -1,      4,     -2,     -4,     -8,     -4,      3,      5,      1,      1,      3,      4,     -1,     -3,     -1,      2,      8,      0,      0,      9,      0,      0,      3,     -3,     -1,     -5,      3,      4,     -3,      6,      2,      0,      5,     -5,      1,      1,      1,      6,     -2,      2,      2,      0,     -3,      8,     -7,     -1,      3,     -1,      4,     -9,     -9,     -8,      0,      0,     -5,      0,     -3,      1,     -1,      7,     -4,      2,     -1,      1,      0,      0,     -3,      0,     -2,      1,      3,     -6,     -3,      5,     -3,    -11,    -11,      0,      2,      2,      2,      3,      2,      1,      1,      7,     -3,     -3,     -3,      0,     -3,      0,      2,      3,      1},
-    {     1,      0,     -1,     -2,      0,      2,      1,     -1,     -1,     -1,     -3,     -1,      4,      1,      4,     -2,      0,      0,      1,     -2,     -2,     -6,     -5,     -1,     -1,      1,     -1,      0,     -4,      1,      0,     -1,      1,     -2,      0,      0,      0,      0,      0,      5,     -4,      1,      1,     -4,      1,      1,     -9,      0,     -4,      1,     -5,      2,      0,      3,      0,     -3,      0,     -1,     -4,     -3,     -2,      0,     -1,     -1,     -2,     -1,      0,      3,     -1,     -8,      1,      0,      1,     -5,      3,      1,      0,     -5,     -3,      7,     -1,     -7,      3,      0,      1,      0,      1,      1,      3,      1,      2,     -1,     -1,      1,      6,      0,      1,     -2,     -1,      0,      1,      0,     -7,     -1,     -1,      3,     -1,      0,     -6,      3,      0,     -1,      2,      3,     -1,      1,      0,      0,      2,     -2,      0,     -4,      1,      0,     -4,      0,      3,     -1},
-    {    -5,     -2,      0,      0,     -7,     -3,      1,     -1,      0,     -5,      0,     -7,     -6,      1,     -4,      1,      1,      0,      2,    -10,      1,     -3,     -8,     -9,      0,     -1,      1,      3,      1,      0,     -3,     -3,     -4,      1,      1,      1,     -4,     -5,      3,     -2,     -4,      1,     -3,      0,     -1,      1,     -2,      0,     -5,      0,      2,     -1,     -1,     -1,      2,      1,      1,      0,     -8,      2,     -1,      0,     -3,     -3,     -3,     -1,      0,     -4,      0,      3,     -3,      1,      1,     -1,      5,      1,      1,      0,     -1,      2,      0,     -7,     -1,    -16,      0,      0,     -1,      0,      1,     -5,     -1,      0,     -3,     -2,      1,     -1,     -7,     -2,     -3,      1,     -4,     -1,      4,      0,     -1,     -3,      3,     -7,      7,     -2,      1,     -4,      3,     -3,      2,     -6,     -6,      1,     -3,     -1,     -9,     -4,     -1,     -4,     -1,     -1,      2,     -2},
-    {     2,     -7,      0,     -1,     -1,      2,      3,      0,     -1,      0,      1,     -7,      0,     -2,      4,     -2,      1,     -3,     -1,    -10,     -3,     -2,    -11,     -8,     -1,      0,     -1,     -2,     -1,     12,     -9,     -8,     -3,      0,     -1,     -1,     -1,     -7,      1,     -1,     -6,      0,      0,     -1,     -1,      1,      6,      0,      1,     -4,      3,      1,      1,     -2,      1,      3,     -1,      0,      1,     -4,     -3,     -2,      0,     10,      0,     -7,     -3,     -2,      2,      0,      6,      1,      0,     -4,     -3,    -10,     -5,      7,      0,     -5,     -7,     -7,      1,      5,      3,      1,     -1,      0,      4,      3,      4,     -1,     -5,     -2,      4,      0,      0,     -1,     -3,      0,      4,      1,     -4,      1,      3,     -9,     -1,    -11,      3,     -6,      0,     -3,      4,     -2,     -2,     -8,     -5,      0,      4,      5,     -6,      6,      1,      1,      3,      0,      6,      0},
-    {     2,      5,      0,      2,     -4,     -1,     -8,      3,     -3,      5,      9,     -6,      3,      1,     -9,      2,      1,      1,     -4,     -1,      0,      0,    -12,    -10,      0,     -2,     -1,      3,     -4,      1,      0,     -4,     -1,      3,      3,      2,      1,      7,     -3,     -5,     -5,     -3,     -2,     -1,      5,     -5,      4,      4,      2,     -3,      4,     -3,     -1,      3,     11,      2,      3,     -6,     -5,      4,     -7,     -2,     11,      0,      6,      0,      1,     -4,     10,      1,     -1,      1,      1,      7,      2,    -11,     -1,      3,     -2,      1,     -1,     -6,     -2,    -17,      0,      2,      1,      1,      2,      1,      6,     -2,      2,      0,      4,      0,     -1,     -6,      7,     -2,     -4,     -3,      1,     -7,      6,      3,     -2,      2,      1,     -5,      4,      1,      0,      8,     -4,     16,     -3,      1,     -1,      0,      0,      4,      2,    -14,     -3,     -1,     -1,     -5},
-    {    -4,     -3,     -2,      0,    -17,     -1,     -4,     -5,      4,     -1,      3,     -5,      1,      5,      3,     -2,     -1,      9,      4,      2,     -3,      3,     -7,      2,      0,      0,     -3,      8,     -3,      2,     -9,     -2,     -2,     -5,     -3,      0,     -5,    -10,      0,      3,     -6,      1,     -2,      2,      2,      8,     -1,     -5,      4,      2,      0,      1,     -4,     14,      5,     -1,      1,      3,     -2,      1,     -2,      0,      6,     -1,      3,      7,     -3,      0,      8,     -5,      1,      0,      2,     -2,     -1,     -4,     -3,      2,     -5,      5,      5,     -3,      1,     -7,      3,      3,     -1,     -1,      6,     -1,     -6,     -1,      5,      3,      1,      5,     -2,      1,      2,      4,     -7,     -1,      7,     -7,      2,     -4,      6,      0,     -4,    -11,     -1,     -3,     11,      3,     -3,     -4,    -11,     -7,      5,     -1,     -9,     -1,     -1,      2,      2,      3,      3,      0},
-    {    -1,      2,     -3,      3,      6,     -9,      0,      1,     -2,      4,      5,      1,     -4,      3,     -3,     -3,      4,     -1,      6,      7,     -5,     -4,      1,      2,     -2,     -1,     -1,     11,     -5,     -4,      9,      5,      3,      6,      6,     -1,    -11,     -7,     -2,     -4,     -5,     -4,      1,      1,      1,      7,     -7,     -2,     -3,     -4,     -5,      5,      2,      2,     -6,     -1,      8,      2,      2,     -3,     -7,     -2,     -3,      6,     -1,     -2,      2,     -3,      3,     -3,      4,      3,     -1,      2,      8,     10,     -1,    -13,      2,     10,     -2,      0,      0,     -5,     -3,      6,     -1,      5,     -7,     -3,      1,      2,      6,     -5,     -1,      1,      4,      7,      0,     -2,      2,     -9,    -10,     -4,      0,      0,      3,      1,      3,    -12,      0,     -7,     -1,      1,      1,     -2,     -4,      2,      4,     -1,     -8,     -9,      0,      3,     -7,      3,      9,      0},
-    {     2,      4,      0,      3,      4,     -1,     -3,      4,      7,      8,      2,      0,     -1,     -1,     -8,      0,     -3,      6,      0,      2,      3,     -2,    -11,     -5,     -2,      1,      0,     -3,     -4,     -7,     -7,     -4,      2,      1,      2,      0,      0,     -6,     -1,      0,      1,     -2,      1,     -2,      2,      4,      3,      1,     -1,     -1,      0,     -2,      3,     -1,      3,      4,     -9,     10,     -2,      2,     -7,     -5,      4,     -3,      0,      2,     -1,     -1,      0,     -8,      1,      0,      0,     -2,      3,     -6,      3,     -6,      1,      5,      2,     -3,      0,    -10,     -7,      0,     -4,      4,     -3,     -5,      1,      1,      1,      4,      3,      0,     -3,      0,      0,      0,      0,     -5,      0,     -6,     -1,     -4,     -1,     -5,      2,    -11,      1,     -1,      3,      0,     -2,     -4,     -6,     -3,      0,      3,      0,     -8,      3,     -4,      5,     -5,      0,     -2},
-    {     0,      0,      0,      0,      2,      0,      0,      0,     -1,      0,      1,      0,      0,      0,      1,      0,      1,      0,      0,     -1,      0,      0,     -9,      0,      0,      0,      0,      0,     -3,      0,      1,     -1,     -5,     -2,     -1,      0,      0,      0,      1,      0,      0,      0,      0,      0,     -2,      0,      0,      0,      0,      1,      0,      0,      0,      0,      0,     -2,      0,      0,     -1,      1,     -1,      0,      0,      0,      0,      0,     -1,      0,      1,      0,      0,      0,      0,      0,      0,     -3,      0,      0,      0,      0,      1,      1,     -2,     -3,      0,      0,      0,      1,      1,      4,      2,      0,      2,      0,      0,      0,      0,      0,     -3,      0,      0,      0,     -6,     -1,      0,     -4,      1,      0,     -2,     -1,      0,     -3,      0,      0,      0,      0,      0,     -1,      0,      0,      0,      0,      0,      0,      0,      0,      0,     -1},
-    {     0,      0,      0,      0,      0,      1,      0,      0,      0,      0,      0,      1,      0,      0,      0,      1,      0,      0,     -1,      0,      0,      0,     -2,      0,      0,     -1,      0,     -5,      0,      0,      0,      2,     -2,     -1,     -2,     -1,     -1,     -5,      0,      0,      1,      0,     -6,     -3,     -1,      0,     -1,      0,      1,     -1,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      4,     -1,     -1,      0,      0,      0,      1,      0,      0,      0,      0,     -1,     -1,      0,      1,      0,      0,      0,      1,     -2,      0,      0,      1,      0,     -1,      1,     -1,      0,     -2,      0,      0,      0,      0,      0,      0,     -2,     -1,      0,     -1,      0,      0,      0,      0,      0,     -4,      0,     -3,      0,      0,      0,      0,     -1,      0,     -1,      0,     -3,      0,      0,      0,      0,      0,      0,      0,      0,      0},
-    {     1,      0,      0,      0,    -10,     -4,      1,      2,      0,      2,      0,     10,      0,     -2,      4,     -1,      1,      2,      0,     -3,     -4,     -3,     -3,     -6,     -1,      0,      1,     -5,     -2,      3,    -11,      7,     -1,      3,     -2,      0,     -1,     -2,     -3,      1,      5,      0,     -2,      0,      0,     -2,      1,      0,      0,      1,     -6,      2,      4,     -2,      1,      1,     -3,      3,     -6,     -4,     -1,      0,      7,      5,      1,      1,      1,      7,     -3,      0,      4,      0,     -1,      8,      1,     -1,      1,      2,     -1,      2,      6,     -5,     -1,      3,     -1,     -1,      0,      0,      5,      4,     -2,     -1,     -3,      0,      2,      1,      0,      2,      5,      2,     -5,     -1,      2,     -3,     -1,     -3,     -6,      1,     -9,     -9,      0,     -2,     -6,      2,     -5,     -3,      0,      1,     -2,     -4,     -2,      3,     -1,     -3,     -1,     -1,      0,      0},
-    {     0,      1,      0,      0,      0,      0,      0,     -2,      1,      2,      0,      1,      0,     -2,      0,      0,     -1,      1,     -2,     -2,     -2,     -4,     -2,     -8,      0,      0,     -5,      2,     -1,     -1,     -3,      1,      0,      1,      2,      1,      0,     -3,      0,      0,     -7,      0,     -5,      3,     -1,      0,     -1,      0,      0,      0,     -6,      0,      0,     -3,      1,     -1,     -1,      0,      3,      2,     -2,      0,     -2,      0,      0,      0,      0,      0,      0,     -2,      0,      0,      0,      0,     -1,      0,      0,      0,      0,     -1,      0,     -4,      0,     -4,      4,      0,      0,      0,      0,      3,      0,      2,     -2,      0,      1,     -1,      0,     -5,     -4,      1,     -1,      0,      2,     -5,      4,      3,      0,      0,     -1,      0,      0,      0,      0,      0,      0,      2,      0,      0,      0,      0,     -2,      1,     -2,     -3,     -2,      0,      0,      5},
-    {     0,     -9,      0,      3,      0,      0,     -3,      2,      1,     -4,      5,      1,     -4,     -3,      1,      3,     -1,      0,      2,      1,     -4,      0,     -8,      0,     -1,     -8,     -3,     -1,     -6,     -2,     -4,      5,      1,      2,     -6,     -1,     -3,     -9,      2,     -4,     -6,      0,     -6,      0,      0,      2,      0,      0,     -1,     -1,     -3,      0,      0,      0,      4,     -2,     -8,      2,      0,     -3,     -1,      0,      6,      1,      0,     -4,     -3,     -7,      0,     -1,      2,      0,      1,     -4,      3,     -1,      3,     -1,     -5,     -3,      1,      4,      3,      0,      2,      0,      1,      0,      1,      1,     -1,     -2,      0,     -3,      0,     -3,      0,     -1,     -3,      0,     -2,    -12,      0,     -1,     -2,      4,      0,      1,     -8,     -4,      0,      1,     -1,      4,     -2,      4,      2,     -2,     -7,      0,     -5,     -5,      0,      2,     -1,     -7,      0,     -1},
-    {    -1,      0,      0,      3,     -3,     -4,      4,     -6,      4,     -4,     -1,      2,     -5,      1,      3,      1,     -5,     -5,      2,     -1,     -3,      4,     -3,     -3,      0,      1,     -1,      4,     -4,     -1,    -10,      6,     -7,      5,      0,      1,     -4,     -4,      6,      1,      6,     -1,      1,     -5,      1,      2,     -2,      0,      0,      1,      2,     -2,     -5,     -4,      0,      2,    -12,      6,     -6,      2,      1,      3,      9,    -11,     -2,      1,     -1,     -1,      1,      1,      1,      0,      7,     -6,      4,      1,      1,      0,     -2,     11,     -3,     -3,     -4,     -3,      2,      0,     -1,      3,      6,     -8,     -4,      4,      6,      4,      5,     -2,     -2,     -2,     -4,      1,     -3,     -2,      4,     -5,      7,     -1,      3,     -4,      3,     -5,      0,      3,     11,      1,     -1,     -6,     -7,      1,      1,     -5,      1,    -12,      1,     -9,     12,      3,     -2,     -1},
-    {     2,     -6,      0,     -1,     -8,    -11,      1,      3,     -1,      0,     11,      4,     -1,      2,     -1,      4,     -6,     -3,      5,      5,     -4,      4,    -10,    -11,      0,     -6,      6,     -7,      1,     -3,     -2,     -8,     -4,      5,     -8,      0,     -2,     -9,      4,     -5,      2,      5,     -4,    -11,      0,     -1,     -5,      1,      3,      1,    -15,     -1,      1,     -2,      5,      1,    -12,      3,     -9,     -2,      3,     -1,      1,     -3,      5,      1,     -8,      0,      0,      2,      0,      0,     -3,     -5,     -3,     -5,      0,      0,     -2,     -1,     -2,     -3,     -2,     -3,      0,      2,     -4,      0,     -1,     -1,     -4,     -1,      7,      0,      6,     -2,     -1,     -3,      2,      2,     -2,     -4,      0,     -4,      7,     -6,      2,    -12,      8,      1,      0,      0,      3,      5,     -4,     -6,    -11,     -4,      0,     -7,     -2,    -10,      6,     -6,     -3,      0,     -2,      0},
-    {     4,      1,      0,     -3,      0,     -1,      0,      1,     -3,      1,     -2,     -4,     -6,     -4,     -1,     -1,      3,     -2,     -1,      0,     -3,      0,     -9,      5,      0,     -1,      0,      2,     -2,      3,     -2,     -7,      3,      4,      2,      0,      0,      4,     -1,      0,      3,      0,     -5,      1,     -1,      4,     -5,      0,     -2,      0,      0,      4,      4,      0,     -2,     -1,     -1,     -2,     -5,      2,     -1,     -3,     -3,      0,      1,      3,      1,      0,      0,      2,     -1,      0,     -1,      0,     -2,      1,     -1,     -2,      3,     -3,      0,     -1,      0,      4,     -1,      0,      0,      0,     -2,      3,      2,      1,      2,     -1,      6,      0,      0,      1,     -1,      0,      5,      1,     -2,      2,      2,      2,     -3,     -2,     -1,     -2,     -1,      0,     -4,     -1,     -1,     -5,     -5,      1,      1,      1,      2,     -5,      3,     -2,      4,      3,     -1,      0},
-    {    -1,      1,     -2,      0,      0,     -2,      0,      0,      0,     -1,      1,      0,     -2,      0,      1,      0,      0,      1,      0,      0,      0,      4,     -6,    -12,      0,      0,     -1,     -2,      0,      0,     -4,     -2,      7,      0,      0,     -1,      0,     -1,      0,      2,      0,     -1,     -2,     -3,      0,      0,     -3,     -1,      0,      0,     -3,      0,      0,      0,     -1,     -1,      0,      0,     -4,      0,      0,      0,      0,     -1,      0,     -1,      3,      1,      0,      1,      0,      0,      0,      0,      0,      0,      0,     -1,      0,      1,      0,      0,      0,     -2,      0,      0,      0,      0,      0,      1,      0,     -2,      0,      0,      0,      0,     -1,      0,      1,      1,      0,     -1,     -5,      1,      0,      0,     -1,     -1,      0,    -14,      0,      0,      0,      0,      1,     -8,      0,      0,      0,      0,     -5,     -2,      1,     -1,      1,      0,      0,      0},
-    {    -2,      2,     -1,      0,      2,      1,      0,     -4,      1,      0,     -2,     -3,      0,      1,      3,      2,      5,      3,      1,      1,     -6,     -3,    -12,     -7,      0,     -1,     -6,      1,      2,      3,     -8,     -7,      0,     -3,      5,     -1,      0,      3,      4,      1,     -3,     -2,     -5,     -3,      0,      3,      0,     -1,      0,      1,      1,      0,      0,     -4,     -1,      2,     -1,      1,     10,      4,      0,      0,      4,     -1,      0,     -1,      4,      5,     -4,      2,     -3,      0,      1,      0,      1,      0,     -5,      1,      3,      4,     -4,     -9,      3,      3,      1,     -1,     -3,      0,     -4,      2,      2,      0,     -2,     -1,      2,      0,      0,     -2,     -7,      0,      2,     -4,      3,     -3,      0,     -1,      1,      4,     -2,     -4,      0,     -1,      2,      1,     -7,     -2,      0,     -1,      5,      4,     -1,      0,      2,      2,      0,      0,      1,      0},
-    {     0,      0,     -1,      1,      1,      0,      0,      1,      1,      0,      2,     -1,     -1,     -1,      0,      0,      0,      0,      1,      0,      0,      0,      0,      1,      3,      0,     -1,      0,     -1,      0,      0,      0,      0,      0,     -1,     -2,      0,      1,      0,      0,      0,      0,      0,      1,      0,      0,      1,      0,      0,      0,     -1,      0,      0,      0,      0,     -1,      0,      0,      0,      0,      1,      0,      0,     -1,      0,      0,      0,     -5,      0,      0,     -1,      0,      0,     -1,      0,      0,      0,     -1,      0,     -2,      0,      0,      0,      0,      0,      0,      0,      0,     -1,      0,     -1,      1,     -1,      0,      0,      0,     -1,     -2,      0,      0,      0,      0,      1,      0,      5,      3,      2,      0,      0,      2,      0,      0,      0,      0,      0,      0,     -5,      1,      0,      0,      3,      0,      0,      0,      0,      0,      0,      0},
-    {     0,      0,      6,      0,      0,      0,     -1,     -2,      0,      0,      0,      0,      0,      0,      0,      0,      2,      0,      1,      2,      1,     -1,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      1,      0,      1,     -2,      0,      0,      1,      1,      3,      0,      0,      0,      0,     -1,      0,      0,     -1,      0,      0,      0,     -2,     -1,      0,      5,     -1,      0,      0,      0,      0,     -1,      0,      0,      0,      1,      0,      1,      0,     -1,      0,      0,      1,      1,      0,      1,      1,      0,      1,      0,      0,      0,     -2,      1,     -3,      1,      1,      0,      0,      0,      0,      0,      0,      1,      0,      0,      0,      0,      0,      8,      0,     -1,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      0,      1,      0,      0,      0,      6},
-    {     0,     -5,      0,      2,     -1,     -3,      1,      3,      3,     -1,      1,      4,      0,     -2,     -2,      5,      2,      2,      0,      0,      7,     -1,      2,     -1,      0,     -3,      0,      0,      0,      0,     -4,     -3,     -1,      2,      2,      0,     -1,     -1,     -2,      1,      4,      0,     -4,      1,      0,     -1,      2,      0,      0,     -1,      3,     -1,      2,      3,     10,      3,    -10,      6,     -4,      5,      2,     -2,      2,      1,      3,      0,      3,      1,     -1,     -1,     -4,      0,      4,     -3,      0,     -1,      1,     -1,     -7,      7,      5,      1,     -1,     -4,     -2,      0,      0,      0,      5,      4,      0,      2,      2,      3,     -4,     -2,      0,      0,     -5,      0,      0,     -2,      2,      1,     -4,     -1,      4,      0,      2,     -8,      0,      0,     -1,      2,     -3,     -2,     -2,     -2,      5,      4,     -2,     -4,      2,     -4,      6,     -2,      1,      1},
-    {     4,      3,     -4,      1,      0,      1,     -9,     -1,      1,      0,      0,     -1,     -1,      3,      2,      0,     -2,      6,      2,      0,     -6,     -2,     -8,     -8,      0,     -2,      1,      8,      0,      2,     -3,      1,     -1,      0,      6,     -1,      0,      1,      2,     -1,     -1,      0,     -5,      3,      0,      6,     -1,      0,      4,     -3,      1,     -2,     11,      2,      0,      0,     -2,     -4,     -8,     -1,      3,      0,      6,     -2,     -1,      0,      1,     -4,     -1,     -6,     -1,      0,      6,     -2,      2,      1,     -3,     -1,      2,     -3,      0,     -2,      0,     -1,     -5,      0,      2,      0,     -1,     -1,     -1,      0,      6,      2,      2,      1,      0,     -2,      4,     -1,      1,     -4,      1,     -7,      0,      1,     -1,      2,      0,      2,     -1,      0,      1,      2,      0,     -4,      4,      0,      3,     -1,      2,     -1,      0,     -6,     -2,      2,      1,      0},
-    {    -1,      3,      0,      1,     -6,      2,     -3,      1,      3,      0,     -1,      1,     -3,     -1,      3,     -3,      0,      2,      0,     -8,     -5,     -1,      1,      2,      0,      0,     -3,      0,      0,      2,      2,     -1,     -2,      2,     -3,      0,      0,     -2,     -2,      1,     -1,     -1,     -4,      4,      0,     -1,      3,      0,      4,      0,      0,      1,     -6,     -1,      2,      0,      5,      0,      1,      3,      0,      0,      4,      0,     -1,     -3,     -1,     -4,      1,     -4,      0,      0,      1,      2,      2,    -13,      1,      4,      0,     -7,      0,     -4,      1,      4,      5,      0,      0,      0,     -2,      4,      0,      1,      4,      0,      1,     -4,      0,     -3,     -2,      0,      1,      4,     -1,      3,     -1,      0,     -1,      1,     -2,      4,      0,      0,      0,      1,      4,      2,      6,      0,     -1,      0,      1,      1,      0,      4,     -3,      0,      3,      1},
-    {     1,     -1,     -2,      1,      0,      4,     -1,      0,     -2,     -3,      4,      3,      1,      0,     -1,      4,     -3,     -2,      0,      1,     -6,      4,      2,     -1,     -3,      2,      0,      0,     -2,      0,     -3,      0,     -5,      2,     -4,      0,      0,      8,      0,      2,     -2,      0,     -2,     -1,      0,      5,      7,     -1,     12,      0,      1,      9,     -1,     -1,     -1,     -1,     -5,      1,     -3,      0,      1,      0,      1,      1,      0,      0,     -4,     -4,      0,     -2,     -1,      1,     -1,      0,     -3,      3,      2,      2,     -4,     -7,     -1,     -1,      0,      3,     -2,      0,      0,      0,     -1,      0,      9,      1,     -6,      2,      2,     -3,      0,     -2,     -1,      0,      2,      1,     -2,      1,      4,     -1,     -1,     -3,     -4,      4,      0,     -1,      0,      4,     -5,     -3,      2,     -1,     -3,     -1,      3,      1,      1,      0,      0,      2,     -3,      0},
-    {     1,     -3,      8,     -6,      7,      0,      2,      0,      5,     -7,      8,     -4,     15,      1,      0,      3,     -1,      3,      7,     -7,      2,      0,      5,     13,     14,      0,      0,     -2,      3,      2,      3,     -2,      3,      1,      9,      9,      9,     13,     -7,     -4,     -3,      1,     -3,      7,      5,     -2,      3,      6,     13,      7,      4,     11,     -9,      1,      5,      1,      0,      2,     -1,     11,     -6,      8,      3,     -5,      5,     -2,     -1,     -8,      7,     -8,     10,      3,      7,     -4,      9,     -8,     -5,      8,     -6,      5,    -10,      0,     -1,      4,      7,      8,      6,     12,     -1,     -3,      0,      1,     -8,      3,      5,     -1,     13,     -3,      5,     -1,      2,     19,     12,     -9,      1,      7,      8,      5,     -7,     12,     -4,     10,     19,      9,      6,     13,      9,     15,      5,      7,      6,    -14,      7,     10,     -3,      5,     -1,     -8},
-    {     5,    -11,      4,      2,     11,      6,      0,     -3,      6,      0,      0,      7,     -3,      0,      0,      5,      1,      8,      2,      5,      3,     -2,     -1,     15,      5,      1,      2,      6,      3,      0,     -1,     10,      7,     -1,      5,     -2,      2,      6,      2,     -1,      0,      7,     -6,      5,      4,     15,      9,      4,     -9,     12,      1,      2,      5,      2,      7,      0,     -7,      1,      4,     -4,     -1,     -2,      6,      5,      8,     -4,     -4,     -2,     -3,      2,      2,     -5,      3,      3,      3,     -3,     -1,      9,      4,      6,      6,     -3,     -9,     -5,      4,     -4,      2,      4,      2,      2,      2,      3,      0,     13,      1,      2,      5,      4,      1,      2,     -1,     -2,     10,     -3,     -7,      1,      2,      9,    -12,      5,      4,      3,      2,      4,     -1,     15,      2,      4,      1,     10,      7,     -6,     -1,     24,     -1,      0,      2,     -1},
-    {     1,      1,     -2,     -3,      8,      7,      1,      1,      7,      4,      4,      9,     -1,     -1,     -7,      2,      3,     17,     -1,      0,      4,     -9,      8,     14,     -6,      5,     -2,      1,      4,      5,     10,      9,      1,      1,     -4,      2,      0,    -11,     -2,      2,      5,      2,     -9,     -5,      5,     13,      6,      3,      1,     10,     -5,      3,     -1,      5,      2,      4,     -3,      5,      4,      0,      2,     -4,     -1,      3,      2,     -2,     -7,     -5,      6,     -4,      8,      6,     10,      8,      3,     13,      8,     12,      5,     10,      2,      2,     -1,      3,      3,     -1,      0,      1,      2,     -7,     -2,      1,     -6,     -4,      3,      7,     11,     -4,      4,     -2,      8,     12,     -7,     -5,      5,     -9,      4,      7,     -1,     10,      4,      7,      3,     -4,     -2,     14,     11,     -2,      6,      8,      7,     -1,      3,      9,      2,     -7,     -2,      1},
-    {   -10,      3,      7,      1,     11,      8,     -9,    -14,     -1,     -5,      5,      1,      4,      3,     -6,     -2,      0,     12,      7,      1,      4,     -3,     15,     12,     -9,     -1,     11,     -1,     -3,      2,      5,     21,      1,     -2,     -2,      2,     11,      8,     -3,     -5,     -4,     -9,     -9,     -8,      5,      3,     -7,     -2,     10,     -1,     -2,      1,    -12,     -4,      1,      2,     -1,      4,      9,     -3,    -11,     -6,      8,     -7,      3,     -1,     -4,      3,      9,     -2,     -2,      0,      9,      0,     -2,     14,     -4,      5,      4,     11,      3,    -12,     -5,     -1,     -5,      4,     -5,      3,      1,      0,      9,     -4,     -1,      6,     -5,      4,      5,     -7,      6,      5,     -4,      9,      2,    -12,      5,      3,     -6,    -10,     -4,     11,      6,      3,     13,      5,      1,      6,     11,      7,      3,     11,      1,     -8,      2,      9,    -12,     -2,      2,      6},
-    {     7,     -2,     -1,      3,      9,      6,     -4,     -5,      1,     -8,     -1,      1,      0,      6,     -8,      2,     -1,      7,     -4,    -10,     -6,     -5,     14,      1,      4,     -1,      0,      0,      3,     13,     10,      4,     11,     -4,      4,      0,     -4,      7,    -11,     -9,     -3,     -1,     -7,      1,     -3,      7,     -2,      2,     -5,      2,     -4,     -4,     -8,     -1,      9,      8,     -5,     10,      6,     -8,     -6,    -16,      2,     -3,     -3,     -9,      1,     -8,      3,     -7,     15,     -3,      2,      3,     -3,      7,     -1,      0,      5,      0,     -4,     -5,     -3,     -3,     -7,      4,     -6,      1,      8,     -7,      3,     -3,     -3,     15,     -7,      3,      2,     -1,     -3,      7,     -5,     23,      1,     -8,      4,     -2,      3,      3,      0,     11,     -4,      4,     -1,      5,      2,      9,     10,     -3,     -4,      4,      2,     -7,      3,     -4,      3,      0,      8,     -2},
-    {   -10,      6,     14,      0,     14,     -2,      1,      4,     -1,      0,      0,      3,      8,      8,     -3,      3,     -4,      4,     -7,      0,     -8,      2,     19,      3,     -1,      1,    -11,      3,     -8,     -7,      1,      4,     -1,      6,     -6,      2,      6,      1,      0,     -6,      0,      1,      4,      1,      1,      1,      3,      5,      4,      2,    -10,     -5,      3,      5,      4,     -2,      7,      4,      5,     -2,     -2,     -1,      4,     -1,     -4,     -1,      4,      2,      7,     -1,     11,     -4,     -3,     -1,     -2,      8,      3,     -1,     -2,      1,      4,     -9,     -5,     -5,      1,      2,      6,     -1,      4,     -6,     -6,      1,      2,      3,    -11,      3,      3,      4,     -6,      2,     -3,     39,     -7,    -14,      9,      3,     -5,      1,     -4,      6,      7,      2,      6,      6,      1,     -6,     12,     -8,      1,      9,     10,      9,     -2,     11,     -4,     -7,    -10,     -2},
-    {     2,      7,     -1,      7,      6,     13,     -4,     -3,     -2,     15,      5,     10,     -7,      0,    -13,      2,     -3,      2,      0,      0,    -12,     -9,     10,      4,     -1,     -1,     -7,      3,     -2,     -2,      4,     22,    -13,      0,      1,      0,     -1,    -14,     -7,     -9,      2,      4,      7,     -5,     16,     10,     -4,     10,    -13,     12,      2,      2,     -9,      2,      5,     12,     10,     12,      3,     -4,     -4,      7,      3,     -4,      4,      1,     -9,      0,     -1,     -5,     15,     -1,     11,     -4,      0,     21,     -1,      4,    -16,      0,      1,      3,      0,    -10,     20,      1,     -4,     -1,      8,     -2,      5,     11,      0,      6,      1,      0,     12,      4,      9,     -2,     -2,      2,     -2,      5,     -7,      1,      7,      9,      1,     12,     10,     16,     16,    -11,     -4,      4,      4,      6,      0,      0,     11,     -9,      8,     26,     -1,      3,      6,     -1},
-    {     2,      3,      3,      9,     -2,     -4,     -3,     -3,      2,      6,     16,     -1,      2,     -1,    -10,      2,      0,     -2,      1,     -7,     -2,    -12,     -3,     14,     -1,      3,     -7,     12,      6,      3,      9,     27,     -4,     -3,      3,      4,      7,     14,     -6,     -7,     -1,      3,      6,      0,      1,      9,      1,      0,     -5,      6,      7,      6,     -8,      0,     -7,      4,     -2,      4,     -1,     -3,      2,      0,      0,     10,      1,     -4,    -10,      0,      2,     -3,     12,      4,      1,     -5,      1,      4,      5,      6,      2,     -3,      3,     -3,     -2,      1,     -2,      8,      0,     -2,      4,     -6,      4,      6,      1,      6,    -11,      4,      5,      0,      1,      2,     -1,     10,    -11,     -4,      1,      2,     -5,     12,      6,      4,     -3,      6,      3,     -3,      1,      6,      2,      5,      3,      4,      8,     -2,      0,     20,     -8,      9,     -4,     -5},
-    {    -2,      2,     15,      1,     -4,     12,     -4,      0,     -4,     -1,      5,      2,     -5,     -6,     -5,     -6,     -1,      0,      1,      4,      1,    -16,      2,     -2,      0,      2,     -5,      6,      6,     -5,     11,     15,      2,      9,     -1,      9,     14,    -18,     -4,     -1,     -6,     11,     -9,     -7,      0,     -6,     -1,     11,     17,      1,     -4,     -6,      2,      3,      2,     11,    -10,     10,      7,     -3,    -11,     10,      2,     -3,      0,      0,     -7,     -7,      4,     -9,     14,     -2,      5,     -5,     -2,     24,      2,     -7,     -3,      4,     -8,      1,     -7,     -9,     -3,     12,    -11,      3,     -1,     -1,     10,      2,      1,     -5,     12,     11,      1,     -2,     -2,     17,     -1,      0,     -3,     -4,      9,      3,      1,      6,    -21,    -16,      2,     -4,     12,     -4,      2,      5,     13,     -2,     -5,      7,      2,     -4,      5,      5,      2,      7,     13,     -6},
-    {     0,      6,     -4,      0,     10,      3,     14,      1,      5,     -9,      6,      3,      2,     -7,     -5,     -4,     -5,      2,      2,     -4,      1,     -7,     -7,     11,      1,      1,    -11,      3,      4,     -3,      4,     11,    -10,      2,      2,      0,      9,     -6,      3,    -16,    -13,      3,      2,     -9,     -4,      7,      4,     12,      3,      6,      3,      3,     -5,      0,     -3,     -1,     -4,      1,     10,     -4,     -5,      3,      6,      3,      7,     -4,      2,    -11,      3,     -2,     13,     -2,      2,     -3,      0,     12,     -2,      4,     11,      6,      7,    -11,     -2,     16,      3,     -7,     -8,      0,      1,      5,      0,     -1,      8,      3,     -5,      3,      8,     -1,      0,      7,      3,     21,      1,     -4,     -7,      9,      2,      1,      5,     -2,      8,      5,      8,     -5,     -5,      5,      2,     -1,      0,      2,      5,      5,    -10,     18,    -11,      4,      8,      0},
-    {    -8,      8,     17,      2,     14,     18,      4,      5,      5,    -19,     -1,     -5,      5,     -3,     -3,      3,      6,     13,      3,    -10,     -9,     -8,     -4,     18,     -1,      0,      7,     -4,     -2,      4,      0,     10,      1,      5,     10,     -6,     13,     -2,     -9,     -1,      0,      8,     -4,      1,     -6,     14,      4,     11,    -12,      9,     -7,     -6,      2,    -19,     -4,     -4,      1,     19,      6,     -9,     -3,      4,      0,      4,     -7,      3,     -5,     -5,     10,      1,      1,      8,      4,      0,     -9,     11,      4,      2,      1,    -12,      9,     -9,      0,      7,      6,      8,     -4,      6,      3,     -8,      6,      8,    -17,     -7,     -8,      7,     12,      5,      0,      7,      8,     10,     -6,     -8,      0,     -7,     -7,      4,     -5,      1,     -1,      0,     17,     -2,     14,     14,     17,     -7,     -9,     11,      1,    -14,     -5,     38,     -5,     -9,     -1,      7},
-    {    -5,      5,      7,      6,      0,     -8,      0,    -15,      7,      3,      1,      2,     -2,     -2,     -4,     -4,     -6,     11,      0,      3,     -9,     -6,      7,     14,     -1,     -9,     -6,      2,      6,     -8,     11,     27,      2,     -7,      7,     -3,     10,      2,     -3,     -2,      0,     -2,     -8,     -6,      0,     24,      3,      0,     -3,      5,      5,    -13,     -4,     -6,      0,    -10,     -8,     10,      2,    -10,     -8,      5,      7,     -7,      0,     -9,    -10,    -10,     -4,     -1,      9,      4,      1,     11,      1,      7,      3,     -7,     -6,      5,     -3,      5,     -3,      1,      1,      1,     -9,     12,      1,      0,      7,      1,      6,      3,    -10,      5,     -4,      8,      3,     -3,     -7,     30,      4,     -2,      1,      5,    -13,      4,      6,      4,     -3,      4,      7,     -4,      6,      4,      1,     10,      4,     13,      0,    -14,      1,     23,     -8,     -5,      5,      3},
-    {     4,     -1,     -2,      1,     12,     12,      2,     -1,     -4,     -3,      4,      6,      3,     -5,     -7,     -4,      0,     10,      3,     -7,     -5,     -6,     20,     19,      0,      2,      0,      1,     -1,     -8,     17,     24,      1,      0,      5,      6,     15,     -8,      0,     -6,     -6,      6,     -2,      2,      7,      2,      4,      5,     -5,     -1,     -4,     -3,    -10,     -7,      9,      7,      5,      2,      2,     -2,     -5,      1,      3,    -12,      1,     -1,     -3,      2,     16,      1,     -6,     -2,     11,      8,     -4,     14,      0,     15,     11,     -3,      2,    -14,     -8,      8,      7,     10,     -6,      2,      7,     -4,     -1,     -3,      1,      8,      1,      8,     16,      5,      8,      4,     -1,     18,      2,     -2,      5,      3,     -1,      9,      8,     16,     -2,     13,      9,      0,     12,      7,     14,      6,      4,      6,     -2,    -10,     -2,     20,     -3,     12,      3,      9},
-    {   -10,      4,      6,      3,     16,      6,      1,      2,     -3,      8,     -2,    -17,     -1,      5,     -5,     -6,      5,     17,    -10,     -3,     -9,    -10,    -15,      5,      1,      9,     -1,      1,     -2,      4,      4,     18,     10,      3,      2,     -6,      3,      2,     -5,     -7,    -11,      1,      3,     -5,     -2,     14,     -1,      7,     -1,     18,     -4,      4,     -2,     -1,      7,     -2,      2,      0,      5,     -2,     -2,     -1,     11,      0,     -2,      5,     -1,     -6,     14,     -3,      7,      5,     11,      6,     -6,     -7,     -1,     14,     13,      2,     -7,      1,     -9,     11,     17,      9,      2,      8,      3,    -10,     -4,     -5,      2,     15,     10,      5,      7,      3,      2,     -6,     -4,     18,     -3,    -12,      1,     -1,      0,      6,      8,    -12,      3,      2,     10,      4,      3,      1,     14,     -2,      3,      0,      0,      3,      9,     14,     -9,      9,      2,     15},
-    {   -11,     13,      4,      4,     10,     -5,      9,     -2,     -8,      8,      7,     -1,     13,      4,    -10,      1,     -4,      4,     -9,     -1,     -9,     -6,     -8,      5,      5,      3,      2,     14,     13,      8,     -5,     29,     -6,      3,      4,     -5,     10,     -4,     -6,      5,      5,     -2,      0,     10,     -3,      3,     10,     15,    -14,     12,      3,     -3,      2,     -1,     12,      3,     11,     -5,     -2,      1,     -3,      7,      7,     -9,      5,      5,      8,     -5,      5,     -3,      5,     -1,      6,     -2,     -2,     13,     -3,     15,     12,      8,     10,     -6,     -2,      0,      6,      9,      3,     -1,      3,     -2,      0,      7,      6,      4,      0,      3,     10,     -1,     -2,      7,    -13,     15,     -7,     -9,      2,      4,     -6,     20,      1,     -7,     -5,     -1,      6,     -5,      0,      0,     19,     -4,      1,     -2,      6,      6,      3,     20,      3,     -2,      0,      1},
-    {   -10,      2,     11,     -6,      6,      3,      5,      5,      7,      2,     11,      2,     11,      1,    -23,      3,      0,      9,      7,      7,     -5,     -4,     -2,     -7,      1,     -6,     -5,      3,      7,      6,      5,     26,      5,      6,     -7,      3,      7,     25,     -2,    -12,     -1,     -1,     -1,      2,      5,     -2,      2,      8,     15,     12,      2,     -2,     -5,      0,     -4,      3,     17,      0,      3,     -4,     -3,     -4,    -10,     -1,      2,     -5,     -7,     -2,     16,      2,     -5,     11,     -4,      7,     -3,      4,     12,      0,     -4,      0,     10,     -6,     -4,      9,      4,     11,     -2,      0,     -2,      0,      1,     -4,     -1,    -11,    -15,     12,     16,     -5,      3,      6,      1,     12,      9,    -10,     -3,     -4,     -5,     20,     -4,      4,      3,      4,     25,     -2,      3,      7,      7,      7,      8,      6,      0,     -6,     10,     35,      0,     -5,     10,     -6},
-    {    -1,     13,      5,      6,      9,      3,      2,     -1,     -1,      3,      1,      3,      5,      7,     -3,      5,     11,      5,      2,     -7,     -4,     -8,     -8,      1,      0,      9,    -10,      8,      4,      9,      4,      5,      8,      5,      9,     -2,      6,      1,      7,     -5,     -1,      2,     -9,      1,      0,      5,     -8,      0,      3,      5,      6,     -1,      0,     -5,      3,      1,     -5,      1,      1,      9,     -8,     -5,     -3,     -8,      0,     -7,      0,     -6,      4,     -7,      9,      3,      5,     10,      0,     10,     -5,      5,      0,     12,     -1,     -1,      0,      5,     -1,     -5,     -3,      2,      7,      5,     11,     -3,      0,      3,     -1,      3,      3,      3,      7,     -1,     -5,      4,      5,    -20,     -8,     -1,    -10,     -2,      4,      1,      2,      5,      0,      8,      4,     -3,     10,     -3,      6,     10,     12,     -1,     -4,     16,     -6,      3,     -7,      1},
-    {    -1,     -2,      1,      3,      6,      5,      1,     -2,     -2,     -3,      3,     -7,     -1,     -3,      1,      4,     -1,      9,      1,      0,      4,    -12,     -5,      7,      3,      3,     -1,      1,      3,      0,     -1,     10,      3,      6,      7,      8,     12,      5,    -14,    -11,     -4,      5,     -1,     -2,     -5,     11,      1,     14,      0,     11,      2,      0,     -5,      9,      1,      0,    -12,      9,     -3,     -2,      6,      0,     -7,     -6,      7,    -16,     -2,     -5,     12,      4,      3,     10,     -3,      6,     -4,     13,     -3,      8,    -10,      8,      6,    -12,     -9,    -10,      2,      9,      3,      7,      4,    -13,      2,      4,     -2,      1,     -3,      6,      7,      0,     -6,     -1,     -1,      8,     -2,     -7,     -2,     -4,    -10,      8,      1,     -1,     -7,     14,     -1,      0,     11,     -6,      9,      6,      9,      4,     -1,    -12,      0,     11,     -4,      1,     -3,      5},
-    {    -9,      5,      2,      1,     -1,     15,      9,     -1,      1,     -8,      0,      0,      1,      0,    -10,     -6,      0,      4,     -2,      1,    -10,    -10,     -2,     -3,      5,    -11,    -13,     -5,     -5,      3,      7,     18,     -5,      3,      5,      0,      8,      6,     -3,    -14,    -13,     -3,     -1,      0,     -1,     16,      3,     13,      3,      5,     -4,     -2,     -2,     -6,     12,      3,      2,      5,     -1,     -1,     -5,      7,      3,     -3,      5,      8,      5,     -3,     16,      6,      8,      2,      2,     -2,      2,     18,      3,      9,      5,      8,     17,     -7,     -6,      8,      4,      5,      2,      0,     10,      1,      8,    -11,     -5,      0,     -6,     10,      5,     -3,      6,      1,      2,     10,      7,     -7,     -5,     -5,     -6,      4,      0,     -4,     -5,      1,      1,     -6,     -2,      5,      2,     10,      8,      3,     11,     -2,      2,     23,     -8,     -1,      5,      4},
-    {    -6,     -1,     -6,     -1,      9,      6,      1,     -4,      0,     -5,     -3,      3,      6,      5,     -7,      9,     -4,     10,     -8,     -8,     -8,     -4,      3,      4,      6,     10,     -3,     -7,     -2,      4,     -5,      7,    -10,      8,      4,      9,     20,     -3,      4,    -10,     -7,      9,     -5,     11,     -2,      7,     -5,     10,     -2,      8,      8,     -5,     -8,      3,     -1,     -6,     12,      5,      5,     -3,     -5,      4,      5,     -1,    -10,     -5,     -1,     -8,      2,     -5,      9,      5,      0,     11,      3,     27,      2,      4,      9,      2,      7,     -5,      6,    -10,      8,      3,     -2,      3,      0,     -4,      4,      0,     -6,      0,     -3,      5,     20,     -6,     -4,     -9,      5,     30,      0,      1,      5,      8,     -5,     -9,      8,      1,      3,      6,     10,     -5,      5,     -3,     14,      3,      2,     -1,     10,     -5,     -1,     20,     -1,      0,      1,      8},
-    {    -6,      0,     10,     -5,     19,      5,     -1,      2,      3,     -6,      4,     -2,     -1,     -1,     -8,      6,     -7,     15,      0,     -3,      4,     -7,     -8,     11,     12,      0,      1,     -6,      4,     11,      2,     15,     -6,      2,      4,     -3,     17,      4,      5,      3,     -4,      5,     -4,     -3,      2,     25,      3,     14,    -11,      3,     -3,      6,      2,      3,      7,     -3,      2,      7,      7,     -4,     -8,      7,     -1,     -6,      5,    -10,     -6,     -7,     10,    -11,     -2,     -2,     -2,      4,    -14,     24,     -6,     -2,     -1,     -4,      6,    -10,    -11,      4,      4,      3,     -1,      6,      7,      0,     -4,     -2,      0,     11,     -9,     10,     13,      3,      4,     -2,     -8,     24,      1,    -22,      1,      0,    -12,      3,     -9,     -5,      0,     -1,     17,     -2,     -1,      7,     13,     -8,      6,      8,     12,     -5,      1,     45,      0,      3,      1,     -2},
-    {    -2,     -5,     14,      0,     11,      4,      1,    -11,      0,     11,     -6,     -6,      6,      2,     -9,     -3,     -8,     13,     10,     -3,     -6,     -1,    -10,     17,      4,      6,     -2,      0,      4,      5,      4,      7,    -10,     11,      3,     -4,     -1,      6,     -5,    -15,    -11,     11,     -5,     -4,     10,     17,     -1,      5,      3,      3,     -1,     -5,      0,      6,      5,      3,      5,      3,     -8,      0,      1,      3,      3,    -11,      0,     -9,     -8,    -11,      1,     -5,     -1,     -7,     13,      3,      2,     19,      6,      1,      7,     10,     -9,    -11,     -5,      0,      4,      7,     -4,      2,      3,     -7,      2,      4,      3,     -2,      4,      7,      3,      1,     -1,      3,    -14,     20,      0,    -10,      8,     -2,      6,     12,      0,      7,    -13,      5,     16,     -3,     15,      1,     21,     18,      2,      4,      7,     -6,     -6,     30,     -3,      9,      9,      1},
-    {    -6,     -3,     13,      4,     14,     15,     -3,     -8,     -4,     -7,      2,      9,     -3,      2,    -10,     -7,      6,     16,     -3,     -8,    -12,     -1,      1,     17,      2,      5,    -12,      6,     -2,      6,     -4,     19,     -2,     -1,     -9,      4,     14,     15,     -7,    -20,    -10,     -5,     -2,     -6,      5,     -7,     -2,     17,     -6,     11,     -8,      0,      9,      4,    -12,      7,      3,      1,      1,     -4,     -1,     -5,     -3,     -8,      8,      1,      3,     -2,      4,     -1,      1,      5,      1,     -5,     11,     19,      9,      6,      3,      6,     -2,     -8,     -2,      6,     19,      8,     -4,      7,      4,      4,     -4,      0,      5,    -12,      5,      5,      9,      5,      1,      5,     -1,     19,      5,    -15,    -14,      8,     -8,     23,      0,      7,      0,      0,     23,      5,      8,     21,      8,     -6,      4,     -1,     11,     -4,      9,     23,     -1,      0,     -2,     -4},
-    {    -2,      1,      7,      5,     10,      7,      0,     -4,     -2,      3,      4,      5,     -5,      3,    -16,      0,     -7,     18,     -1,     -5,     -6,      1,     -5,      9,     -1,     -1,    -11,      4,      7,      2,      1,     12,     -5,     14,      2,      3,      8,      4,     -5,    -12,     -1,      4,      0,      6,     -3,     -1,      5,      0,      0,      2,      4,     10,     -4,     -1,      6,     -4,     12,      9,      9,     -3,      3,      0,     -2,      1,     -2,    -12,      3,     -5,      3,      2,     20,     -1,      0,     -4,      2,      9,      5,      3,      6,     -1,      2,      2,     -6,      2,     21,      4,     -9,     -3,      0,     -7,      4,      8,      0,      3,     -8,     10,      3,      2,     11,      0,     -2,     17,      5,    -13,      0,     -1,     -5,      8,      0,     -6,     -3,      0,      8,     10,      3,     15,     15,      9,      1,     15,      7,      2,      6,      7,      0,      9,      2,      0},
-    {    -7,     -5,      8,      7,      6,      9,      2,     -4,      2,      5,      7,     -5,     -6,      2,      0,      1,      8,      7,     -2,      2,     -4,     -2,      6,      5,      2,      4,      1,      3,      4,      7,      9,     13,      0,      8,      3,      4,      0,      4,      4,      0,     -1,      7,      2,      1,      5,      1,      8,     -3,      5,      5,      4,      4,     -2,      6,     11,      6,     -2,      5,     -2,      5,     -5,      3,      0,     -6,     -6,      3,     -7,     -2,      0,     -6,      6,      1,      1,     15,      4,     10,      4,      3,      2,      8,      3,      7,     -8,     -9,      2,      3,     -4,      0,      9,     -3,     -2,      0,      3,     -5,     13,      3,     -5,      2,      6,     -4,      3,      3,      2,    -13,     -5,     -1,     -6,      0,      8,      2,      1,     -1,      2,      6,      0,     -4,     14,     -1,      5,      8,     11,      7,      3,     -8,    -14,      3,      2,      0},
-    {     5,      1,      7,      5,      1,     -2,      7,     -5,    -10,     -8,      7,      5,     -1,      0,    -12,      4,      0,      6,      8,      2,     -7,    -10,     20,      8,     -1,     -1,     -6,     -8,      5,      7,      6,     10,     -4,     -6,      3,      3,      1,     12,      1,     -4,     -2,      2,      0,      1,      8,     15,     -4,      3,      8,      2,      0,      9,     -2,     -1,     12,      5,      7,      8,     -8,      3,      8,      1,     -5,      0,      5,      3,     -8,     -9,      6,     -4,      3,      1,      2,      7,     -2,     27,     -4,     16,      5,      7,      3,      2,     -3,     14,      9,      0,      4,     -1,      1,     -7,      5,      1,      3,      6,      0,      7,     17,      0,      2,      7,     -2,     19,     10,     -5,      5,      1,     -6,     10,      9,     13,      8,      8,      2,     -2,      3,      1,     -1,      0,      3,      7,     -7,      1,     17,     14,      0,      3,      5,      0},
-    {    -4,      7,     -1,      2,      5,      4,      3,      1,      4,      0,      4,     -1,      5,      9,     -3,     -2,      1,     20,      1,     -6,     -4,     -1,     16,     24,      4,      3,    -10,      4,      5,      6,     19,     12,     -4,     -5,     -6,      1,     15,     10,      1,     -9,     -8,      1,      0,      6,      6,      6,      3,      4,     13,      9,      6,      7,     -3,      5,      2,    -11,     -2,      7,      9,      6,     -6,      4,      0,      0,      7,     -3,      2,      1,     15,     -5,     -8,      1,      0,      6,      3,     27,     -2,      2,      3,      1,      1,     -8,      3,     29,      5,      6,     -1,     13,      4,     -3,     11,      2,      4,     -4,      9,      6,     -1,     -4,      6,      0,      7,     11,     -4,     -7,     19,     -5,      4,      1,     -1,      6,      3,     -3,      0,     -5,     11,      0,      2,      2,      2,      4,      9,     10,      2,     17,     -8,      2,     -3,      1},
-    {    -3,      9,      0,      1,      1,      9,      6,    -13,      4,     -6,     -4,     -2,      3,     -6,     -8,     -4,     -1,      5,      2,     -2,    -10,    -10,    -16,     12,      2,      5,     -2,      9,      5,      9,     -9,     10,     -5,     10,      0,      1,      7,      9,     -5,     -6,     -2,      8,     -8,     -7,     12,      2,      9,      4,     -9,      6,     -7,      2,     -4,      3,      3,      0,      3,      7,      7,     -6,     -2,      4,      0,     -1,     -2,      8,      2,     -1,      3,    -11,     15,     -3,      0,      9,      6,     23,      1,      8,     -6,      2,     11,     -6,     -7,     -7,      8,      8,     -5,      3,      8,      1,     -3,      0,     -4,     -1,      2,     -7,      5,      1,      3,      5,     -7,      9,      2,      1,      9,     -1,      8,      4,      3,     -6,     -1,      5,     26,     -3,      7,     -3,      0,     -7,     -6,      1,      3,    -10,     12,     23,     -2,      2,     -2,    -10},
-    {    -3,      2,     -1,      4,     15,      6,      6,     -2,     -2,     -6,      4,     -2,     -5,     12,    -15,     -2,     -2,     10,     -8,     -2,     -8,     -5,    -10,      9,     -5,      1,     -8,      7,     -4,      5,    -10,    -15,     -1,      5,      9,      0,      9,      0,      1,     -7,      2,     12,      2,      2,     -1,     14,     10,     11,      0,      3,     -5,     -6,     -6,     -1,      6,    -12,     -6,      6,     24,     -2,      1,     -4,      1,     -2,     -6,    -10,    -14,     -4,      4,     -6,     -6,     10,     18,     -6,     -4,     20,     -3,      7,     -3,      1,      2,     -4,     -2,     11,      2,      3,    -10,     -4,     11,     -5,      3,      2,    -10,     -6,      3,    -10,      4,      3,     -2,     -2,      5,      9,     -3,      0,     22,     -3,      4,     -6,      4,      2,     -4,      7,     15,      2,     10,      5,     -6,      4,     -3,      5,      5,      6,      2,     25,     -5,     -2,      9,      1},
-    {    -1,     -2,      4,      1,      0,      4,     -5,     -4,     -2,    -10,     -4,      2,      8,      0,     -8,    -11,     -4,     13,      4,     -5,    -14,    -10,     20,     10,      0,      0,     -8,      1,     11,     -5,     21,     24,      4,      5,      3,      5,     15,     14,      3,     -9,     -6,     -3,     -2,      2,      3,      5,      0,     10,      7,      4,     -7,      1,     -5,      2,      8,     -7,      9,     11,      6,     -8,     -6,      0,      6,      0,     10,     -8,     -4,     -7,     18,     -6,      1,      6,      1,     -4,      2,     29,     -2,      7,      9,      6,     -2,    -11,    -13,     -2,      5,      5,     -8,      6,      6,      4,      5,      2,      5,      4,      8,      5,     16,     -1,      1,      6,      5,      8,     -1,      4,      4,     -1,     -6,      6,     -2,      3,      7,     11,     13,     -2,      5,      7,     12,     -2,     -2,     -2,      7,      2,      0,     24,      8,      8,      6,      0},
-    {    -4,     -5,      0,      6,     20,      5,     -3,      3,     -5,      3,      4,      5,     11,      5,     -8,     -2,     -4,     18,      3,      2,      4,      2,     -2,      3,     -3,     -3,     -8,      1,      3,      7,      1,     18,     -6,      8,      4,      7,      8,      1,    -15,     -4,      0,      2,      7,     -2,      0,      2,     -1,     -3,      2,     10,     -9,     -1,      1,     -5,      2,      6,     24,      3,     14,     -9,     12,      4,      6,      3,      3,      0,      3,     -3,      8,      6,     10,      7,      2,      3,      4,     14,      1,     16,      2,      2,      6,      1,     -5,     -4,      9,      4,      1,      1,      4,     -1,      4,     -4,     -5,      0,     13,      3,      7,      1,      6,      6,    -13,     37,     -1,     -7,     -1,     -3,      6,     10,     11,     15,     -4,     -1,     14,      0,      5,      6,     -9,     -5,     19,     -5,      6,      2,      3,     35,      6,      2,      1,     -2},
-    {    -7,     -3,      0,      5,      6,     -8,     -6,      1,      0,      6,      6,     -2,      5,      9,    -19,     11,      4,     15,    -10,      6,     -6,     -8,     12,      9,     -6,     13,     -5,      0,      2,      0,      8,      4,    -17,     -1,     11,      8,     10,     14,     -4,      3,     -2,     -5,     -7,      0,      7,      3,     -3,      5,     -4,     13,      6,      0,    -12,      3,      4,      3,     13,      1,     15,     -3,     -2,      6,      0,     -2,     14,      3,      2,     -2,     -2,      1,      4,      2,      4,     13,     -5,      7,      1,      2,     -1,      6,      4,      4,     -6,     11,     -4,      4,     -3,      8,      0,     -3,     -4,    -10,      5,      2,     -4,     -4,     10,      1,     -4,     -1,     -8,     -2,      3,     -6,      7,      0,      3,     15,     12,      8,     -9,      0,      2,     -2,     -5,     18,     16,      1,      3,      5,     21,     22,     -5,     11,     -8,      0,      5,     -6},
-    {    -1,      6,      1,     -2,      8,      6,     -3,      1,      1,     -1,      6,     -1,      3,      8,    -11,      2,     -5,      1,      0,      3,     -4,      1,      8,     17,     -1,      1,      1,      2,      0,      8,     16,     14,     -2,      1,     -1,      1,      5,     -2,     -5,      4,     -1,      7,     -1,      2,      5,      0,      7,      4,      2,      4,     -4,      0,     -3,     -5,      7,      3,     -2,      5,      3,      1,     -5,     -3,      1,     -3,      8,      4,     -6,     -2,     -2,     -5,      1,     -2,      0,      6,      5,      6,      2,      6,     -3,      1,     -1,     -8,     -1,      8,      8,      1,     -3,      2,     11,     -3,     -1,     -4,      0,      4,     -1,     11,      7,      5,     -2,     -7,     -2,     19,      2,     -7,     -5,      5,     -7,      0,     -3,      5,     -1,      0,     10,      4,      7,      3,      9,      0,      4,      5,      7,      9,     -4,     14,      1,      1,      0,     -1},
-    {    -3,     -2,      0,      0,      0,     10,     -1,     -3,     -1,     -1,     -3,     -8,     -2,     -2,     -9,     -4,      0,      1,     -2,      1,     -4,     -1,      0,      7,     -2,      0,      1,      0,     -2,      1,      4,     -2,     -9,      0,      1,      7,      0,      2,     -1,     -6,     -2,      1,      1,     -2,     -3,      5,     -3,      0,     -4,      0,      1,     -4,     -3,      1,     -3,      1,      2,     -1,      2,     -1,     -3,     -2,     -4,      0,      2,     -3,      0,     -3,      0,     -2,     -1,      0,      1,      0,     -2,     16,     -1,     -1,     -4,      0,     -4,     -2,     -4,      4,      2,      0,      0,     -1,      0,     -6,     -2,     -6,     -3,      0,     -1,     -1,      0,     -3,      3,      0,      4,      9,     -6,     -4,     -1,      4,     -1,      1,     -2,      6,      0,      5,     -5,     -2,      2,      0,      3,      0,      0,     -1,      0,      1,      0,      4,     -5,      1,     -1,      0},
-    {    -6,      5,      5,      0,      7,      9,      2,     -4,      3,      0,      1,     -5,      5,     -1,     -6,     -6,      1,      5,     -2,     -3,      1,     -5,     12,      1,      0,      4,     -8,     -4,     14,      3,     10,      6,    -14,      6,      8,     -1,      7,     -1,      1,     -2,     -9,      1,      1,     -2,     -3,      2,      0,      0,      7,     -1,     -3,     -1,     -3,      2,      1,      2,      3,      2,      8,      3,     -5,      0,     -3,     -2,     -2,    -10,      1,      0,      6,      0,     -2,      2,      5,      2,    -10,     18,     -3,      1,      1,     -6,     -1,      0,     -9,     11,     15,      9,     -1,     10,      0,     -6,      6,     -3,     -3,      7,      4,     -1,      4,     -7,     12,     -1,      4,     15,     -4,      1,      6,      3,     -6,      7,      1,      8,     -5,      5,      2,     -5,      8,      7,      4,      5,     -2,     -3,      1,      3,      3,      5,     -5,      0,      5,      6},
-    {    -1,      9,      1,     -4,      6,      8,     -4,     -4,      2,      4,      0,    -14,     11,      2,     -7,     -3,      0,      9,     -1,      4,      4,     -4,      4,     12,      6,      5,      1,     -5,      5,      6,      7,      8,    -12,     -3,     -7,     -1,      7,     -7,     -1,     -3,     -4,     -2,     -9,      5,      1,      2,      2,      6,     10,     -3,      2,      0,      0,     11,     -3,      3,      4,      7,      4,      0,     -2,     -1,      0,      0,      0,     -6,     -7,     -4,     12,     -9,      8,      2,     -5,      2,      4,     14,     -4,     -2,     -1,     -2,     -3,     -3,     -5,      7,     10,      2,     -5,      5,      0,      0,     -5,      8,      3,     -2,      1,     -4,     12,      6,      5,     -9,      3,     24,     -5,      0,      5,     -2,      2,      0,     15,      5,      2,      4,     13,      0,     -7,     16,      1,     -5,      1,     -6,      9,      5,     -1,      4,     -3,      0,     -3,      4},
-    {    -1,      1,      1,      2,      5,     -2,     -1,     -5,     -3,      3,      6,     -2,      5,      7,      0,     -7,     -4,     -6,     -5,     -5,     -1,      0,     13,     20,     -2,      5,     -7,      6,      4,     13,      2,     16,      1,     -9,     -8,      3,      4,      3,     -9,     -2,     -9,      4,     -2,      8,      2,     -2,      5,      4,     -9,      9,     -4,     -1,      1,      3,      2,     -4,      6,      2,     -2,     -8,      6,     -9,      9,     -4,      3,      1,     -7,    -14,     12,      4,      7,      2,     10,      3,     -2,     17,      0,      1,     -4,     -6,      1,     -6,     -8,     -4,      5,     -4,     -9,      3,      8,    -10,      8,     -4,     -4,     -5,      5,      7,     -2,     -2,     13,     -2,      2,     13,      3,     -9,     -3,     -1,     -1,      0,      1,      5,     -2,      7,      5,      7,      1,      3,      5,     -8,     -5,      2,     16,      2,      6,     23,    -12,      3,     -2,     -1},
-    {    -5,     -1,     -3,      6,     19,      9,      1,      1,     -2,     -1,     -1,     -1,     -2,      8,    -16,      3,      1,      0,      1,      3,      1,     -5,     31,     19,      1,      4,     -2,     -5,      7,      8,      5,     23,      0,     -3,     14,      1,     15,     -3,     -9,     -7,      1,     -4,     -3,      5,      4,     13,     11,      1,     -6,      2,    -17,      1,     -4,    -10,     -2,     -4,      9,     -1,      8,     -6,     -2,     -7,      2,      1,     13,      0,     -1,     -6,     11,     -3,      6,     -1,      9,      4,      6,     22,     -5,     12,      0,      7,      2,      2,     -4,      1,     15,      4,      1,      0,     -1,     -4,     -1,     -6,      6,     -2,      7,      5,      1,      3,      6,      1,     10,     26,     -3,      2,     -4,      9,     -6,     13,      3,     -2,      0,      3,     19,      4,      6,      3,      0,     -4,      5,     11,     23,     -6,      2,     23,    -12,     -3,     -8,      5},
-    {    -7,     11,      2,      3,      1,      3,     -3,     -6,      3,      1,     -6,     -7,     -1,      3,    -11,     -2,      5,      7,      0,     -1,     -6,     -5,      8,     10,      0,      2,     -9,     -1,      8,     -6,      5,     14,     -3,     -1,      6,      1,      7,     -7,     -2,     -4,     -5,      7,     -5,     -4,     -1,     11,      5,      7,     -8,      1,     -8,     -6,     -2,      2,      6,      4,     10,      2,     19,     -4,    -10,      3,      9,      2,      5,     -7,      1,     -7,      0,      3,     -4,      1,     -1,      8,      1,     13,      8,      7,      0,     -4,     -3,     -7,      1,     -2,     13,     -8,     -8,     -4,      0,    -12,     -3,      1,      9,     -4,      2,      6,     -2,      1,      3,     -2,     -5,     26,     -7,     -5,     -3,     -1,      0,     15,      7,     -1,     -2,     -1,      0,     -5,     -5,     22,     28,      2,      3,      5,     12,     -6,     -3,     43,      4,      2,      4,     -3},
-    {     1,      2,      6,      7,     10,      9,      2,      6,     -6,      4,      5,     -4,      0,      6,    -12,     -7,     -5,      4,      7,      3,     -1,     -6,     -3,     -1,      1,      5,     -7,     -7,      5,      8,      6,     19,     -9,     -6,      5,      3,      3,     -5,     -6,      2,     -4,     -7,      0,      2,     -3,    -11,     20,     11,     -7,      4,      0,      4,     -9,     -1,      7,     -1,      5,      4,      4,     -6,      3,     -3,      7,      1,      7,    -12,     -2,      0,      7,     -7,     14,      1,      8,      7,      4,     15,     -1,      2,      1,      3,     -8,      3,    -11,    -10,     -2,      2,     -3,      3,      5,     -1,      1,     -2,      0,      0,      4,     -1,      4,      1,      7,      1,      0,     11,      4,     -6,      5,      3,     -4,     14,     -4,      9,      0,      3,      0,      3,      8,     12,     -6,     -2,      4,      8,     15,     -8,      2,     15,     -7,      1,     -3,      3},
-    {    -1,      1,      1,     -1,      2,      0,      0,      0,     -1,     -1,     -1,      3,      2,      1,     -4,     -3,      0,      0,      2,     -2,      0,     -5,      1,     -1,     -1,      2,     -1,     -3,      1,      0,      7,      0,     -2,      0,      0,     -1,      5,      2,      0,      1,      0,      0,      1,      0,      0,      2,      0,      3,      4,      1,     -2,      0,      0,     -1,      2,     -1,      1,     -2,      2,      1,     -1,      1,     -2,      0,      3,     -1,     -1,      4,      4,     -1,      0,      1,     -6,      4,      1,      3,      0,      0,      0,      0,      2,     -1,     -4,      2,      2,      0,      0,      1,      1,     -3,      1,     -1,      0,     -1,      0,      0,      0,      0,      1,      1,     -1,      1,     -1,      1,      1,      0,     -2,      0,      3,      2,      0,      8,      0,      0,     -1,      1,     -7,     -1,     -1,      3,      0,      4,      0,      1,     -2,      1,      0,      1},
-    {   -10,      2,     -1,      1,     -1,      2,      0,      3,     -4,      3,      1,     -5,     -2,     -2,     -3,      0,      0,      0,      3,     -1,      9,     -6,     -1,      2,      0,      1,    -12,     -3,     -1,     -4,      2,      1,     -3,     -2,      1,     -1,      1,      8,     -5,      2,      5,      2,      3,     -3,     -1,     -2,      1,     -1,      3,      0,      1,     -2,     -2,     -3,     -2,      2,     -4,      6,     10,     -1,     -3,      0,     -1,     -1,     -1,     -4,     -1,     -1,      1,     -2,      2,      2,      1,     -3,      1,      1,     -1,      1,    -15,      0,      0,      0,     -4,      2,     10,     -3,      2,      0,      0,     -5,      1,     -1,     -4,      0,      5,      0,      1,      0,      8,      3,     -4,      0,     -5,     -2,      2,     -4,     -7,     -1,      2,      6,     -1,     -2,      0,      1,      2,     -3,      0,     -3,     -2,      0,      3,     -4,      0,      5,     -6,     -1,      2,      1},
-    {     0,     -1,      1,      0,      0,     -1,      0,      0,     -2,      0,      0,      0,      0,     -8,     -3,     -1,     -3,     -1,      1,      0,      2,     -9,     -1,      3,     -2,      0,     -6,      0,     -5,     -6,      1,      3,     -3,      1,      2,      1,      1,      0,     -1,     -3,     -6,      0,      1,     -1,      0,      0,      5,      0,      3,      0,     -7,      2,     -1,      0,     -1,      5,      0,     -2,      4,     -6,      0,      1,      2,      1,     -1,     -2,      0,     -3,      0,      3,      0,      1,      6,      5,      0,      0,     -4,      1,      0,      2,      0,     -6,     -1,     -9,      7,      0,      1,      1,      1,     -3,     -2,      0,      5,     -1,     -3,      4,      1,      1,     -2,      1,      2,      3,     -2,     -4,     -3,      2,     -3,      1,      0,      9,     -1,      3,      1,     -1,      2,      4,     -1,      5,    -10,     -2,      2,     -3,      0,      4,     -7,      0,      2,      2},
-    {    -4,      2,      1,     -2,      4,      4,     -2,     -7,      7,      0,     -3,      0,      5,     -4,     -5,     -6,      4,      9,      5,     -5,     -4,      3,      6,     17,      3,     -2,      2,      0,      7,      1,      3,      1,     -6,      6,      5,     -6,     -1,      6,     -5,      6,     -6,      0,     -7,     -3,     -6,      5,      5,      0,      8,      0,      0,      4,     -5,      4,      0,      0,     -2,     -1,      7,      3,     -8,      0,      2,     -2,     -1,     -6,     -4,     -3,      5,     -5,      3,      3,     -2,      2,     -6,     11,     -6,     -1,     -3,      1,      5,      1,     -1,      5,      2,     -1,      0,      1,      2,      4,      1,      0,      0,      0,     -1,      4,      1,      2,      2,      4,     -3,      9,      0,     -4,     -8,     -1,      2,     -2,     -8,      7,      2,      0,      2,     -3,      1,      6,     -2,     -1,     -2,      2,      5,     -5,      1,     11,     -2,      8,      7,      3},
-    {    -7,     -1,      3,      0,     11,      0,      0,     -5,      3,     -1,      9,    -13,     -5,      6,     -9,     -7,     -6,     -2,     -2,     -2,     -3,     -5,     15,     10,      4,     -1,     -4,     -1,      4,     -1,     13,      6,     -2,      7,     -3,      4,      9,      1,     -7,      0,     -2,      1,      0,      2,      9,      5,     -2,     -3,     -6,      8,      2,     -8,      3,     -9,      2,      3,     14,      1,     -1,     -1,    -12,      3,      2,     -3,      3,      0,      6,     -2,     14,     -4,      9,     -1,      4,      9,      5,      6,      0,      8,      3,      3,      0,     -9,     -4,     -5,     12,     -3,      2,     -3,      7,     -1,      3,     -2,      6,      6,     -2,      7,      3,      3,     10,     -2,      0,     27,     10,      1,     -2,     -2,     -6,     12,      0,     -1,      3,     -3,      4,      4,      6,      9,     11,     -1,     -7,      6,      6,    -10,     10,     14,      0,     -2,     -3,      0},
-    {   -10,      2,     -8,      0,     16,      1,     -8,      0,     -4,      5,     -2,     -4,    -11,      0,    -13,     -6,      4,      3,      0,     -2,     -3,     -3,      6,      9,     -2,     -3,    -10,     -6,     -1,     -2,     -2,     20,     -4,     20,      4,      1,     16,    -10,     -6,     -2,      1,      9,     -3,      8,     -5,     17,      8,      7,     -5,      3,     -8,     -3,     -6,     -6,      8,      9,     13,      8,     -4,      1,     -8,      0,     -4,      5,     -4,     -5,      2,     -2,     17,     -7,      4,     -2,      6,     14,     -4,      4,     -8,     -5,      2,      8,     -1,     12,     -8,     -3,      5,      8,     -2,      3,     -3,     -2,     -2,     -4,     -4,      2,      1,      5,     -2,      3,      6,     -4,     -5,     32,      8,     -5,     21,      0,     -2,      7,     -2,     -5,     -2,     -4,      6,      8,      0,     11,      3,     -2,     -7,     15,      4,     -7,      9,     31,      0,     -6,      2,      1},
-    {    -7,      9,      3,      2,      2,      3,     -1,      3,     -6,     -4,     -1,     -8,     -1,      1,    -16,     -8,      2,     22,     -2,      5,     -8,      0,      9,      6,      2,      5,     -4,     -8,      6,     11,      5,     17,     -7,     -1,     -2,      1,     -4,      7,     -4,      0,      2,      0,      3,      6,     -4,      6,     23,     -1,     -5,      1,      2,     -5,    -18,     -4,     -3,     -2,      9,     -7,      8,     -6,      1,     -2,     -1,     -2,      4,     -5,     -5,      0,      6,     -2,     12,     12,      5,     -2,     -1,      6,     -1,     -2,      9,     -5,     16,     -1,     -4,      0,      7,      1,      0,     -1,     -8,     -2,      0,     -3,      1,     -4,     -3,      5,      4,      2,      0,      7,     -9,     16,      3,     -3,      2,     -2,     -5,      7,      4,      0,      1,      0,      3,     -2,      6,      4,      7,      4,      0,      0,      6,     -2,     -4,     13,     -5,     -9,      0,     -4},
-    {    -3,     -2,      0,      9,     -4,     -3,      0,     -1,     -1,     -3,     -7,      2,     -3,     11,      1,     -4,     -2,      5,      4,     -2,     -6,      0,      6,      4,      1,      2,     -9,     -6,      1,      3,     18,     -1,     -2,      2,     -7,     -3,     -4,    -11,     -4,     -2,    -11,     -1,    -11,     10,     -3,      1,      0,      2,     11,     -1,      1,      4,     -5,      3,      8,     -5,     -1,      4,      3,      1,     -5,     -1,      5,      2,      0,     -5,     -1,     -3,      4,      5,     -1,     -2,      5,      3,      1,      5,      4,     -3,      3,      9,      2,      3,     -4,     -7,     12,      6,     -2,      2,      5,     -4,      3,     -2,    -12,     -2,      3,     13,     -2,      3,      7,     -2,     -5,      9,     11,      7,      2,      1,     -6,      8,      1,      0,     -3,     -2,      0,      7,     -2,      7,     -8,     -2,      3,     -2,      7,     10,      2,     16,      5,     10,      2,     -2},
-    {    -3,      0,      0,      0,      0,      0,     -1,     -1,     -1,      2,     -2,     -1,      0,      0,      0,     -2,      0,      0,      0,     -2,     -1,     -5,      1,      4,      0,     -1,     -1,      1,      1,      0,      0,      0,      1,      0,      0,      0,      0,      3,      0,      1,      0,     -2,     -4,      1,     -2,      0,      0,      4,      3,      1,     -1,      0,     -1,     -4,     -1,     -3,      2,     -1,      0,      0,      0,      0,      0,      1,     -2,     -3,      0,      1,      0,     -2,      0,      0,      0,      2,      3,      0,     -5,      0,      0,      0,      0,     -2,     -1,      0,     -4,      0,      1,      0,      1,     -3,      0,     -1,     -1,     -1,      0,      7,      0,      1,      0,      1,     -3,      3,     -1,      1,      1,      0,     -8,      0,     -2,      0,     -6,      0,      0,      0,      0,      2,      3,     -1,     -1,      4,      0,      1,      0,      0,     -2,      0,      0,      2},
-    {    -8,      1,      1,      0,     10,      5,      2,      0,     -2,      2,     -2,     -4,     -3,      1,     -6,     -1,     -3,      1,      1,     -5,     -8,     -3,      2,      2,     -1,     -2,     -4,     -4,     -1,      0,      0,      2,      1,      0,      1,     -1,      4,      6,      0,      1,     -5,      7,     -3,      1,      1,      9,     -3,      4,      2,      3,     -1,      1,     -1,     -1,      0,      3,      3,      1,     -2,     -1,      1,     -3,     -2,      1,      0,     -5,     -1,     -2,     -1,     -5,     -2,      4,      1,      4,      1,      5,     -3,      0,     -1,      1,      5,     -5,      1,     11,      5,     -2,      5,      1,      2,     -1,     -4,     -2,      1,      0,     -3,     -2,      1,     -6,     -8,      6,     -7,     15,      1,     -6,      4,      5,      1,      0,      0,      8,     -1,      0,      0,     -1,      0,      2,     -2,     -5,      6,     -1,      0,     -4,      0,      6,     -3,      4,      2,     -2},
-    {     2,      0,      0,      0,      1,      2,      5,     -1,     -3,      2,     -2,      0,     -1,     -5,      0,     -2,     -6,      4,      4,     -4,     -7,     -5,     18,     -4,      0,      0,     -1,     -4,     -5,     -8,     -3,     23,     -4,     -1,      2,     -5,      0,      5,     -6,      4,     -5,      1,     -3,      6,     -3,     -1,     -4,      2,     -4,      0,     -6,      0,     -4,     -4,     -4,      3,      5,      0,      2,     -6,     -4,      1,     -9,      1,     -1,     -6,     -1,      2,      1,     -1,     -1,     -6,      1,      8,     -2,      1,     -5,      1,     -1,     -8,     -1,     -8,     -6,     10,      7,     -1,      2,      3,      3,     -5,      3,      4,     -4,     -4,      0,      2,      1,     -2,      0,      3,      1,     25,     -2,     -1,      4,      6,     -1,     -2,     17,      9,      1,      2,      5,      0,      4,      8,      0,      1,      4,      2,      6,      0,     -3,      5,     -6,      0,      4,     -1},
-    {     3,      1,      1,     -2,     -3,     -4,      0,     -3,     -3,     -1,     -2,      1,      1,      0,     -9,      0,      7,      4,      2,     -6,     -4,     -7,      8,     13,      0,      0,     -4,     -3,     -2,      0,     -3,      9,      0,      7,     -1,      2,      1,      4,     -3,     -1,     -1,      2,     -2,      5,      1,      2,     -5,      1,     -1,     -7,    -10,      0,     -3,      2,      1,     -8,      1,     11,      6,     -1,     -3,      2,      5,     -2,     -5,     -6,     -3,      1,      0,     -3,      5,      2,     -1,      8,     -1,      1,     -3,      0,     -1,     -1,      3,    -10,     -1,      6,      2,     -1,      1,      2,      0,     -7,     -1,     -2,     -4,     -3,      3,      9,      0,      2,     -9,      3,      1,      4,     -8,     -1,      6,      0,     -1,      2,      0,      2,      1,      2,      2,     -5,      0,      1,     10,     -3,      5,      7,      3,     -3,      0,      9,     -4,      1,     -4,     -5},
-    {    -2,      8,     -1,     -4,      9,      3,     -3,     -1,      2,     10,     -1,     -5,      3,     -6,     -5,     -8,     -1,     14,     -4,     -3,      3,     -8,      4,     16,      0,      6,     -6,     -4,      4,     -2,      6,      9,     -1,      4,      0,      0,      1,      6,     -5,     -1,     -6,      1,      2,     10,     -9,     10,      2,      0,      1,      0,     -6,      3,     -5,      0,      2,     -1,      7,     -4,      3,     -4,     -6,      1,     10,      1,     -6,     -8,     -1,     -9,      0,     -5,      4,      2,      7,     10,     -1,      1,     -8,      7,      0,     -3,      5,    -10,     -1,      8,      2,      0,      1,      0,     -2,     -6,     -4,      2,      9,      2,      2,      2,      0,     -4,      6,     -1,     -1,      6,     15,     -7,      3,     -4,      2,      5,     -3,      6,     -2,      0,      4,     -5,      0,      8,      2,     -1,     -5,      7,     10,      3,     -2,     22,    -12,      8,      0,     -2},
-    {     2,      3,      0,      1,     -2,      3,     -3,     -3,      2,      0,      4,     -9,      0,      0,     -9,      0,     -5,     10,     -2,     -4,    -10,     -4,      4,     14,     -5,     -2,     -1,     -8,      1,      3,      4,     11,    -10,     -5,     -2,     -1,      5,      9,     -4,     -3,     -1,      1,     -1,      7,      2,      4,      6,      0,     -3,     -1,      0,     -1,     -4,     -1,     -6,      2,      9,      1,     15,      3,     -4,      0,     -2,      1,      0,     -3,     -5,     -4,     -3,     -3,     -3,      0,      8,      9,     -6,      0,      1,      4,      3,      2,     11,     -7,      2,     -7,     12,      0,      0,     -1,      3,     -6,     -1,      0,     -2,      6,     -1,      7,      0,     -7,     -6,      5,    -11,     12,      1,     -4,      5,     -2,     -2,      1,     -3,      8,      1,      0,      6,     -1,      4,      8,      6,     -2,      0,     -6,     11,     -8,     -7,     26,    -10,      4,      0,     -2},
-    {    -3,      0,      0,      1,     -1,      5,      1,     -1,     11,     -1,      3,     -3,     -1,     -1,     -1,      0,      0,      6,      3,     -1,     -1,     -5,      2,     17,      0,      2,      2,     -3,      7,      0,      6,     14,     -8,      1,     -1,     -1,      0,      1,     -2,      1,     -7,      2,      3,      4,     -1,     -2,      4,      0,     -4,     -3,     -5,     -4,     -3,     -2,      5,      4,      5,      1,     -3,     -5,     -3,      1,      9,      0,      3,     -7,      2,     -4,      1,     -4,     -2,     -2,      0,      3,     -3,      5,     -9,      3,     15,      8,      8,      1,     -3,      1,      1,      0,     -1,      1,     -1,     -2,      2,     -3,     -1,      8,      2,      9,      0,     -1,      1,      1,     -3,      9,      6,     -5,      3,     -3,      1,      5,      1,      5,     -1,     -4,     -1,      3,      2,     14,      4,      4,     -1,      9,      1,     -3,     -1,     17,     -7,      2,     -1,      2},
-    {    -5,      6,     -3,     -3,      0,      1,      0,     -9,     -1,      4,     -3,     -7,     -4,     -4,      2,     -4,     -1,     -3,      0,     -1,     -6,      1,      6,     14,      1,      2,     -5,      1,     -2,      0,      4,      2,     13,     -2,     -6,      3,      3,      4,     -3,      1,      0,      2,     -6,      5,      4,      0,      1,      1,      1,      2,      4,     -2,      1,      1,    -10,     -5,      7,      1,     -3,      1,      2,     -3,     -1,      5,     -3,     -6,      0,     -1,      0,     -5,      5,      2,      3,      6,     -1,      1,     -8,      4,     -2,     -1,      4,     -6,      0,      2,     -4,      3,      2,      1,      0,     -5,      0,      2,      6,      0,      5,      4,      0,     -2,      2,      3,      2,     10,      2,     -4,      1,      0,      3,      4,     -2,      3,      2,      1,      0,     -1,      3,     -5,      5,     -3,      2,      2,      3,      3,      1,     10,     -1,      1,      5,      0},
-    {    -8,      0,      0,      0,      1,      0,      0,     -2,     -4,     -2,     -1,     -1,     -1,      0,    -11,     -4,     -1,      5,      1,     -4,     -3,     -1,      0,      0,      0,     -3,     -1,     -6,     -1,     -1,      0,     11,      0,     -1,     -3,      1,      0,      0,      0,      1,      0,      0,      1,      2,     -1,     -6,     -1,      0,     -4,     -5,      1,     -2,     -1,      0,      1,      2,      0,      0,     -1,     -6,     -4,      0,     -1,      1,     -2,      0,      0,      0,     -4,     -1,      0,      1,      0,      4,      1,     -4,      0,      0,      0,      0,      0,     -3,     -2,     -2,      0,      0,      1,      1,      1,     -2,     -2,     -5,     -3,     -1,      0,     -7,     -2,      1,      0,     -1,      2,     -5,     -3,      1,      0,      0,     -8,      0,      1,      1,     -3,      0,      0,      0,     -1,      0,      0,     -6,      3,      0,      0,     -1,      3,      0,     -7,      0,      1,     -2},
-    {    -2,      6,     10,    -13,     21,    -13,      1,      4,     -9,     -1,    -12,      1,     -4,     14,    -11,      4,      7,     16,     -8,      0,    -10,    -10,    -12,      0,      9,     -3,     -6,     12,     -1,      0,      5,     11,     -7,      2,     -7,     -8,      2,    -10,     -8,     -1,     -5,     11,     -5,     -6,      8,      1,     -6,     20,    -10,     12,     -6,      1,     -8,      6,      9,     -2,     10,     11,      8,      5,     -4,      3,      9,    -12,     -4,     -3,     -5,    -13,      5,     -7,     -3,     11,     17,     11,     -7,     35,      1,      3,      3,      9,     14,     -7,     -8,     -8,      8,     10,      2,      3,     -5,      1,      4,     -7,      3,      4,     -8,      3,      7,     -7,     -1,      4,     -2,     49,     -4,     -4,      1,      8,      0,      6,     -2,      7,      8,     16,     27,     -4,      7,     -2,      2,      4,      4,      5,      4,      7,      1,     28,      0,      1,     -3,      2},
-    {    -7,      1,      1,      1,      1,     -1,      0,     -1,     -3,      1,      1,      2,     -1,      0,     -2,     -1,      2,      1,     -2,     -4,     -7,     -5,      3,      1,     -1,      1,     -1,      3,     -1,      0,      0,      0,     -1,      1,      0,      5,      0,      4,     -4,      2,     -3,      1,      0,      7,     -2,      0,      3,      0,      7,      1,     -3,      5,     -2,     -2,     -7,      1,      1,      2,      8,     -3,     -5,      2,     -1,     -7,      1,     -4,     -1,     -2,      0,     -1,      0,      0,     -3,      3,      1,      3,     -1,      0,      1,     -2,     -1,     -1,     -3,     -1,      6,     -1,      1,      2,      1,     -7,      3,     -2,      1,     -1,      6,      0,      0,     -3,     -1,     -4,     -4,     -2,      3,     -3,      3,      0,     -3,      0,      2,      4,      1,      0,      3,     -2,      4,     -5,      0,     -1,      1,      0,      0,     -1,     -1,      0,     -5,     -1,      2,      1},
-    {     3,      0,     11,      0,     -1,      1,     -1,      1,      0,      2,      3,      4,      7,     -1,     -5,      1,      0,      0,     -3,     -3,      2,      2,      0,     -3,      0,      3,      0,     -2,      4,      1,     -2,      0,     -3,      0,     -2,     -1,      0,      0,      0,      0,     -1,      0,      5,      0,     -1,      1,      4,      0,      5,      0,      1,      3,     -2,      0,      0,     -2,      0,      1,      4,     -1,     -4,      1,      1,      0,     -1,      0,      0,     -1,      1,     -1,      0,     -4,     -2,      0,     -1,      0,      3,      0,     -1,      2,      0,     -6,     -3,      1,     -1,      0,      0,     -1,      5,     -1,      2,     -4,     -4,     -1,      1,      0,      0,      1,     -1,      2,      1,     -3,      5,     -2,      1,      0,      0,      0,      1,      2,      1,      2,      1,      1,      0,      0,      0,     -1,      2,     -1,     -1,      0,      0,      0,     -1,     -1,      1,     -1},
-    {     1,      3,      0,      1,      1,     12,     -6,     -2,     -3,      4,      3,     -7,      2,      2,     -5,     -3,     -2,      1,      1,      0,     -8,      0,      9,      3,     -2,      4,     -3,     -1,      1,      8,     -3,      8,      2,      3,      4,     -4,      0,      4,     -2,      3,      3,     -2,     -3,     -7,      2,      1,      4,      0,      1,      0,     -2,      1,     -9,     -1,      1,      5,      4,      2,      1,      0,     -5,      1,     -2,      6,      2,     -2,     -1,     -3,      2,     -2,      8,     -1,      9,      4,      0,      0,      3,      2,      2,      3,      3,     -3,     -2,      7,     -1,     -1,     -3,      1,     -2,     -8,      1,     -5,     -3,      2,      1,      8,      2,      1,     -5,      1,     -1,      2,      3,      3,     -2,      4,     -4,      2,      4,      5,      0,      2,      2,     -2,     -3,      0,      3,     -2,      0,      6,      0,     13,      0,     11,     -1,      4,     -1,      1},
-    {    -5,      3,     -2,      0,      0,      0,     -1,     -6,     -5,      5,      0,      3,     -6,     -5,      0,      2,     -2,     12,     -2,     -1,     -7,      1,      5,     10,     -1,     12,      3,     -7,      3,     -6,      3,     12,     -7,      2,     -3,     -2,      1,      0,     -3,      0,     -8,     -3,     -1,      2,      2,      0,      4,      0,    -10,     -2,     -7,     -2,     -1,      5,      3,      2,     -6,      0,      4,     -1,     -9,      0,     -5,      2,      0,      1,     -4,      0,      0,     -5,     -3,      1,      0,      9,      2,      2,     -1,     -1,     -1,     -1,     -2,     -5,     -3,      6,     -2,      0,     -1,      0,     -1,     -9,     -7,     -5,     -4,     -4,      1,      5,      0,      0,     -3,     -1,     -1,     11,      1,     -4,     -8,      7,     -2,      0,     -2,     -2,      1,      0,      0,     -1,      4,      6,      9,     -5,     -5,     -5,      6,     -8,     -2,      4,     -1,     -1,     -7,      1},
-    {     0,      5,      4,      0,      3,      1,      3,     -1,     -3,      1,     -5,      0,     -2,     -2,      0,      0,      2,     -6,     -3,     -2,     -3,      1,      1,      0,      0,      1,     -4,     -2,      0,     -1,      0,      0,     -2,      4,      1,      3,      0,     -2,     -2,     -3,     -2,      1,     -2,      3,      4,      0,     -1,      0,      3,      0,      1,     -2,     -2,      0,      2,      0,      1,      2,      9,     -4,      2,      0,      0,      2,     -5,      0,      0,     -3,     -1,      0,     13,     -4,      5,     -3,      0,      5,      0,      0,     -6,     -1,      0,     -4,      2,      1,      0,      0,      2,      1,     -1,      2,     -2,     -1,     -4,     -1,     -5,      0,     -4,     -4,     -1,      0,      2,      5,      0,      1,      0,      0,      3,      0,      2,      0,     -2,      0,      0,     -2,      1,     -1,      0,     -1,      1,      2,     -1,     -3,     -2,      0,     -3,     -1,      0,     -3},
-    {    -6,      1,      1,      0,      1,      2,     -3,      1,     -1,     -2,      0,      3,      3,     -4,     -3,     -2,     -2,      1,      2,     -6,     -2,      1,      2,      7,     -4,     -1,     -1,      1,      6,      2,      3,      1,     -6,      0,      0,     -3,      1,      2,     -1,      6,      0,      1,      1,      3,     -1,      1,     -1,      0,      1,      0,      1,     -6,     -3,      0,      1,      0,      0,      1,      3,     -3,      0,      0,      0,      3,     -2,     -2,      1,      0,      2,     -3,      0,      2,     -3,      1,      4,      1,      0,      0,      0,      4,      1,      1,     -3,      1,      0,      1,      1,      0,      4,     -3,      4,     -3,     -1,      0,      0,      0,      0,      1,      2,      1,      1,      0,      6,     -3,      6,      0,     -1,      1,      1,      6,      1,      2,      1,      0,      0,      0,      5,      0,     -1,     -1,      1,      1,      0,      1,     -3,      0,      1,      1},
-    {    -7,      3,      1,     -5,     12,     -2,     -2,      3,     -2,      4,      0,     -4,      4,      0,    -10,    -12,     -3,     19,     -3,      6,     -8,     -4,      1,      2,      0,     -3,     -1,      5,     -5,     -1,     -4,      3,      6,      3,     -3,      2,      3,     -1,     -2,     -1,      1,      3,     -3,      3,      0,     -3,      0,    -13,     -5,     -4,     -5,     -4,      0,      1,     -3,    -10,      2,      1,     -3,     -5,     -7,      1,      0,      1,      0,     -3,     -7,     -7,      0,     -5,      2,      4,      1,      2,     -4,      1,     -5,     -6,     -2,      0,      7,    -12,     -1,    -10,     -5,      6,      2,      4,      5,     -8,      0,      0,      5,     -5,      0,     -3,      3,      2,      0,      1,     -1,      4,      5,     -2,      1,     -3,      1,      1,      3,     -4,     -1,     -2,      1,     -4,     -5,     -8,      7,     -1,      2,      8,     -2,      8,      1,      4,     -4,     -2,      5,      3},
-    {     6,     11,     -1,     -8,      1,      4,     -6,     -7,     -7,      4,      0,      1,     11,     10,     -3,      2,      2,      4,     15,     -4,     -1,     -8,     10,     -7,      8,     12,     -3,      1,      6,    -10,     -2,      7,      0,     -8,      4,      8,      0,    -12,     -7,    -11,      9,      6,      9,     -6,     11,      6,    -11,     13,      2,      5,     -5,      5,     -8,     -4,     -2,     -4,    -10,      2,      1,     -3,    -15,      0,      1,     -3,     -4,      0,     -4,     -3,      5,    -14,     -7,      2,      1,     -2,      1,     17,      3,     -9,     -1,      0,      3,    -12,      3,     -1,    -14,     10,     -4,      8,     -1,     -2,     12,     -6,     -4,      8,    -13,      7,      7,     13,      9,     -2,     -7,     22,      2,     -4,      4,      5,      0,     -6,     -1,      6,      7,      6,    -14,      0,     -1,      4,      3,     -6,     -1,     12,      2,      1,    -13,     -1,     -9,      9,     -3,      1},
-    {     5,      1,     -3,      2,      0,     -2,      1,     -7,     -5,     -9,      4,      2,      7,     12,      4,      0,      2,      9,     10,     -9,     -6,     -4,      1,      6,     -1,      3,      0,     -1,      3,      1,     10,      9,      2,     12,     -5,     -2,     -3,      9,      1,      0,     -2,     12,      3,      3,      5,      5,     -5,      5,      1,      1,     -5,     -2,      3,      7,     -8,      1,      8,      4,     -2,    -10,     -2,      1,      6,     -8,    -11,     -5,     -3,      1,     12,     -3,     -1,      6,      0,      2,     -1,     20,     -4,      1,      1,      3,     -3,     -7,     -3,      0,     21,      7,     -9,     -4,      2,     -5,      1,      1,     -3,     -2,      3,      1,     -1,     -9,      4,      4,     -1,      8,     -4,      0,     -3,      3,      7,      6,     -4,     -9,      0,      4,     13,     -6,     -3,     11,     18,     -7,      3,     -3,      2,     -4,     -5,      1,      5,      4,     -2,      6},
-    {     0,      2,      0,      3,      7,     -3,      3,     -2,      3,      7,      3,      3,      4,      2,     -9,     -6,      1,     12,    -15,      3,     -9,      4,      5,      1,     -3,      8,     -3,      7,     -1,      9,     -1,     19,      3,     -4,     -3,      2,      6,      4,     -6,     -2,      3,      4,     -7,      6,     10,      8,     -2,      4,     10,      1,     -1,      0,     -9,     -4,     23,      3,      3,     15,     12,     12,      3,     12,      5,     -1,      9,     -4,     -1,      1,      2,     -7,      8,      8,      8,     18,     -4,     17,      0,     -6,     -3,      3,      2,    -13,      6,     -3,     24,     -5,     -6,      5,      3,     -1,      0,      4,      0,      7,     10,      5,      8,      2,      8,     10,     -4,     29,      5,     -5,      5,      4,      0,     -2,     -6,      2,     -2,      4,     21,     -6,     10,     13,     -2,      1,      8,      2,     -2,     -4,     -6,     24,     -6,     -9,     -4,      3},
-    {    -5,     -3,      5,     -1,      1,      0,     -5,     -1,     -2,     10,     -1,     -2,      9,     -5,     -6,     -5,     -3,     16,     -3,      1,      5,      3,     -2,     14,      6,     -4,      2,      1,      5,     -3,      0,      7,     -3,      4,     -2,      7,      6,      5,      4,      2,     -5,     -5,     -1,      0,      1,      7,      8,      9,      8,      6,      4,      5,    -12,     -2,     -2,     -8,      6,      5,      5,      6,     -8,      2,    -12,      3,      3,     -3,     -6,     -8,      7,      2,      2,      1,     13,      9,      1,      9,     -2,      2,     -4,      0,      0,     -7,    -12,    -14,      1,      9,      4,     -1,     11,     -3,      9,      5,     -2,      0,      6,     15,     13,     -3,      7,     -5,      2,     10,      5,     -2,     -8,      1,     -7,     25,      9,     -8,      1,     10,      1,     -3,      0,      8,      7,      3,     10,      5,      1,      7,      5,     20,     -4,     -6,     10,      6},
-    {     4,      5,      7,     -1,      3,      3,     15,      8,      0,      5,      3,     -5,     -3,      2,     -7,      0,     -2,     12,      6,      9,     10,    -10,    -13,     -2,      3,     13,      3,      0,     16,      2,     -6,    -11,     -3,     -1,      0,      8,      3,     -5,      0,     -6,     -4,      4,     -3,     -9,     14,     12,     -4,     14,     -6,     16,      4,      5,    -10,      1,      4,      3,      6,     16,      8,      5,      1,      4,      7,     -2,     -3,     -5,     -3,     -5,     -1,      4,     -1,     10,     -1,     17,      4,     18,     -2,      6,     -4,      9,      5,      2,      8,      0,      5,      4,      5,      1,     13,     -6,      0,      5,     -3,      4,     -4,     10,      8,     -1,     -3,      5,      5,     -3,      6,     -3,    -13,     -4,     -5,     -7,     -3,     -9,      5,      4,     14,     -1,     12,     -2,      8,      7,     -3,      3,      4,     -4,      1,     20,      1,     10,     -1,    -12},
-    {    -1,     -4,     19,     -2,     14,      0,      5,     -4,      8,    -14,     -3,     -1,      2,     -2,     -2,     -3,      8,     -5,     -4,      0,      5,     -1,     -7,     14,     -2,     -6,     -1,    -12,     14,      2,     -2,      0,      8,     -1,      5,     13,      9,     26,     -6,    -18,     -9,      7,     -4,      4,     -1,     17,      2,      4,     10,     -2,      5,      7,      2,     -5,     -3,      0,      1,      9,     10,      7,     -8,     -6,      5,     -4,      1,      4,     -8,      1,      9,     -2,      2,      6,     14,      4,     -3,    -10,      1,      5,     -8,      1,      1,     -6,    -10,     -2,      5,      6,      9,      2,     -5,     -2,     -4,      2,     -5,      6,      3,     17,     -1,     -5,      4,      2,      2,    -20,    -12,    -14,      4,     -7,    -12,      2,      8,     -5,      3,      1,      3,     -1,      5,     -1,     -2,      6,      3,     -6,      7,      0,     -4,     40,     -5,      2,     -3,      7},
-    {    11,     -5,     10,      0,      6,     -1,      1,     -5,     -3,     -3,      1,      1,      5,     -7,     -6,     -6,     -4,      8,     -2,     -9,    -14,    -13,      2,      5,      9,     -1,     -5,     -5,      1,     10,      1,      3,    -24,      1,      6,     17,      6,    -27,     -5,     -5,     -3,      1,     -1,     -4,     -2,     16,      6,      5,      1,     10,    -11,     -4,      0,     -9,     -5,     -1,     -9,     13,      3,     -1,     -4,      9,     -5,     -3,      0,     -3,      0,     -2,      9,     -1,      2,     -3,     12,      6,     -6,     -3,      0,     -8,      3,     -2,      6,     -5,     -4,     -8,     16,      0,     -6,     -1,      7,     -2,     12,     -3,      3,     -2,     10,     -3,      3,     -6,     -2,      3,     -1,     -1,      0,     -7,     -4,     -1,     -5,    -15,    -12,      8,      5,     -3,     19,      4,      7,      2,     -1,      6,      3,      9,      2,     -1,      4,     36,     -6,      4,     13,     -6},
-    {    -2,      5,     -2,      5,     12,      7,      8,      3,      7,      9,     -3,      8,      9,     12,     -9,     -1,     -1,     18,      5,    -11,    -11,     -5,      0,     -2,      3,      0,    -14,      2,      5,      3,     -5,      1,      1,     -6,     -5,     -9,      5,      7,     -5,     -5,     -5,     -1,     -3,      7,     -4,     11,      8,      8,      1,     10,      9,     -9,      7,      3,     -3,     -2,     19,     -2,      7,     -3,     -1,      8,      5,     -6,      0,     -3,      7,    -10,      7,     -5,      2,     -1,     -3,      9,     -7,     13,     -2,     10,      3,      3,     -2,      1,     -9,      6,      7,      1,      5,      3,      4,      2,      6,     -3,      3,      2,     -1,      2,     12,      3,      9,      6,     -5,     28,     -3,    -11,      3,     15,     -9,      9,     -1,     21,      2,      5,      8,      3,      4,     11,     -2,      5,     -1,     -4,      5,     -4,     15,      6,     -5,     -3,      4,      3},
-    {     2,      3,      9,      3,     14,     -5,      4,     -9,    -12,     -3,     -2,      6,     15,      5,     -1,     -7,     -5,      2,      7,     -6,    -15,     -7,      3,      7,     -4,     10,     -6,      7,      2,     15,      4,     31,      2,      4,      6,     -3,      6,      4,     -6,     -9,     -8,     -2,     -5,      2,      8,     -1,      1,     -4,      4,      5,      3,      1,     -4,     -4,      0,      4,     -2,      6,     -4,     -8,     -9,     10,     10,     -6,      6,      9,     -9,     -3,      5,     -6,      1,     -2,     -7,     10,      5,      1,     -4,      7,      0,     -1,      2,     -8,     -3,     10,      9,     -7,      2,     11,      2,      7,      3,     -4,     -2,     -4,     14,     10,     16,     -9,     -2,      2,      3,     15,      0,     -2,      7,     -4,     -5,     11,     -2,      4,      5,     -1,      6,      1,      0,     14,     24,      7,      6,     11,      0,      1,      9,     13,      2,     11,     -2,      4},
-    {    -8,      0,      4,      0,     10,     11,     -4,     -5,     -1,      6,     -1,      3,      4,     -8,      0,      2,      0,      4,      5,    -10,      3,     -3,     -1,      1,      3,     -3,     -6,      6,      4,     -5,      4,     11,     -3,     -2,     -1,      3,     14,     20,     -1,     -9,     -9,      9,     -7,      1,      4,     -1,      5,     16,      2,      6,     -2,     -7,     -4,     -8,     11,     -4,     15,     -4,     -3,     -2,     -7,      2,     -5,     -4,      3,     -1,     -2,     -9,      4,     -3,     -4,      5,      1,      1,      3,      6,     -6,     -4,      5,      3,      0,     -2,     -1,     -5,      7,      7,     -7,      7,     -1,      1,     11,     -2,     -4,     11,     -2,      2,      5,      4,     -4,      6,     -3,     16,     -5,     -6,      6,     -4,     -6,     -6,      0,     -1,      0,     -3,     14,      4,     -5,    -10,      1,      6,      1,     -9,      1,      0,      0,     17,     -9,      0,      3,     -1},
-    {    -1,      4,      2,      1,     12,      9,      3,     -4,     -4,     -1,      2,      1,      8,     -3,     -5,      0,      1,      2,     -8,     -1,      1,      1,      2,      1,     -4,      4,      0,     -3,      3,      2,     -2,      4,    -14,     12,      2,      8,    -10,      9,     -5,      0,      0,      3,     -7,     -4,      0,    -14,      4,     10,      1,      0,     -4,     -6,     -4,      4,     12,     -1,      9,      7,     -2,      1,     -5,      4,     -3,      0,     -5,     -2,     -4,      1,      3,     -2,      2,      8,     -2,      9,     -7,      4,     -1,      2,     -2,      5,     -8,     -4,     -6,     10,      5,      6,      9,      0,     -1,     -8,      3,     -3,      4,      3,      3,      3,     10,      1,     -5,      0,      1,     12,     -1,    -11,     -4,     -5,     -2,     -1,      2,     17,     -1,     -3,      6,      4,     -1,      7,     24,      8,      8,      5,      2,    -10,     -2,     -3,    -11,      0,      4,     -4},
-    {    -7,      1,     10,      1,     -5,     11,     -3,     -1,     -4,     -8,      1,     -5,      3,     -4,      2,      1,     -1,     15,     -8,     -6,      4,     -3,      9,     -6,     -4,     13,      1,     -7,     -3,     -8,     -2,      5,      0,      2,     -3,     -2,     -9,      7,      0,     -8,     -4,     -2,      1,     12,      5,      1,      1,      4,     -9,      2,      1,      6,     -8,     -4,      6,      4,     -2,     -8,     -6,    -10,     -2,     -4,      3,      4,     -4,     -3,     -2,     -2,      4,      4,      7,      3,      6,     -3,     -2,     -1,      4,    -10,      1,     -9,     -3,      2,     -8,     -5,      8,      3,      1,     -2,      1,     -9,      1,     -1,     -4,      3,     -1,      0,      5,     -4,     -3,      0,     -4,     15,      5,      0,     -5,     -2,      4,      3,      6,     11,      6,      8,      7,      5,     -7,      8,      3,     -3,     -2,     -1,      0,    -11,    -12,     25,     -1,      4,      1,     -2},
-    {     0,      6,      6,      1,      6,      7,      5,     -4,     -3,      1,      0,     -4,      3,     -2,     -3,     -2,      5,      4,      3,     -6,      0,      6,      0,      7,      8,      8,     -2,      2,      6,      0,      0,      5,      3,     -4,      0,     -3,     12,    -18,     -3,    -11,      7,      5,      4,      4,    -12,     -3,      6,     10,      5,      2,      4,     16,     -3,     -3,      5,      7,      1,      8,     10,     -7,      2,     -2,      3,     -2,      0,     -4,     -3,     -4,     -1,     -2,      2,      5,      4,      8,      5,      2,     -4,     -8,     -1,      4,     -6,      5,      1,     -1,     -1,     -1,     -7,      6,      5,      7,     10,      4,     -4,      1,      0,     -2,      1,      6,      3,      3,     -8,     10,     12,     -5,      8,      0,      3,     18,     12,     18,     -1,      6,     21,     -6,      6,     18,      1,     -3,     -8,     -1,      4,     -6,     -2,     21,     -2,     -8,    -10,      5},
-    {    -6,     -3,      5,      0,      5,      7,      3,     -7,      7,     -3,     -1,      0,      5,      4,     -6,     -4,      0,      2,      3,      7,     -5,     -8,      2,     14,      5,      3,      2,      6,     -5,      3,      0,    -16,      3,      6,      4,     -1,     12,     10,     -3,      0,     -6,      8,     -2,      4,      8,     12,     -7,     -9,      1,      5,      0,      6,     -8,      0,      8,     -3,     -1,      4,      8,     -5,     -4,      5,     -1,     -2,      1,      5,     -1,     -2,     11,     -9,      1,     -3,     -8,     13,     -7,     35,     -3,     -4,      0,      2,      3,     -8,      3,     -1,      3,     -6,      4,      3,      5,     -2,     10,     -7,     -3,      1,     -5,      1,      7,      3,      1,     -2,      4,     -1,      3,     -7,     11,      1,      1,     14,     -1,     11,      8,      1,     19,     -1,     15,      8,     10,      1,      4,     -2,      2,      9,     -1,     12,     -2,      0,      4,     -1},
-    {    -2,      5,      7,     -5,      5,      6,      4,      0,     -3,      8,      2,     -3,      8,     -1,      2,     -2,     -2,      5,      6,     -4,     -4,     -3,      9,      4,     -1,      0,     -5,      6,      4,     15,      0,      6,     -5,      0,      0,      0,     14,      1,     -1,      3,     -9,     -2,     -4,      2,     -1,     13,      6,     11,     17,      1,     -9,     -3,      2,      3,      8,     -3,     -6,     10,      5,     -1,      0,     -8,      5,     -3,      2,    -14,      3,      0,      1,     -7,      2,     -9,     -1,      7,      4,     11,     -1,      4,      2,     -3,      3,     -5,    -12,      9,      9,     -8,      4,      7,     -5,     -3,     -1,      5,     -1,      4,     10,      4,      4,      4,      1,      6,      0,      8,      1,    -10,      7,      3,     -1,      1,      3,     -1,     -5,     12,      6,     -2,     11,      2,      5,     -1,      6,     -1,      3,      3,      3,     10,     -2,     12,      1,      5},
-    {    -4,     -2,     11,     -8,     -3,     -5,    -13,     -2,     -9,     -7,      4,     -2,     10,      0,    -20,      0,     -2,     11,     -1,      0,     -2,     -5,    -10,      7,      6,     -7,    -10,     -1,      1,      0,     -1,     17,    -18,     -3,     -4,      3,      3,    -17,      0,      5,    -11,     -2,    -11,      0,      6,     10,      4,      3,    -13,      5,     13,      4,    -14,     -2,     14,      5,     10,     12,     -2,     -5,      4,      3,     -1,     -9,     -5,     -5,     -7,     -8,     11,     -2,     10,      4,      6,     -8,      9,     24,     -1,      0,      1,     -2,      2,     -7,      0,      2,      7,      2,    -14,     11,      0,    -17,    -11,      6,     -8,     -7,     -1,     10,      1,      5,      2,     11,     -8,     16,     14,      1,     14,      0,      4,      8,     -3,     -8,      5,      9,      9,      1,      1,      1,     -5,     -1,      2,      4,      0,     -8,     -1,     11,     -3,      2,     11,      3},
-    {    -7,     -8,     -4,      2,      2,      5,     -5,     -6,      7,     -3,     -5,     -2,     -6,     -1,     -3,     -4,     -6,      6,     10,    -12,     -5,     -5,     -1,      9,     -1,     11,     -4,      6,     -1,      0,      3,     10,     -5,      6,     -7,      5,     13,    -11,      1,     -4,     -2,      6,     -1,      0,      7,     -3,      3,      9,     -1,     12,     -6,      0,      0,      1,      0,     11,    -10,     -1,      0,      2,      0,      1,      1,     -2,      1,      0,     -6,     -6,     -1,     -1,     -6,      0,     -1,      5,     -6,     14,      6,     -1,      5,     -2,     -1,     -6,      3,      2,     -7,      9,     -6,      0,      5,      4,      6,     -3,     -2,      2,     10,      7,     14,     -2,     -2,      6,      0,     28,     -5,     -3,     -1,      4,     -9,      2,      5,     -1,     -4,      3,     21,     -1,      0,     12,     17,      0,     -2,      3,      2,    -12,      8,     13,      7,      5,      4,      6},
-    {     6,      1,     -2,     -1,      8,     -1,      5,      4,     -3,      9,     -2,      4,     -1,     -1,     -4,     -2,      4,      3,     -5,     10,     -3,      5,     -5,     16,      0,      1,     -1,      2,     -2,      4,      6,      9,      4,     13,     -3,     -1,      1,     26,      2,     -1,     -5,      8,     -1,     -4,      7,      1,      2,      4,     -2,      5,      0,    -11,     -6,     -4,     -1,     -2,      8,      8,      7,     -1,      3,     -9,      2,     -3,      3,     -2,     -3,      0,      0,     -1,     -1,      5,      4,      1,      5,      9,     -6,     -1,     -1,      0,      2,     10,     -2,      3,      7,      2,      1,     -3,     -4,    -12,     -6,      2,      3,      5,     -8,     -4,     -6,     -4,      3,      1,     -3,     16,      2,     -8,    -11,     10,     -7,     -3,      1,      1,     -4,      0,     16,      6,      0,      7,     18,      4,      9,     -3,      2,     -4,      0,     18,     -8,      3,     11,     -9},
-    {     9,      1,      1,     -1,      8,      3,      2,     -2,     -2,     -3,     -2,     -1,     -9,     -3,     -4,      0,     -1,     -2,     -3,     -8,     -4,     -8,     -3,      3,      0,     -8,      4,     -5,      2,      0,      5,      4,     -7,      4,     -2,      4,      2,      0,     -1,     -8,     -4,      3,      0,     -6,     10,    -15,     -2,      5,     -5,      0,     -3,     -1,     -4,      1,      2,      3,     -4,     11,     -3,      1,     -2,      1,      6,     -3,      1,     -9,     -2,     -4,     10,     -1,      1,      1,     14,     -6,     -6,     13,     -2,      0,      1,      9,      3,      7,     -2,      6,     -1,      2,      0,     -1,      1,    -11,      4,     12,     -2,     -8,     -1,      2,      8,     -2,     -4,     -1,     -6,     26,      8,    -11,      3,     -9,    -13,      1,      5,      2,     -6,    -11,      6,     -3,      7,      2,     12,      2,      2,      4,      0,     -3,     -1,      8,     -4,     -9,     -2,     -7},
-    {     3,      4,      5,     -3,     -4,      2,      1,     -4,     -5,      4,      2,     -5,     -5,     -1,     -5,      2,     -4,      4,      0,      0,     -2,     -2,    -11,      8,      6,      0,     -5,      1,      2,      0,      2,      5,     -4,     -1,      2,      0,      7,     13,      1,     -8,     -7,      4,     -5,      5,      9,      5,     -2,      3,     -1,     -2,      3,      3,     -4,     -5,     -1,     -5,      7,      5,      3,     -1,      2,      1,      5,     -2,      2,     -4,     -1,      2,     10,     -3,      2,      4,      5,     12,     -1,     12,      4,      0,      1,      5,      0,     -6,      2,      0,      5,     -3,      1,     -6,      0,      1,      6,      7,      1,      0,     -4,    -10,     14,      3,      0,      0,     -5,      7,      4,      3,      2,      3,      7,     14,      7,     -1,      4,      5,      8,      5,     -6,      1,      7,     -3,      1,      0,      2,    -10,     -1,     11,     -2,      4,      3,      4},
-    {     2,      3,     -4,      0,      6,      2,      3,    -14,      0,     -7,      0,     -4,     -6,      1,    -14,     -1,     -5,     12,      8,    -12,     -3,     -4,     -9,      0,      1,    -10,     -5,     -2,     -6,      0,      0,     13,     -2,      7,      2,      5,      6,    -11,      0,     11,     -7,      0,     -5,     -7,     -3,     13,      3,     12,      1,     -1,     -7,      7,     -6,     -2,     -2,     12,      4,      2,      5,     -4,     -1,     11,      4,     -1,     -3,      6,     -4,      0,     -7,     -5,      9,      6,     -2,     -1,     -1,    -17,      4,      0,     -1,     -2,      1,      0,      9,     -5,      7,      0,     -4,      0,     -1,      2,     16,      1,     -1,      6,      1,      2,     11,     -4,     -1,      8,     -1,     27,      1,      1,     -5,      6,     -2,     17,      4,     -4,     -7,      0,     16,     -1,     -3,     -2,      4,    -12,     -6,      1,     -1,     -9,     -1,     11,     -6,      2,      3,     -2},
-    {     8,     -2,      9,      1,      6,     -1,     -3,     -4,      2,     -4,      3,      6,      0,      5,     -2,     -2,     -5,      0,     -1,    -10,      4,      0,     19,     12,      6,      1,     -4,      7,     -6,     -1,      6,     12,      7,    -10,     -3,     -1,     -2,     -4,      1,     -2,     -5,      3,     -5,      2,     10,     16,     -7,      9,      4,     -3,     -5,     -3,     -2,     -5,     -4,      1,     -7,     12,      4,      3,     -2,     -3,      9,     -2,     -5,     -7,    -10,     -6,     13,    -11,      9,     10,      1,     -5,      2,     25,      6,      0,      3,      4,      5,      3,     -4,     -4,      1,      5,     -5,     -2,     -9,     -4,     -1,      5,      1,      4,      1,     -1,      4,      3,      7,      7,     -2,      6,      1,    -13,     -1,     -4,      1,     -7,      9,    -12,      5,      7,      8,     -5,      7,      2,     -8,      3,      0,     -5,      6,     -8,      8,     16,     -1,      2,      4,      3},
-    {    -6,      6,      4,     -2,      2,     21,      3,      0,     -2,      0,     -2,     -1,      0,      3,      1,      2,      0,      4,     -1,      0,     -7,     -4,     -6,     -2,      2,     -2,     -6,     14,     -5,     -3,      0,     -1,      4,      5,     -6,     10,      3,     -8,      3,     -8,     -9,     14,     -3,    -11,      7,      5,     -8,     12,      1,      1,      8,    -10,      0,     -4,     -6,      0,     -2,      4,     11,     -5,     -3,      5,     10,     -6,     -2,     -4,     -8,     -7,      4,      0,      8,      4,     -3,      4,      1,     -2,      3,     -4,      6,      6,      6,    -14,      1,     16,      5,      2,      6,      4,     -5,     -7,      9,      0,      0,     -6,      1,     13,     15,      9,     -4,      1,     -8,      7,     14,    -16,      6,     -2,    -13,     -3,      6,      5,     -2,     11,     13,      6,      8,     -8,      0,      1,      7,      0,      6,     -7,     12,      4,     -2,     -4,      4,      7},
-    {    -4,     -1,      7,      0,     18,      7,      8,     -5,     -6,     -2,      4,      0,     11,     -3,     -2,     -1,     -8,      2,     -4,    -11,     -7,     -4,     14,      4,     16,     -2,      2,     10,      4,     -6,      4,      3,     -9,     -1,      4,     -5,     18,     14,     -3,    -12,     -6,      2,      1,     -3,     14,      6,      3,     19,      0,      9,      0,     -2,     -4,     -7,      8,      6,      1,      2,      1,      4,      1,      0,     10,     -4,      6,     -3,     -5,     -5,      7,     -1,      5,      7,     -3,     13,      2,     20,      5,     -4,     -4,      5,      4,     -5,    -13,      0,     14,     13,     -6,     -4,     -4,     -2,      9,      2,      3,      9,      1,     14,     10,     10,     -2,      5,     -4,      8,      4,     -9,      9,      5,      1,     -3,     11,      7,      6,     10,     22,      2,     18,     -7,      5,     -7,     -2,     -6,      6,      1,     -4,      9,     -8,      4,     -7,     -7},
-    {     0,      0,      4,     -1,     14,     19,      2,     -3,     -9,     -2,     -2,     -2,      2,     -9,      2,      0,      1,     15,      9,     -8,      0,      0,     10,     17,      1,      9,      6,     14,      2,      7,     -3,      6,     -9,      2,      2,      1,     15,    -11,      6,    -12,     -6,     -6,     -6,     -5,      4,      8,      0,      9,      5,      6,      5,     -5,     -9,      2,      8,      3,      1,     -5,     -2,     -7,     -4,      0,      5,      1,      3,     -3,     -3,     -7,      6,      1,      0,      0,      7,     -4,      1,     16,     -7,      8,      0,      7,      6,     -1,     -8,    -14,      6,      9,     -9,      6,     -2,     -7,      2,     -8,     -3,      0,     -2,      3,     21,     -2,      1,      7,     -7,     29,      3,      1,      5,     -2,     11,     -5,      9,     -1,      6,      1,     12,     -5,     -8,      6,      7,      3,      3,      1,     -9,     -7,     -5,     30,     -2,     -7,     14,     -6},
-    {   -11,      6,     10,     -7,      8,     11,     10,     -5,     -6,      4,      0,     -9,     10,      2,     -6,     -6,     -2,     -2,      1,     -3,      2,      4,     -7,     19,     -5,      3,      3,      1,     -5,      5,      2,      9,     -6,     10,      3,     -2,     20,      4,      2,    -11,      5,     16,    -10,     -5,    -10,     10,      5,      7,     21,      7,     -3,     -2,     -1,     -3,     10,      3,      0,     11,     -6,      2,     -2,      3,      7,     -3,      1,     -9,     -2,     -5,      3,     -2,      9,     -4,      9,      0,     -1,     11,     -1,      1,      0,     10,      9,      5,      1,      0,      8,      9,      3,      0,     -7,      5,     -6,      4,    -11,      5,     -1,     -2,      2,    -12,      1,      4,     -5,      1,     -4,    -10,     -1,      1,      5,     16,     -1,     -3,     -1,      4,      0,      5,     -3,      4,      7,      6,     -2,     10,      0,    -11,     -5,      4,     -9,     -1,      0,      4},
-    {     3,      9,      3,     -1,      3,      8,      4,     -1,      2,     16,    -10,      0,      2,     -1,     16,      3,     -7,      3,     11,     -1,     -4,     -9,      0,      6,     15,     10,     -6,      7,      2,     -1,     -1,     18,      7,     12,      3,      7,     -3,      5,      5,      1,     -3,     -1,     -7,      4,      7,     -5,      7,     -3,     13,     -2,     -3,     -6,     -2,      2,    -15,     11,     10,     -1,      1,      3,      0,      0,      3,     -5,      6,     -8,      0,      1,      1,     -1,      3,      7,     -3,      8,      2,     15,     -2,      3,     -3,     -1,      2,      5,      3,      5,      1,      2,      3,      0,     -4,     -3,     -8,     -2,     -6,     10,     -1,     -3,     11,     -6,      2,      5,      0,     14,     14,     -9,      4,     -4,      0,      3,      0,     -7,     -4,      3,     -1,     -1,     17,      0,     13,      5,      3,      2,      7,     -8,     -3,     12,     -6,      8,     -3,      0},
-    {    -1,      1,      5,      0,     11,     11,     -5,     -7,      3,      8,     -1,     -7,     -2,      0,     -5,     -2,     -4,      7,      5,      2,    -12,     -6,     -4,     10,     -1,      2,    -12,      4,      5,     -5,     -2,     -1,      9,      2,      1,      4,     19,    -14,      3,    -10,      2,      2,     -1,     -3,      1,     11,     -2,      6,     -3,      2,      0,     -1,      2,     -2,     -3,     -2,     11,     -2,     -2,      0,     -6,      6,     16,     -3,      2,      4,      0,     -2,      8,     -4,      1,      1,      1,      7,     -9,     11,     -1,     -2,      1,     -2,     -3,     -2,    -10,      2,     -7,      4,      3,      0,      2,     -5,      7,     -7,      2,     -3,      4,      7,      3,     -7,     -9,     12,     -6,     10,      1,    -11,      1,      0,     -4,     24,     -4,     -1,     -4,     11,      0,    -10,      0,     -3,      5,      6,     10,      3,      0,     -6,     -1,     37,      1,     -1,      1,     -7},
-    {     1,      4,     -1,     -5,      9,      3,     11,     -7,     -6,     -7,     -1,      8,      1,      1,     -6,     -1,     -5,      3,     -1,     -8,     -5,     -3,     -2,      6,      6,      1,      0,      3,      3,      1,      1,      5,     -3,      2,      0,      0,     11,     19,      1,      4,     -3,     -5,     -4,      3,     -9,     13,     -4,     -4,     -8,      4,     -8,     10,      0,     -1,     -3,      7,     -4,     19,      1,     -4,      0,      6,      6,     -2,     -3,     -3,      0,     -1,      8,     -1,     11,      8,      1,     -2,      2,     13,     -3,     -3,     -1,      7,     -1,     -3,     -6,      4,      5,      7,      4,      7,      2,     -3,     -3,     -3,     -4,     -1,      1,      0,     18,     -5,     -4,     -2,      3,     19,      2,     -9,     -4,     -1,     -9,      0,      2,     -5,      2,      5,     15,      1,      8,     -7,      0,     13,      3,      0,      3,     -3,      2,      7,     -4,      0,      5,      2},
-    {    -8,      3,     -2,     -2,      9,     12,     -5,    -10,     -5,    -10,      0,      2,      0,     -4,     -1,      0,      0,     -2,      2,     -1,    -15,      0,     14,     -8,      1,     -6,     -4,     -4,     -2,      4,      2,      8,     -3,     -3,     -3,      5,      4,      0,      2,     -5,     -2,     17,    -10,     -2,      3,     -3,      2,     10,    -13,     -2,      4,     -4,      4,     -9,     11,     -6,      3,      1,    -15,     -7,    -12,     -4,      6,     -6,      7,     -2,     -2,     -1,      5,     -3,      9,      5,      6,     15,      1,     -1,      8,      2,     -2,     -1,      2,    -12,     -4,      6,     12,     -5,     -1,      3,      0,      6,      8,     -7,      4,     -7,     -1,      5,     12,      1,      7,      6,      0,     21,     -4,     -3,      2,      4,    -14,    -14,    -13,     -7,      3,      1,     -2,      7,      2,     -8,     10,     13,     -3,     -3,     -5,     -5,      7,      9,      5,     -1,     -1,     -1},
-    {     3,      3,     -1,      1,      2,      6,     -9,    -11,      8,    -16,      5,    -16,     -3,      2,     -5,     -3,      2,     11,      1,     -5,     -7,     -3,      1,     -2,      8,     -9,      2,      2,      0,      0,     -6,     21,      2,      1,     -2,     -4,      9,     -5,     -2,     -4,    -10,     13,      7,     -8,      1,      1,     -5,     14,     -2,      8,     -2,      2,      2,     -1,      5,     10,      1,      6,      6,     -4,     -6,     -2,      5,     -4,      5,      4,     -1,     -4,      5,     -2,      5,     10,     -1,    -11,     12,     23,      1,    -15,     -3,      7,      5,     -8,     -1,     -2,      4,     10,     -8,      8,     -6,      0,      5,     -2,     -7,     -2,     -5,     10,     11,      7,      2,     -1,      0,     20,     -8,     -1,      7,      3,     -2,      6,     -4,    -11,      5,      7,     20,    -22,     -8,      4,      6,      6,      5,     13,      9,      1,      0,     11,     -2,      5,     13,      0},
-    {    -4,      5,      3,     -1,      5,      5,      4,     -3,     -3,     -8,      2,      2,     -5,     -8,    -15,      0,     -3,      2,     -9,     -4,     -3,      3,     19,     25,      6,      2,      8,      1,      9,      5,    -11,     10,     -6,     -8,      2,      1,      3,     16,     -8,     -2,      6,      8,     -8,     -9,     10,     12,     -3,      7,     -1,     -3,     -6,     -1,      0,      7,      6,     -1,     -8,      4,      8,      1,      1,      8,     -9,     -1,      7,     -7,     -2,    -11,      2,      6,     13,      9,      6,      9,      1,     35,     -7,     -2,      2,      5,     15,     -5,    -10,     -1,      7,      9,     -4,      0,      5,    -10,     -1,    -13,     -3,      7,     -9,     -3,     -7,      7,      1,      5,      2,     18,    -11,    -11,      0,      4,     -4,      2,      6,     17,      6,      8,     12,    -11,     -2,      9,     12,     -5,      2,     10,      0,    -11,     -1,     29,     -6,     -1,     -3,      8},
-    {    -2,      2,      6,      3,      6,     -9,      3,     -2,      2,     -3,     -3,     -3,     13,     -4,     -9,      7,     -6,     16,     -7,    -12,     -4,     -1,     10,     10,     13,     12,     -4,      0,     -2,     -9,     -6,      8,      0,      1,      0,      2,      8,     -6,     -1,     -6,     -7,      1,      5,     -8,      9,      4,      3,      6,      4,     13,     -1,     -5,      2,     -4,     -2,     13,     -4,      8,      3,     -1,     -8,     -4,      3,      4,      8,     -3,     -3,     -2,      9,     -6,      1,      1,      3,      1,     -3,      6,      6,      8,      2,      7,      5,      6,     -8,    -12,      3,     11,     -7,     -1,      2,     -2,     -1,      3,      6,      6,      0,      5,      5,     10,     16,     13,     -2,      7,     15,     -5,     -2,      1,     -5,    -13,     -4,     23,     -1,     -8,     13,      2,     -5,      6,     21,     -1,      1,     13,     -4,     -3,     -7,     13,      1,      3,      8,     -1},
-    {    -2,      2,      7,      4,      8,     10,      3,     -2,     -1,      2,      7,     -5,      8,     -2,     -6,      1,    -11,      7,    -10,     -5,     -7,     -3,     -4,      1,      1,      6,     -4,      8,     -1,     -6,     -5,     -9,     12,      2,     -7,      0,     11,      3,     -5,     -6,     -6,      3,     -4,      9,     -2,      1,      6,     10,     -9,      8,     -5,      6,      6,      1,      5,      4,      5,      2,      3,      2,     -7,      6,    -11,     -5,      8,     -4,     -2,     -1,      6,    -10,     10,      2,     -2,      5,     -8,     12,     -3,      9,     -7,     13,      1,     -1,      7,     -1,    -17,      7,      4,     14,      2,     -6,      4,     -6,      8,      5,      1,      4,      4,     -4,      5,      0,     -8,      3,      4,     -4,     -5,      0,    -12,     17,      4,     11,     11,      5,     13,     -1,      6,     -6,     21,      9,      6,      6,      3,      3,     14,      3,     10,      2,     -2,      0},
-    {    -6,     -1,      8,      1,      0,     -4,     -2,     -2,     -9,     -4,      2,      7,     -3,      1,    -20,     -7,     -1,     12,      4,      2,     -5,     -3,      0,     -1,     10,      9,     -1,      4,      3,     -1,     -1,     17,     -4,      5,      3,      2,     12,     -4,     -8,    -10,    -10,      1,      7,      0,      1,     -4,      1,      2,      1,      5,      9,     -2,     -4,     -4,     12,      4,     -1,      2,     -5,      2,     -7,      4,      0,      4,      6,    -18,     -1,     -6,      3,      0,      8,      7,      3,     10,     -7,     -2,     -6,      4,     -4,     -3,     -9,     -9,     -5,      5,     -8,      5,     -1,      3,      3,     -8,      0,     -5,     -3,     -1,     -4,     -1,      9,      0,      6,     10,      1,      1,     -7,     -5,      3,     -3,      0,      5,     -9,     -7,     -2,      2,      9,     -3,     23,      1,     18,      1,      1,      4,      4,     -5,     -5,     28,      6,      2,      3,     -3},
-    {     6,     -4,     -5,     -4,     17,     12,     -6,      0,      3,     -5,    -16,      4,     -3,     -6,     -9,      0,     -5,     21,     -2,     -3,     -4,     -8,      2,     21,      9,     11,     -6,     -1,     -2,     -8,     -7,      8,     -1,      4,     -1,      2,      6,      7,     -2,     -8,     -7,     -1,      0,     -6,      3,     -2,      8,     15,     -6,     11,      5,      5,     -7,     -3,      6,     -2,      2,     -3,      2,     -5,     -9,      6,    -11,     -3,     -3,     -3,      1,     -4,      8,     -5,      0,      9,      6,      4,     -2,     29,      1,      4,     -4,     -2,      7,      6,     -1,      8,     13,     -1,      2,      2,     -3,      0,      0,      1,      5,      0,     -8,     10,     21,      5,     -9,      2,      9,     30,      0,     -8,     -8,     -4,     -3,      2,      3,     13,      7,      8,      9,     -2,      5,     12,     17,     -7,      4,    -12,     -3,     -1,     -2,     27,     -5,      7,      1,     -2},
-    {    -6,      2,      0,     -3,      7,     11,      8,     -6,     -7,     -1,     -3,     -7,     13,     -3,     -7,     -2,      1,     19,      1,      2,     -4,      3,      6,      7,      3,      1,     -4,     -1,      6,    -14,      1,      4,     -9,      9,      0,      1,     -5,     -4,      2,    -12,    -18,      3,     -8,      1,      3,     20,     -2,      5,      2,      1,     14,      0,     -2,     -7,     -2,      8,      5,     10,      3,     -7,    -11,      9,      8,     -6,      3,      3,     -1,      3,      4,     -7,      5,     10,      4,      8,      0,     20,      3,     -6,      1,      8,     -6,     -3,      0,     -7,     -1,     -2,     -1,     -7,      8,     -5,      8,     -9,     -6,      3,     -1,      4,     12,     -5,     -3,     12,     -6,      8,      2,     -6,      7,     -4,    -10,     11,      4,      8,      1,      5,      0,     -4,     13,    -13,     -6,      4,      8,     10,     -2,      7,      7,     15,    -12,      1,      2,     -2},
-    {     0,      0,     -5,      2,     12,      7,     12,     -3,     -4,      1,      2,     -8,     -3,      4,    -18,      0,    -10,      7,     -2,     -7,    -10,     -2,      1,     -1,      6,     11,      2,      7,     -1,     -2,     -2,      2,     -7,      5,      0,      7,     -4,    -13,     -4,     -1,    -14,     -6,     -5,      0,      7,      9,    -13,    -10,     -7,      7,      7,      1,     -7,     -2,      2,      8,      0,     13,     -5,     -5,     -6,      4,      8,     -6,      3,      4,    -10,     -3,      0,    -15,      5,      6,     -6,     12,     -8,     -2,     -3,      5,      3,      6,     -3,    -12,     -1,     10,      2,      1,      9,     12,      5,      5,      3,      4,      2,      2,      5,      5,     11,      1,     -7,     -1,     -2,     -7,     -1,     -6,      6,     -8,     -4,     25,     -1,      7,     -2,     -6,     -3,    -10,      7,      9,     -3,     11,      2,     -8,      7,     -6,      3,     19,     -2,      0,     11,     12},
-    {    -4,     -3,     15,      4,     -2,      6,     -2,     -5,     -7,      0,     -8,     -6,     11,     -8,    -18,     -2,     -2,     17,     14,      1,      1,    -11,      3,     25,     -3,     -5,     -1,      6,     -1,     -9,     -7,     12,      1,     -6,     -7,     -1,      1,     14,     -6,      0,    -16,      7,     -1,     -4,     21,     10,      3,      7,     13,      0,      0,     -4,      2,      2,     10,     -5,      2,      6,      9,      9,     -2,      7,      3,     -3,      8,      2,     -4,     -9,     -3,     -8,      8,      3,      1,      8,     10,     42,     -5,    -10,      0,     14,      7,     -1,     -2,     12,      2,     11,      2,      8,     -1,    -11,     -4,     -1,     -5,      5,     -3,      9,      5,      4,      8,      3,      5,     -7,     -4,    -11,      0,     12,     -1,      8,     13,      4,      8,      0,     10,     -3,      6,      6,      6,      1,      6,      3,     -3,      3,      0,     22,     -5,     -5,      4,      3},
-    {    -2,      3,     -5,      5,      9,     11,      1,     -5,      0,      0,     -3,     -5,      6,      8,    -14,     -6,     -1,      1,      7,    -11,      3,      0,      2,     -1,      6,      9,    -10,      2,      9,     14,      6,      2,    -12,      4,     -4,      0,     11,    -12,      3,     -3,      2,      7,     -8,      2,    -14,      2,     -1,     12,     -4,     11,     -2,      4,     -7,      6,      4,     -5,      6,      9,      6,     -6,      3,      1,     12,    -10,      6,     -2,     -8,     -1,     17,    -11,      9,      9,     11,     19,     -1,     22,      6,      2,      5,     -3,     13,     -4,    -15,     -2,     10,      7,     -4,     -5,     -4,    -20,      3,     -9,      0,     -8,     -9,      8,     14,      0,     10,      8,     -3,      9,      5,    -11,     -3,     -3,     -2,     14,      6,     12,      8,     -2,     13,     -5,     -5,      2,     -4,      4,      1,     11,     10,     -4,      4,     32,    -13,     -1,      7,      3},
-    {     0,     -2,      7,     -6,     13,      7,      5,      4,     -1,      6,      2,      0,     10,      1,     -7,      5,     -3,      7,     -6,    -16,     -6,     -6,     14,     25,      5,      4,     -1,      6,      0,    -12,     -2,      6,     -6,    -12,      3,      0,      1,    -10,     -1,     11,     -6,      1,     -6,     -3,     -7,     14,      4,      0,     -4,      9,     -1,      0,     -3,     -5,     19,     12,      0,     -5,     -1,      6,     -9,      7,      6,     -8,      3,     -5,     -4,     -1,      6,    -11,     10,     13,      9,     -8,      1,     24,      2,      9,     -2,      5,      7,      0,     -5,     -1,      0,     -9,    -10,      3,     -6,     -6,     -3,     -1,      6,      0,     -4,      4,     12,      4,     -6,      6,    -13,     20,     -4,      2,     -5,      0,     -2,     16,     -4,    -13,      9,      2,     12,     12,     -4,      6,     12,      3,      1,      9,      2,     -7,      6,     20,    -10,      3,      2,     -2},
-    {     2,     -2,      4,     -7,     12,     -5,      3,      2,     -2,     -3,      0,     -1,      8,     -9,    -15,     -1,     -7,     18,     -8,      0,    -18,    -10,      3,     15,     11,     -2,      6,     -1,      2,      0,      6,     17,      4,     11,     12,     -6,     13,     -6,     -5,    -17,     -6,      6,      1,     -6,      8,      2,     -7,     14,     -5,      4,      7,      5,     -6,      8,      3,      2,      7,      7,     16,      3,    -11,      6,      3,      0,      0,     -1,      1,     -3,      7,     -7,     15,     -3,     12,      2,     -3,     29,     -6,      1,      3,      0,     10,     -3,    -13,     -1,     19,     14,     -1,      6,      3,     -8,      4,      0,      2,     -1,      2,      4,     11,      6,      0,     16,      7,     15,      9,    -16,      3,     -8,     -1,      5,      6,      0,     -4,      1,     13,     -1,     11,     -2,     12,     -5,      5,      4,     -7,     10,      1,     16,     -2,     -4,     -3,     -8},
-    {    -5,     -3,      1,      1,      6,     11,     10,     -1,     -1,     -6,      3,     -5,      5,      1,     -9,     -6,    -12,     12,      2,      1,     -5,     -7,      2,    -10,     -5,      6,      3,     -5,     -4,     -3,      7,      7,     -3,     -3,     -1,      6,     16,    -20,     -2,     -2,     -7,     13,     -4,     -1,     22,     13,     -2,     11,      0,     14,      3,      2,     -6,      3,      2,      3,     18,      4,     11,    -11,     -8,      2,      5,     -7,      3,      2,     -4,     -3,      3,     -1,     10,    -10,      3,      8,     11,     23,    -10,      5,     -7,     -6,      9,     -5,      0,     14,     19,     16,     -7,     -6,      3,      4,     -6,      6,      0,     14,      1,      6,     10,     -7,      4,      4,      5,     35,     -1,    -10,     -4,      4,      0,     20,     -1,      1,     -1,      8,      3,      5,      3,      6,      9,      8,     -3,      0,     -5,      2,      5,     21,     -4,      3,     -6,      3},
-    {    -4,      2,      6,      6,     10,      8,     -2,      0,     -1,    -10,     -6,      2,      1,      6,    -10,     -4,     -6,      1,      3,     -6,     -9,     -5,    -10,     33,      6,    -10,     -8,      1,     11,      2,      7,     16,     -6,     -5,     -1,      7,     15,      5,      1,      0,    -13,      4,     -6,      2,     -2,      6,      1,     17,      2,     11,     10,     -2,     -7,     -8,      6,     10,     -7,     -7,     -1,     -3,    -15,     -6,     -2,    -12,      1,     -9,      2,     -4,     19,    -14,      8,      8,     -5,      0,     -4,     30,    -11,     -5,     -7,      9,    -12,     -7,      0,     -6,    -11,     14,    -11,    -11,     10,      2,      8,      0,    -10,     -8,      3,      0,     -1,      6,      1,      2,    -11,     15,     -3,     10,      2,    -10,     12,    -12,     -5,      6,     -7,      8,     24,      3,     10,      0,     11,     24,     -1,      6,     17,     -3,      4,     22,     -1,      1,      2,      2},
-    {    -5,     -2,      8,      8,      3,     13,      0,     -5,     -3,      9,      3,      4,      9,      7,    -13,      8,     -3,     12,      9,     -8,    -10,    -12,      0,    -11,      5,     -5,      2,      4,      3,      9,      2,     23,      4,     -2,      0,      5,     -5,    -24,     -3,     -7,     -6,     -1,      5,      4,      9,     -6,     -4,     21,      7,      4,     -9,      6,    -12,     -5,      4,      2,     -1,     -5,      0,      1,      2,     11,     13,     -3,     15,    -10,     -8,      2,     13,    -15,    -11,      4,      3,      3,      2,      5,      1,     12,      2,      0,      2,      1,      4,      6,     10,      9,     -6,     13,      5,     -1,      9,     -1,      0,     -2,     -4,     -7,     21,     -5,      7,     10,     -1,     25,    -11,     -8,    -10,     10,      5,      4,     -5,      3,      1,     21,     -5,      6,      8,      0,     -8,      0,      1,      4,      7,     -2,      2,      6,     -8,     -6,      3,      4},
-    {     6,      7,      5,      0,     17,      0,     10,     -3,      1,      3,     -1,     -6,     16,      2,     -9,     -1,    -12,      7,      0,     -7,    -10,     -2,     -5,      4,      0,      3,     -1,      4,      5,      7,     -8,     15,      4,      2,      4,     11,      9,      5,     -3,      0,     -6,      3,     -6,     -3,      2,     -4,     -2,     13,     -1,     -1,      4,      4,     -2,     -3,     -1,     -1,     -6,     16,     -1,      3,    -14,     15,      2,     -6,      3,      2,     -4,     -6,      6,      1,      1,     -5,     -4,     -4,      1,     12,      0,      3,     -2,     -6,    -11,    -11,      3,      6,     14,      8,      7,      1,     -8,     -5,      5,     -3,     -3,     11,     -6,      7,      2,      1,      1,      2,      6,      4,      5,     -6,      6,     -2,     -1,    -14,     13,     16,      0,     -1,      8,      4,      2,    -14,      8,     -4,      0,      5,     -1,      8,      7,      2,     -6,      7,      4,     11},
-    {   -12,     11,      2,     -3,     19,      7,     11,      2,     -4,      6,     10,      3,      1,     -2,    -19,     -9,    -10,     15,      0,     -8,     -4,    -13,     -4,     10,     -3,     18,     -3,      3,     -6,      8,     10,      0,    -12,      4,      3,     11,     20,      6,      2,      2,    -13,      6,      2,      4,     11,     13,      2,      7,     -4,     16,      8,      2,    -10,      1,     -1,     -9,      5,      9,      8,     -3,     -9,      7,      4,     -2,      4,     -4,     -3,     -5,     10,    -10,     11,     -2,      1,     -1,      2,     21,      3,      7,      3,     -3,     10,      3,     -1,      5,      5,      4,      1,      0,      5,      1,      2,      2,     -1,     -4,     -4,     -1,     22,      9,      4,     13,     -5,     10,     -1,     -8,      0,      4,      2,     11,     -6,     17,      3,      5,     21,     -2,      8,      4,      6,     10,     -3,     -5,      1,      4,     16,     18,      0,      1,      3,     12},
-    {     1,      2,      5,      6,      9,      7,     -1,     -9,      1,      6,     -7,     -7,      5,     -7,    -11,      1,     -7,      3,      5,      5,     -6,     -4,      7,     20,      4,     -5,     -7,      2,    -10,     10,    -12,     19,    -16,      2,     10,      6,      1,     -2,    -12,     -7,    -14,     -3,     -7,     -6,     11,     11,      5,     -3,     -8,      9,    -10,     -4,     -6,     -1,      1,     -5,      1,     14,     20,     -4,    -18,      5,     16,     -7,      9,     -5,    -12,     -2,      8,     -7,      9,      7,      4,      1,     -5,     25,     -2,     21,     -3,     -8,    -14,     -9,    -13,     -2,      2,      3,     -4,      1,      2,      5,      5,      8,      1,     -1,     -6,      4,      6,     -1,      4,     10,     -5,     22,      9,     -2,      5,      8,     -3,    -15,      0,      4,      4,      9,      4,      2,      0,     22,     -7,     -6,      2,     -4,      2,     -9,      2,     11,     -3,      8,      3,      9},
-    {     2,     -1,     10,      1,     12,     19,      4,     -9,      2,    -15,      5,     -2,      3,      3,     -5,     -3,     -3,      1,     -2,     -7,    -10,      7,     -6,      0,     22,    -12,     -6,     10,      9,    -11,      9,     23,    -19,    -14,     11,      2,      1,    -10,     10,     -2,     -5,     10,     -3,      4,     -7,      6,      2,     14,     -3,     -5,     -7,     -5,      2,      6,      3,      1,     15,      5,      9,     -2,     -5,     14,      3,     -4,     -5,     -2,     12,     -5,      1,     -6,     13,     -1,      5,     -1,      5,    -10,     -7,      1,      1,     -1,     16,     -3,    -11,     -6,     -1,      3,     -5,     10,      8,     -5,     13,     -1,     -1,     17,      4,      3,      6,     -3,      8,     -3,      8,     11,     -3,     -7,      6,     12,     -4,     18,     -3,    -15,     -5,      5,      9,     -1,      4,      0,      4,      7,     -4,      2,     19,    -12,     -2,     18,     -4,      1,      2,    -10},
-    {     3,      9,      5,      3,     13,      9,      9,     -4,     -2,      5,     -1,      2,      9,      7,     -8,     -5,      3,     16,      3,     -1,      0,      1,    -16,     14,      7,     -7,     -7,     -7,     16,     -3,     12,      9,     10,      3,      8,      5,     21,      2,    -13,     -5,     -9,     20,     -8,      4,      1,      5,      2,      1,      4,      6,     -3,     -6,      6,      3,      0,      4,     30,     -1,     13,      3,     -7,      8,      2,    -11,      0,     -5,      3,    -15,     11,    -11,      5,     -2,      4,     13,    -11,     15,     -3,      1,     -1,     -2,      8,    -18,     -3,     -7,     16,      6,      3,      1,      1,     -5,     -1,    -10,     10,      6,      3,      0,     -4,      2,      5,      8,     -5,     11,      2,     -7,      5,     -6,     -4,      5,      2,     -1,      0,     16,     -2,      4,      8,     -3,     20,     10,     -2,     -4,      7,     -5,      3,     20,     -3,      3,      3,     -5},
-    {    -1,      4,      8,     -1,     21,     -5,      2,     -4,     -7,      0,     -2,      3,      4,      3,     -5,      0,     -5,     -6,      9,    -10,      3,     -9,     -1,      8,      1,     -2,      4,     -6,    -11,     -6,     17,      1,      2,      0,     10,      5,      7,     19,     -4,     -4,     -3,      5,     -6,     10,     -4,      1,     -8,      7,      1,      9,      1,     -9,     -5,     -1,      4,     -2,     -4,      2,      1,      0,     -3,      7,     -7,     -1,     11,      0,      1,    -11,     11,    -10,      1,      7,     -1,      9,     -1,      3,     -6,      0,      6,    -10,      2,      2,      7,      6,      4,      1,     -6,      8,      6,     -6,     -2,     -8,      2,     -1,      3,     -3,      5,    -14,      3,      6,      2,     26,      4,    -18,      5,     -2,      2,      2,    -11,      0,      2,      5,     23,      5,      6,     14,    -12,     11,      4,     -5,      4,      3,      6,      7,     -9,      0,     13,      4},
-    {     1,      4,      2,      3,      4,      3,      7,      0,     -2,     -4,      7,      2,      2,      7,     -6,      1,      9,      3,     -4,     -1,     -7,     -1,      7,     14,      2,     -1,     -7,      6,     -4,      7,      1,     26,     -4,     -2,      0,      3,      0,      8,     -6,    -12,     -7,      6,    -11,     -1,     -6,      4,     -2,      4,    -13,     -3,      0,     -6,     -6,    -10,      8,     -5,    -12,      9,     -5,      5,      1,      1,      8,     -2,     -1,     -5,      2,     -7,      8,     -6,      2,     11,      6,     -4,     -2,     11,     12,     -3,      0,     -1,     15,    -19,    -15,     -1,     -5,      9,     -6,     13,      1,     -9,      4,     -6,      1,    -10,      8,      3,      8,      2,      5,      1,      4,     23,      0,    -12,     -5,     -6,     -3,      8,      4,      7,     -8,      4,     -5,      2,     -1,      4,     10,     -9,     -3,      1,      7,     -5,      9,     22,    -11,     -3,      2,      1},
-    {   -13,      3,      6,      1,      5,      5,     -2,    -12,    -10,      5,     -1,      7,      8,     -8,     -3,     -2,    -12,      3,     -5,    -19,     -1,      1,     11,     10,      2,      2,      3,      7,     -2,      6,     -1,     20,      2,      3,      3,      8,     13,     13,    -10,    -10,      6,      3,      3,      0,      7,     -2,     -6,      9,      6,     12,    -14,      0,     -6,      4,     14,      3,     -9,      5,     -7,      6,     -5,      4,     -1,    -13,     -2,      1,     -6,     -8,     12,    -11,     -1,      4,      2,     -2,     -4,     10,     -3,      9,      5,      3,     -1,    -11,     -7,      8,     19,      3,      8,     11,      0,    -11,     -1,     -4,      2,     -1,    -14,      2,      2,      2,      7,      9,      2,     12,      6,     -4,      5,     -2,    -12,      7,      1,      6,      1,     -1,     12,     -2,      3,      9,      5,     -8,     -9,     -1,      7,     -5,      3,      9,     -3,      1,      6,      3},
-    {     4,     -3,     19,     -3,     15,     -9,      2,     -1,     -7,      3,      3,     -7,      3,      5,     -5,     -3,     -1,      2,     -5,     -2,    -16,     -1,     -8,     23,      1,     -3,     -8,     -6,      0,     -5,     -4,      4,     -7,      3,     -3,      8,      4,      3,      4,      4,      1,      0,     -4,     -1,     -7,      6,      5,      7,     -2,     13,     -5,     10,      5,      3,     17,      2,      4,      0,     -4,      1,     -9,      5,     11,     -6,      1,      4,      1,     -7,     10,     -3,     15,     -1,      8,     11,     -2,     22,     -4,     10,      1,      3,      8,     -7,     -1,     -6,     18,     11,     -5,      0,     -5,      2,      2,      8,      5,      2,     -1,     13,     11,      1,      0,      3,      0,      7,      7,      0,      8,      2,     -9,     18,     -4,    -21,      4,     11,     16,      7,      3,      0,      1,      0,      2,      5,     -2,     -7,     -3,     15,     -3,      8,     12,      2},
-    {    -8,    -11,     12,     -3,     25,      7,      0,     -4,      4,      0,      9,     -2,      1,     -1,      4,     -3,     -8,     11,      9,    -12,     -9,     -4,     10,     -4,      6,      4,      1,      4,      1,      7,      1,     11,    -17,    -17,      9,      6,     12,     -6,     -8,     -4,     -2,     10,     -8,     -1,      0,      7,      4,     22,     -1,     -3,      0,      5,      1,      6,     11,     -1,     -9,     -3,      9,     -4,     -1,      9,      9,      5,      5,     -8,      7,    -11,      2,     -7,      5,     -1,     -1,      8,     -5,     14,      0,      3,      6,     11,      8,    -13,     -3,    -12,     12,     16,      4,      1,      5,     -5,     -2,      8,     -7,     13,     -6,     16,      4,     -6,     14,      1,      6,     10,      4,    -11,      9,     -3,      5,     14,      8,      7,      6,      4,     21,     -2,     -6,     14,     -3,     10,      6,     10,      5,      4,      4,     41,    -14,      8,     -3,      2},
-    {     8,      5,      5,      5,      5,      2,      2,     -6,      7,     -8,     -6,      3,     11,      9,     -2,      6,      3,      0,     -5,      6,     -8,    -11,     -3,     -7,     14,     13,     -1,      1,      3,     -8,      4,      9,    -13,     -2,      7,     11,      6,      3,      1,      0,     -3,      7,      1,    -12,     15,     15,      5,     11,      3,     14,      1,      4,     -5,     13,     -4,      3,     10,     11,     22,     -5,      4,      7,     11,     -7,     12,      0,    -10,     -3,     12,    -10,     14,      6,      2,     -5,     -9,     30,    -12,     14,      8,      5,      6,     -7,     -6,     -1,      2,      7,      1,     10,     -7,     -1,      2,     -4,      0,    -12,      0,     -3,      8,      2,     11,      7,     -5,     11,      7,     -2,      7,    -17,     -6,     15,      3,      4,      4,      2,      8,      2,      3,      9,      6,      1,     15,      7,      6,      2,      8,     20,    -14,     -9,      5,     -1},
-    {     4,      0,      6,      1,     -3,      0,     -2,     -2,     -1,     -1,     -1,     -5,      1,     -2,     -1,     -2,     -1,      1,      1,      0,     -2,     -2,      2,      1,     -2,     -1,     -3,      0,     -3,      0,      1,      1,     -1,      4,     -3,     -3,      0,      2,     -1,      0,     -3,      2,      1,      3,      1,      1,      2,      0,      7,      0,     -1,     -4,     -2,      1,      3,     -3,      1,      2,      0,     -3,     -1,      1,      2,     -2,     -3,     -2,     -1,     -3,      1,     -2,      4,     -2,      3,      3,     -1,      1,      3,      0,      0,     -5,      0,     -6,     -5,      5,      5,      0,      4,      2,      1,     -3,      3,     -4,     -3,     -2,     -2,      0,      1,      8,      8,      0,      0,      1,     -2,      1,     -3,      0,     -4,     -1,      8,     -3,      0,      1,      0,      1,     -2,      2,      1,      0,      2,      3,      1,     -4,      0,      0,     -1,      0,      1,      2},
-    {    -8,      2,      6,      6,      3,      1,     10,      1,     -4,     -7,     -3,      2,      0,      4,     -3,     -1,     -1,     10,      4,      1,    -10,     -8,      4,     12,     10,      3,     -3,      0,     11,     10,      3,      4,     -3,     14,      8,      6,     14,      6,     -4,     -5,    -14,     -5,     -6,     -6,      0,     -2,     -1,     11,      4,     10,     -8,     -1,     -2,      2,     -5,      4,     10,      8,      4,     -8,     -3,      3,      0,     -6,      1,    -14,     -2,     -9,     16,    -11,      6,      3,      9,      7,      7,     11,     -1,     -3,     -6,      2,      5,     -6,     -6,     -2,    -11,      5,     -5,     -5,      2,     -6,     -1,      4,      0,     -4,     -6,      5,     -3,      8,      4,     -5,     -1,      8,      2,      0,     -1,     -3,     15,     11,      2,     -7,      1,     -2,     16,      0,     -7,     15,      4,      1,      9,     -9,      3,     -2,     11,     11,     -6,     -7,      7,      0},
-    {     2,     -2,      3,      5,      6,     -9,     -3,     -8,      2,    -11,     11,     -5,      9,      0,     -7,     -4,     -8,      7,      9,     -6,    -11,     -3,      3,    -13,      7,      2,     -4,     -9,    -10,      0,     -5,     19,     -2,     12,      1,      5,      7,    -14,     -6,     -1,     -4,     12,     -1,     -8,     10,     12,     -2,     10,    -24,     13,     -2,     -5,     -5,      4,     12,     10,      6,      7,     10,     -7,    -10,      8,     12,     -4,      0,     -6,     -3,      1,     17,    -10,      5,      4,     15,      4,     -2,      9,      0,      1,     -3,     -3,      9,      2,     -3,    -11,      7,      6,      0,      1,     12,     -6,    -11,     -6,     -4,      6,     -7,     11,      7,     10,      3,     -2,      1,     21,     -6,     -4,      5,     -3,      3,      7,      4,      6,     -3,     -5,     18,      6,      8,      4,     -5,      1,      7,     -3,      7,     -3,     15,      5,    -11,     -1,     -6,     -4},
-    {   -11,      4,      2,      4,      9,     -7,     -8,      2,     -8,      1,     -7,      4,    -10,      2,     -5,     -1,     -7,     13,     -3,     -4,     -5,     12,     -2,     26,      8,      0,    -12,     15,    -14,     -1,      0,     22,     -3,    -10,      8,     -5,     12,     -3,      2,     -4,      1,      9,    -14,     -9,      5,     20,      8,     20,      6,     11,     -9,     -1,      0,      1,    -11,      7,     -1,      3,      4,     -1,     -8,     12,     -5,     -7,     -4,    -10,    -10,    -19,     17,     -4,      7,      8,      4,     -1,    -10,     22,     -3,      8,      4,      0,     11,     -5,     -6,     11,      1,     -3,      1,     11,      7,    -15,     -8,     -7,      2,    -11,     -9,      7,      5,      4,      4,     -3,      0,     11,      4,     -3,     -4,      1,     -1,     12,      7,      4,      3,     -1,      1,     -3,    -10,      4,      9,      5,     10,      1,     10,     -7,     11,     13,      3,     -2,      8,      1},
-    {     0,     13,     -1,     10,     14,     -6,      2,     -2,      1,      2,     -2,     -7,     -3,     -1,    -10,     -2,     -4,     14,      4,      2,     -4,     -9,      9,      4,     -1,     12,     -7,      7,     11,     -8,      6,      5,     -7,     -3,    -11,      0,      8,      0,      4,     -4,    -14,     11,      1,     -2,     12,      4,      6,     26,      7,     -4,    -10,    -15,     -3,     -1,     -8,     -2,      7,     -2,      7,     -1,    -15,     -3,      7,     -3,      1,      1,      4,     -9,     10,     -3,      0,      4,     11,      4,     -4,     -5,     13,     -6,      4,      4,     -4,     -2,     -6,     -3,     18,      5,     -4,      4,      7,    -12,     -3,     -9,      5,     -6,      2,     17,      6,      2,     14,     10,    -12,     21,      0,     -7,      1,     -4,     -4,     11,      8,     11,      0,     26,      9,     -4,     16,     21,     18,     -6,     -8,      0,     17,     -6,      4,     23,      0,     -5,      1,     -3},
-    {     1,      8,      9,      6,     18,      1,     -3,     -6,     -6,      2,     13,     -8,     -1,     -2,    -13,    -12,     -3,     22,      4,     -3,    -10,     -7,     -7,     10,     10,     -4,     -3,      9,     -4,    -12,      2,      7,    -19,     -3,      9,      2,      9,    -22,     -8,      1,     -2,     -3,    -13,     -6,     -3,     12,     -4,      2,    -12,    -14,     -3,     -9,     -9,      6,    -10,      4,      2,      0,     -7,     -4,      5,      6,      2,     -7,      2,     -5,     -2,     -9,     12,     -6,      2,     -6,     -2,     -8,    -10,     24,     -5,      7,      9,     -1,     -8,     -8,     -7,      2,      7,      1,     10,     11,     -1,     -3,     -6,      0,     -4,     -6,     -4,      4,     13,     -1,     -4,      4,      4,     26,     -1,    -10,      2,     -3,     -6,     15,      9,     -2,     -4,      5,      9,     11,      3,      8,     17,     18,      3,      0,      1,      0,      4,     19,     -7,     -5,      1,    -10},
-    {   -12,     -3,      9,     -3,      3,     -7,    -13,     -6,     -2,      2,      0,      2,     -1,      7,      1,     -3,     -3,     -2,      0,      1,      3,     -3,     -5,      6,     -1,      6,     -9,      8,      3,      1,      1,     14,    -11,      1,     -6,      0,      8,      1,     -4,     -8,     -3,      2,      9,     -1,     -4,     -3,     -3,     -1,      3,     16,     -2,      0,     -5,      0,     16,      7,     -1,      4,     10,     -5,     -8,     10,      4,     -4,     -1,     -6,     -7,     -5,     10,     -1,      0,      0,      7,      6,      7,     50,      4,      9,      9,      2,      8,    -14,     -8,      2,     -2,     -1,     -1,      1,      8,      2,     -3,     -6,     -3,    -19,      0,     -5,     16,      1,     -1,      2,     -9,      0,      6,      0,      5,      3,    -14,     11,     -5,    -10,      7,      7,     10,     -8,     10,     15,     -1,     -2,      1,      1,     11,     -3,     -2,     11,     -1,      1,      9,      2},
-    {     5,     -3,      0,      1,     21,      6,     -6,      2,     -4,     -3,     -1,      0,      3,      3,     -6,     -2,     -5,     -3,      5,     -7,     -7,     -6,      4,      7,      3,     11,     12,     -4,      1,    -18,     -5,    -12,    -20,      9,     14,     -2,      6,    -10,      5,     -5,      4,      8,     -3,     -6,      4,     16,     11,      8,     -4,     11,      1,      3,     -4,    -15,      8,      6,    -11,      1,      9,     -6,     -8,     -1,     -1,     -7,     -2,     -3,     -4,     -2,      0,      8,     -2,      1,     -2,     -1,     -8,     28,     -6,     13,      5,      1,      5,      5,     -4,     -4,     -8,     -3,     -2,     -1,      2,     -8,      1,     -2,     -4,      3,      5,      6,     -5,      6,     -8,     14,     -3,      8,    -17,     -5,     -1,      1,      0,      5,     -6,      6,      0,      0,      1,      4,    -12,      4,     -3,     -2,      5,     -3,      8,     -2,      2,      6,      0,      2,      7,      1}
-};
-
-static const int16_t nnue_b1[128] = {
-      -251,   -179,    -74,   -244,    112,    -56,   -217,     61, 
-      -236,   -252,   -229,   -251,   -250,   -187,    146,   -171, 
-      -172,   -146,   -249,    167,    -78,    146,   -167,   -143, 
-       -93,   -245,     98,     21,   -235,     57,    192,    126, 
-       -72,    -88,    102,   -101,    189,   -248,     -1,   -213, 
-      -220,    141,    -75,   -237,   -225,    -72,   -131,   -158, 
-      -106,   -200,    -55,    -26,   -159,   -235,   -245,     69, 
-      -179,    123,    254,   -239,     72,   -229,   -132,    -79, 
-       -69,      4,   -199,     28,    -81,   -227,   -243,    -40, 
-       211,   -110,    -55,    248,   -252,    -75,   -231,     52, 
-      -227,    133,   -185,   -158,     -3,   -251,    -76,     47, 
-       -22,    -86,     -8,   -236,    -75,   -107,    193,     23, 
-       -59,   -239,   -191,   -240,   -231,      8,   -174,    -33, 
-      -246,   -238,   -253,     -2,   -251,   -163,    -71,   -147, 
-       196,   -251,    -86,    242,   -102,    -48,   -216,    198, 
-       -29,   -108,     89,    117,    -71,   -247,   -240,    -28
-};
-
-static const int16_t nnue_w2[128][64] = {
-    {    -4,      8,      4,      0,      7,     -5,      4,      9,    -12,     -9,    -10,    -20,      3,     -4,      0,     -2,     -3,     -4,      8,    -13,     -1,     -5,     -9,     -5,     -6,    -11,      9,    -12,      5,     -4,     -8,      1,     -4,      2,     22,     -2,     -6,      5,      7,     -2,    -11,      2,      1,      5,      9,     -5,     -1,     -4,      0,    -11,      7,     -1,    -11,      0,     -4,      8,     19,      9,      8,     -5,      2,     -7,     10,      2},
-    {     2,     -5,     -1,     -1,      3,      3,     -6,     -4,      0,     -6,      4,    -10,      2,     -7,     -3,      0,     -2,     -8,      1,      0,     -4,     -4,     -2,     -8,     -1,     -7,      9,     -3,     -6,     -5,     -9,      0,     -3,     -1,      2,     -7,      2,     -7,     -2,     -8,     -4,     -1,      2,      5,      1,      0,     -2,     -5,     -2,     -1,      2,      2,      0,      1,      4,      5,      2,      4,      5,      2,      0,      0,      3,     -6},
-    {     3,     -4,     -7,     -6,      3,     -3,     -2,     -3,     -4,     -2,    -10,     -1,     -1,      1,     -2,    -10,     -3,     -3,     -2,     -8,      3,      2,     -3,     -6,      2,     -8,      8,    -12,     -3,     -1,     -2,      7,      4,     -5,     -3,     -3,     10,      0,     -5,    -15,     -3,     -2,      4,     -1,      3,      4,      2,     -1,     -8,     -6,      0,      0,     -9,      3,     -2,     -7,     -3,      1,     -7,     -5,      9,     -5,      3,      4},
-    {     0,     -4,     -2,     -3,     -4,     -1,     -6,     -2,     -7,    -12,    -11,    -10,     -3,     -4,     -3,     -1,     -5,     -8,      3,    -10,     -4,     -5,    -10,     -2,      3,     -9,     -3,     -6,     -1,     -1,      6,      0,     -2,      2,     -3,     -2,      1,     -1,      1,     -3,     -1,      4,      1,      3,     -1,     -4,      6,      6,     -3,      4,      5,      1,     -8,     -2,      0,     -9,      0,     -5,     -4,     -1,     -5,      3,      1,      4},
-    {    -6,     -6,      5,     -8,     -4,     -4,    -16,    -12,     -1,      1,     -7,     -6,    -14,     -9,    -17,     -7,     -8,      2,     -3,     -8,     -5,      0,    -11,     -7,    -19,      1,     -6,     -8,     -5,      1,      3,      7,     -8,     -4,      0,    -18,      9,      8,     -7,     -3,     -7,    -16,    -11,      0,     -2,     -4,      2,     -1,     -5,      5,     -1,      0,     -8,     -3,      5,    -13,      1,     -1,    -10,     -4,      4,    -13,     -2,     -2},
-    {     3,     -4,     -3,     -7,      2,      2,      0,     -5,      0,     -6,     -3,    -10,     -8,    -12,      0,     -2,     -3,    -11,     -8,     -6,     10,     -6,     -4,     -5,     -2,     -7,      6,     -5,      4,      0,    -10,     -8,     -1,      1,     -5,    -13,      2,     -5,     -6,     -2,     -7,     -3,     -4,     -1,      1,     -9,     -5,      0,      0,      0,     -1,     -1,     -2,      0,     -3,     -8,     -6,     -1,     -5,     -3,     -3,     -3,      0,     -2},
-    {    -3,      2,      0,    -14,     -3,     -1,     -4,     -7,     -1,     -3,     -1,     -9,      6,      2,      2,     -1,     -2,     -6,     -4,     -5,     -6,     -2,    -19,    -11,    -15,     -6,      0,    -13,      4,     -2,      6,     -4,      5,     -3,     -6,    -12,      5,     -1,      4,     -8,     -3,     -3,      4,     -4,      2,      3,     -1,     -4,     -6,      1,     -7,      4,    -12,     -9,      0,     -5,     -9,      7,     -6,     -2,     -1,     -2,      2,      1},
-    {     2,     -4,     -3,      2,      5,    -10,     -6,    -11,     -4,    -10,     -4,     -5,      1,      2,      8,     -5,     -4,      0,      8,     -1,      0,      2,     -3,     -2,      0,      4,     -3,     -7,     -3,     -3,      3,      8,      1,     -5,     -2,     -7,      0,     -6,      5,    -11,     -8,     -2,      0,     -2,      3,     -3,      1,     -4,     -1,      1,      1,      1,     -8,     -1,      9,     -8,      4,      2,     -1,      2,      0,     -6,      8,     -5},
-    {    -3,     -1,      5,     -6,      4,      8,      2,      4,     -2,      0,     -4,     -8,     -8,     -4,     -4,     -5,     -5,     -4,      4,     -5,      5,      1,      4,     -8,     -6,      0,     -2,     -7,     -2,     -2,      4,      4,     -4,     -7,     -1,      7,      7,     -3,      2,      7,     -6,      2,     11,     -5,      5,     -9,      7,     -8,      1,    -10,     -3,     -1,     -1,     -7,     -3,    -12,      2,      7,      4,     -1,      4,     -6,      1,     -2},
-    {     1,     -7,      0,     -5,      2,      4,     -9,      2,      5,     -2,     -1,     -6,     -9,      2,     -6,      1,     -7,     -4,     -8,      3,      1,     -4,     -4,     -9,     -3,     -5,     -3,     -8,     -6,      6,     -4,      0,     -3,     -8,     -1,      1,     -5,      3,      1,     -5,     -7,     -6,     -7,     -3,      7,      0,      2,     -7,     -4,     -6,      3,      1,     -7,     -8,      4,     -2,    -12,      8,      5,      4,      3,     -9,     -9,     -4},
-    {    -3,      0,      3,     -3,      1,     -2,     -2,     10,     -5,     -8,     -9,     -7,     -1,     -6,      1,      0,     -3,     -5,      1,      5,     -2,     -3,    -10,      6,     -4,     -7,     -9,     -9,     -1,     -3,      1,     -1,      0,      2,      0,      2,     -3,      5,      7,     -6,     -7,      1,      4,      1,      7,     -7,     -4,     -4,     -8,      5,      6,      0,     -2,     -7,     -1,     -2,     -2,      3,      0,      2,      1,     -4,      2,      0},
-    {     2,     -1,      6,     -6,     -1,     -4,      5,     -3,     -9,     -2,     -5,    -11,     -6,      4,     -9,      4,     -1,     -5,      7,    -11,      8,     -4,      0,      5,    -11,     -8,      6,    -18,      3,      2,      5,     -2,     -2,      4,      4,      7,      4,      8,      7,      2,      0,     -5,      0,     -7,      5,     -8,      3,     -6,     -8,     -4,      7,      0,     -7,      2,      6,     -6,      5,      9,     -1,     -7,      3,      5,      1,      0},
-    {     6,     -5,      2,      0,     -7,      0,    -15,     -6,     -6,     -4,     -3,    -15,     -7,      5,    -10,      2,      2,     -4,     -1,    -13,      4,     -1,     -5,     -7,      3,     -4,     -5,     -3,      5,     -2,     -3,      4,     -1,      4,     -2,    -10,      6,     -1,     -4,     -7,    -12,     -6,     -1,     -2,      4,     -5,      0,     -3,    -12,      0,     -2,     -5,     -2,     -3,      5,    -12,      2,      0,      2,     -6,      2,     -7,      0,      2},
-    {     8,     -6,      5,     -6,      1,      1,      1,      3,     -8,     -2,     -6,     -2,     -6,      0,     -2,     -1,     -8,     -5,     -2,     -4,      1,     -3,     -4,    -12,     -7,     -8,      8,      0,      1,     -8,      2,     -1,     -4,     -7,      8,     -2,      8,      0,      5,     -4,     -4,     -4,      1,      0,      6,     -5,      3,     -3,     -4,      0,     -1,     -3,     -9,      2,     -1,     -4,      0,      9,      1,     -5,      1,    -11,      2,      3},
-    {    -1,      0,      1,      5,      3,     -7,      0,      1,      4,     -4,     -8,     -9,    -10,     10,    -14,      6,      7,      0,     13,     -4,      3,     -8,     -2,     -4,    -11,     -4,      6,    -11,      6,      4,     -1,     -4,      8,     -7,     13,      8,     -2,      4,      3,     -9,    -11,     -1,      3,     -6,      6,     -8,     -5,      1,      1,      1,      5,      3,     -9,      6,     -3,      9,     13,      2,     12,     -4,      1,     -6,      4,     -4},
-    {    -4,      5,      2,     -3,      2,     -4,      5,      3,     -4,     -4,     -3,    -12,      7,     -4,     -3,     -2,     -3,     -6,     -3,     -7,     -3,      3,     -4,      0,     -6,     -5,     -1,     -4,      1,     -7,      4,     -2,      3,     -3,      4,     -2,      1,      3,      5,     -1,     -4,      5,      4,      2,      7,     -2,      1,     -7,     -4,      4,     -5,      2,     -3,     -4,      4,     -4,      1,      2,      7,     -2,      4,      2,     -7,     10},
-    {     2,      9,     -2,      6,     -3,     -4,     -1,     -5,     -3,     -2,     -1,     -4,      3,      1,     -4,     -2,     -3,     -3,      6,      0,      1,      3,     -7,     -8,     -2,     -1,      1,     -6,      1,     -2,     -2,      2,      1,     -6,     -4,     -4,      3,     -1,     -6,     -5,     -3,     -2,      7,     -6,      3,     -2,     -5,      0,     -2,     -7,      1,     -5,     -6,    -11,      7,     -1,      4,      4,      7,      0,      2,      1,      0,      2},
-    {     2,     -4,      7,     -6,     -2,     -2,    -12,     -3,     -4,     -5,     -6,      2,     -8,     -2,     -7,     -2,     -4,     -3,    -12,      0,      6,     -3,     -5,    -10,    -10,    -10,      9,     -4,    -12,     -1,     -7,     -5,     -4,     -5,      0,    -18,      5,     -1,     -8,     -6,     -7,     -6,     -6,      2,     -3,     -3,      6,     -1,     -4,      1,     -2,     -3,     -6,     -5,      0,    -10,    -10,      1,     -6,     -5,     -3,    -10,     -5,     -3},
-    {    -1,     -8,      2,     -7,      0,     -2,     -1,      5,     -5,     -4,      7,     -6,     -1,      4,     -8,     -2,     -8,     -9,      7,    -10,      0,     -1,     -1,     -5,      0,     -9,     -1,      2,      2,     -4,     -8,     -2,      1,      1,     10,     -5,      3,      7,     -5,     -2,    -10,    -10,      2,      4,      0,     -4,     -1,     -7,     -3,     -2,     -4,      3,      1,     -6,     12,     -6,      2,      1,      4,     -5,     -2,     -2,      8,     10},
-    {     0,     -2,      2,     -8,     -2,     -2,     -3,      0,     -6,     -2,      0,     -3,     -2,      3,      4,      4,     -1,     -2,      2,      5,      6,     -2,     -6,     -1,    -12,     -7,      3,    -11,      2,     -3,     -9,     -2,      2,     -8,      2,     -3,      0,      3,      6,     -5,     -2,     -4,      1,      2,     -1,     -2,     -6,     -9,      2,     -5,     -6,     -8,      1,     -3,      0,      2,     -7,      0,     -2,      0,      0,      3,      2,    -11},
-    {    -1,      5,     -1,      2,      1,    -11,      0,      0,     -8,      3,     -7,    -10,      2,     -1,      1,     -4,     -9,     -1,     -2,      1,      3,     -1,     -4,      1,     -3,     -2,     -4,     -2,      2,     -2,      4,     -1,      5,      4,      9,      0,      0,      0,      6,      0,      1,     -6,     -1,     -2,      2,     -6,      0,     -1,      4,     -1,      1,     -1,     -6,     -7,     -4,      3,     -2,      1,     -2,     -4,      1,     -6,      6,      2},
-    {    -4,     11,      0,      2,      3,      5,     -3,     -3,     -2,      1,    -10,     -2,     -6,      6,     -6,      3,      3,     -1,    -14,      0,      9,      1,     -7,    -10,      4,     -3,     -7,     -2,      2,      5,      1,      3,     -2,      2,      4,     -6,      5,     -2,      7,    -10,     -5,      5,      3,     -4,      0,      5,     -5,     -2,      5,      0,     -2,     -5,      6,      1,     -2,     -2,      3,     -2,      5,     -6,      3,     -5,      0,     -1},
-    {     9,     -8,      4,     -6,     -6,      4,    -10,     -6,      0,    -16,    -11,     -4,    -10,     -5,    -11,     -3,     -6,     -4,    -14,      5,      1,     -4,      0,     -3,     -6,     -7,      1,     -9,    -14,      0,    -10,      3,     -9,      2,     -9,    -17,     -8,     -1,     -2,     -5,      2,    -18,     -5,     -2,     -5,     -6,    -16,     -6,     -6,    -13,      3,     -5,     -2,      1,      2,     -4,     -3,      5,     -4,      4,     -4,     -8,      0,      7},
-    {    -2,    -12,     -3,     -9,      1,     -8,    -11,     -9,     -3,    -13,     -4,    -15,    -16,    -16,     -3,    -11,     -7,     -7,    -13,     -2,     -4,     -5,    -12,    -15,    -11,     -6,     13,     -6,    -11,     -1,    -12,     -5,    -15,     -1,     -8,    -15,      1,     -5,    -16,     -8,     -7,    -20,    -12,     -6,     -5,      0,      0,     10,     -4,      4,     -3,     -1,     -7,     -1,     -7,    -14,    -11,     -1,     -7,     -4,      3,    -18,     -4,    -12},
-    {     0,      5,      6,     -4,      6,      1,    -10,      5,     -3,      0,    -14,     -3,      0,     -3,      0,     -5,     -5,     -9,      7,     -1,      4,      4,      4,     -3,     -6,    -15,     -8,     -5,      9,      1,     -4,      5,     -9,     -5,      5,     -9,      5,      3,      0,     -8,     -9,      0,      0,     -5,      0,    -10,      3,     -6,      1,     -1,     -2,     -1,      1,     -1,     -4,     -5,      1,      2,      3,      4,      6,     -8,      1,      4},
-    {     6,     -4,     -1,      5,     -6,      1,    -14,     -8,     -5,      0,     -1,    -10,     -7,     -3,     -6,      2,     -2,     -5,      4,      2,      2,     -9,      0,     -8,     -9,     -7,     -2,    -10,      3,      3,      2,    -11,     -4,      1,     -3,     -2,      1,      6,     -1,     -5,     -4,      6,     -3,     -3,     -3,     -4,      1,     -1,     -5,     -4,      0,     -8,     -7,     -6,      6,      2,      0,     -2,     -2,     -4,     -3,     -3,      0,      3},
-    {    -1,     -4,      3,     -4,     -8,     -1,      7,      5,     -8,     -4,      2,    -10,      3,      0,      2,     -4,     -3,      0,      5,      0,      2,     -5,     -4,      6,      2,      1,     -8,     -7,      8,     -4,     -5,     -1,     -6,     -6,     -6,     -6,     -3,     10,     10,     -5,     -2,     -4,      2,     -1,     -3,    -11,     -1,     -6,    -10,     -3,     -3,     -7,      1,     -4,      4,     -2,     -2,     -7,     -6,     -6,      3,     -3,     -2,     -2},
-    {     1,     -4,      0,     -8,      1,     -2,     -2,     -8,     -7,      4,     -3,     -8,     -5,      2,      0,      4,     -3,     -3,      9,     -8,    -11,     -2,     -2,     -6,    -11,     -3,      5,    -20,      0,     -4,     -5,     -1,      1,     -8,      0,    -14,      0,     -4,     10,      1,     -9,     -4,      5,      2,      6,     -3,     -1,     -5,     -2,     -5,      4,      4,    -13,     -4,      0,    -10,      0,      7,      6,      2,      2,     -4,     -7,     -5},
-    {     0,     10,     -1,     -7,      9,     -9,     -5,     -4,     -7,      3,     -5,     -1,     -2,     -4,     -5,     -4,     -2,     -5,      2,     -8,     -2,     -4,    -10,     -6,     -2,     -7,      6,     -5,     -2,     -1,      2,      1,      1,      6,      3,     -6,      4,     11,     -4,     -6,     -2,      0,     -8,     -4,     -1,     -3,     -3,     -2,     -4,      3,      2,      6,    -11,      1,     -4,     -1,      0,      2,     -4,      5,     -4,      0,      0,      7},
-    {     5,      2,      0,     -9,      5,     -3,      1,      0,     -8,     -3,     -9,     -1,     -8,      1,     -8,     -6,     -9,     -8,     -5,      5,      0,     -7,     -1,      5,     -2,     -5,      8,     -1,      2,     -1,     -6,     -1,     -3,      7,      2,    -11,      2,      1,      0,     -5,     -5,     -1,      2,     -4,      2,     -2,     -3,     -2,     -9,     -2,      6,      2,     -8,     -5,    -10,      1,      0,      1,      0,      0,      2,      1,      0,      0},
-    {     4,    -11,     -2,     -4,    -10,     -3,    -12,     -5,      0,      0,      0,     -7,      5,      3,     -2,      4,     -6,     -7,      0,      8,     -3,     -3,     -7,    -10,     -3,     -4,     -1,     -7,      3,     -8,     -5,      2,      6,     -1,     -1,    -10,     -1,      7,     -8,     -2,     -1,     -9,      2,     -7,      4,     -5,     -2,     -8,     -3,     -5,     -1,      1,      2,     -3,     -3,     -7,      2,     11,     -5,     -3,      0,     -1,     -5,     -1},
-    {     7,    -11,     -2,    -12,     -3,     -8,     -9,    -11,     -7,     -4,    -11,      2,     -5,      2,     -8,     -4,     -6,     -4,      2,      1,     -1,      0,     -6,      2,     -8,     -2,     -1,     -7,     -7,     -5,     -6,      6,     -4,     -2,     -7,    -12,      5,     -3,     -5,    -15,      1,     -4,     -7,      2,     -2,     -1,     -3,     -7,     -8,     -5,     -3,      2,      1,      0,      0,     -4,    -13,      5,     -5,     -6,      1,    -16,    -11,     -6},
-    {     2,      2,     -2,     -7,      5,      1,     -3,     -6,      3,     -8,     -9,     -1,      0,      4,     -6,     -5,    -12,     -3,      0,     -4,     -3,     -1,     -2,     -2,     -9,     -9,      7,    -11,     -2,      4,    -11,      8,      0,     -4,     -6,     -1,     -3,      9,      0,    -11,     -4,     -8,     -3,     -6,     11,     -5,     -5,     -9,     -5,     -6,      7,      0,     -6,     -5,      0,     -7,      3,      5,      9,      3,      4,     -1,      3,    -11},
-    {     2,      3,      1,     -2,      2,     -2,     -3,     -5,     -5,    -12,     -3,     -8,     -7,     -3,      0,      3,     -9,     -2,     -2,     -8,     -6,     -2,     -1,      6,     -2,     -4,     -2,     -3,     -6,      0,      2,     -1,     -8,     11,      0,     -7,     -3,     -4,      3,     -5,     -3,      0,    -10,     -3,      2,     -6,     -9,     -4,     -2,      5,      7,     -8,     -2,      6,      0,     -5,     -1,     11,      2,      3,      6,     -5,     -4,     -4},
-    {     5,     -3,     -3,     -8,      1,      2,     -5,     -2,     -2,     -2,     -3,     -8,      1,     -2,     -7,     -6,     -5,     -6,      0,     -3,      3,     -5,     -2,     -2,     -5,      0,     -5,    -10,      4,     -4,      6,      0,     -4,      4,    -10,     -3,     -2,    -11,     -5,     -3,     -2,      6,      4,     -6,      2,     -7,     -3,      2,      1,     -2,      9,      0,    -12,      1,     -2,    -11,     -5,     12,      0,      0,      1,     -4,     -5,      5},
-    {    -3,    -10,      9,     -6,      7,     -9,     -6,      9,      1,     -5,      0,     -6,     -3,     -8,     -3,     -2,     -1,    -10,      0,     -2,     -3,     -1,    -12,     -2,     -4,    -10,     -7,     -7,      3,     -2,     -9,      2,      8,     -8,      4,     -3,     -2,     -7,      1,     -6,     -7,     -1,     -2,     -1,     -1,     -2,     10,     -9,     -6,      1,     -2,     -1,     -5,     -2,      4,     -5,     -3,     -2,      0,      6,      9,     -8,      3,     -1},
-    {    -4,    -13,     -3,      5,      1,      1,    -10,     -3,     -4,     -4,     -6,      6,    -10,     -3,    -15,      1,      5,     -5,     -6,     -7,      6,     -3,     -4,    -10,     -1,      2,      2,    -11,     -7,     -7,     -6,      4,      3,      3,     -2,     -7,      3,      3,     -6,     -8,     -6,     -8,    -13,     -6,     -2,     -2,      5,     -6,     -4,      3,     -1,    -12,    -15,     -2,     -6,     -7,     -7,     -2,     -5,     -6,      0,    -11,     -2,     -3},
-    {    -2,    -13,     -8,     -6,     -1,      5,     -6,     -3,     -2,      0,     -2,      6,     -5,     -1,    -15,     -2,      0,      0,      0,      6,      4,     -6,    -12,     -7,     -6,     -5,     -6,      1,     -4,      1,     -2,     -6,    -11,     -2,     -8,     -6,      3,     -3,     -8,     -7,     -6,    -10,     -7,      3,     -3,     -4,     -2,     -6,     -2,      2,      6,     -1,    -11,      1,     -3,    -11,     -9,      1,     -1,     -5,      2,    -14,     -6,    -12},
-    {     0,     -1,      1,     -7,      1,     -5,      0,      0,     -5,     -1,     -2,     -2,     -4,      3,     -2,     -5,      1,      1,      7,      1,     -2,     -3,    -11,      1,    -10,     -5,      4,     -6,      8,     -3,      0,      0,     -3,     -2,     -2,     -7,      2,      2,      4,     -8,     -7,     -2,     -1,      1,      5,     -1,      1,     -6,      1,     -5,     -6,      0,     -1,      2,      2,     -1,     -6,     11,     -2,     -2,      0,     -1,      1,      1},
-    {    -2,      4,     -3,      3,      8,     -6,     -2,      4,     -7,      1,     -2,     -8,     -4,     -2,    -13,      4,     -4,      2,     10,      5,     -6,     -6,     -5,     -5,      4,     -7,      2,      0,      3,     -4,     -4,      5,      3,      6,     -1,      0,      4,     -4,      4,     -5,     -5,     -1,     -4,     -1,      2,      5,      2,     -8,     -1,     -1,     -1,     -3,     -5,     -5,      6,     -3,     -3,     -7,      5,     -4,      9,     -2,     11,     -6},
-    {    -5,     -6,     -2,     -1,      2,      6,     -5,      2,     -1,     -5,     -1,     -5,      3,      7,      3,     -4,     -1,      1,      1,     -9,      3,      0,     -3,     -5,     -8,     -5,      0,    -13,     11,     -4,     -3,      1,      2,      0,      0,     -2,     -2,     -4,     -3,     -4,     -3,     -4,      5,     -5,     -1,     -1,      4,     -1,     -3,      1,      6,     -2,    -12,     -1,      9,      3,      3,      1,      2,      0,      0,     -5,      1,     -1},
-    {    -2,      1,      5,     -2,      1,      3,     -5,      0,     -4,      6,     -4,     -7,     -7,     -1,    -14,     -4,      3,     -4,      6,     -6,      8,     -2,      2,     -2,    -12,     -6,     -2,     -3,      2,     -4,     -2,     -2,     -6,     -6,      5,     -5,      4,     -4,      1,    -13,     -2,     -6,     -3,     -7,      1,     -4,      3,    -10,     -5,     -7,      4,    -12,     -3,      5,     -1,     -2,     -1,     -3,     -2,     -9,     -1,     -7,      2,      4},
-    {    -6,     -5,      1,      4,      0,     -1,     -4,     -6,     -1,     -9,     -2,     -2,      2,     -7,      4,      0,     -5,     -3,     -1,     -1,     -3,     -5,     -2,     -8,     -4,     -1,      1,     -6,      2,      0,      0,      1,      6,     -3,      3,     -1,      2,      7,      3,     -6,     -7,     -5,     -7,     -2,     -1,     -4,    -13,      1,     -5,      4,      4,      4,     -4,      1,      2,     -1,     -1,      1,      1,     -4,     -1,     -1,      5,     -3},
-    {    -1,     -4,     -6,     -6,     -3,     -4,     -1,      0,     -4,      1,     -7,     -6,     -1,     -8,     -7,      0,      6,     -7,     -6,     -9,     -1,      1,     -4,     -3,     -8,      4,      8,    -13,     -3,     -4,     -1,      1,     -3,      3,      5,     -4,      3,      3,     -6,     -4,     -9,    -15,      1,      1,      1,     -5,      1,     -8,     -5,      0,      2,      7,    -10,     -1,      2,    -10,     -2,     -1,     -3,     -5,      1,     -1,      5,     -6},
-    {     5,     -8,      2,     -4,      6,     -8,     -5,      1,    -11,     -2,     -3,     -2,     -5,      3,     -1,     -5,     -2,      2,      2,     -3,      6,     -1,    -12,     -4,     -6,    -10,      1,     -5,      0,     -2,      0,      4,     -5,     -3,      1,    -16,     -4,     -3,      7,     -4,     -2,      1,     -4,      1,      1,     -4,      1,     -3,      7,     -1,      2,     -1,    -11,     -3,     -3,    -10,     -5,      5,      1,     -2,     -1,     -7,      9,      3},
-    {     2,     -3,     -3,     -1,      3,     -1,     -9,    -11,      0,     -3,     -7,    -21,     -8,     -9,    -15,      1,     -5,     -4,     -2,     -7,     -1,     -7,      7,    -10,    -15,     -6,     -2,     -8,     -5,      1,    -10,      6,    -11,     -9,      0,    -15,     -2,      4,     -2,    -12,     -2,      4,     -9,    -10,      0,     -7,     -2,     -8,     -6,     -4,     -5,     -3,     -2,     12,     -8,     -8,     -3,      5,     -3,     -7,      1,    -10,     -2,     -2},
-    {     3,     -5,     -2,     -2,     -1,      5,     -2,     -3,     -5,     -3,     -9,     -7,      2,     -5,     -5,     -7,    -11,     -1,     -3,     -2,     -2,     -2,     -8,     -4,     -4,     -2,      2,     -7,      1,     -3,      7,      3,      0,     -6,     13,    -19,      3,     -7,      7,     -2,     -3,     -9,     -4,     -3,      2,      0,     -7,     -1,     -6,     -3,      1,      0,     -1,     -1,     -5,      0,     -5,      6,     -3,      4,      0,      3,      3,     -4},
-    {     0,     -3,      3,     -4,     -2,     -8,     -5,     -2,     -2,     -4,     -3,    -15,     -3,     -7,    -14,     -3,     -8,     -4,      0,    -10,      6,      2,     -5,    -16,     -4,     -5,      0,      4,      5,      1,     -3,     -4,     -2,     -4,     -5,    -12,      0,    -11,      3,    -14,     -6,    -13,     -3,     -5,      4,     -6,      0,     -3,     -9,     -6,     -3,     -4,     -9,     -4,     -1,      0,     -6,     -2,      0,     -8,      4,     -9,      2,      3},
-    {    -1,    -12,     11,     -9,      1,     -7,     -5,     -9,    -13,     -7,     -1,    -18,      1,     -9,    -16,     -6,     -1,     -3,     -9,      2,      4,     -9,      0,    -10,     -3,     -9,     11,     -8,      2,     -4,     -4,     -3,      7,     -5,      2,     -1,     -7,      5,      1,      4,     -6,     -9,     -9,     -1,      4,     -4,      1,      2,     -8,     -3,     -3,     -3,    -14,    -11,     -4,     -7,     10,      1,     -4,      0,     -2,      3,      9,     -5},
-    {     4,      4,      1,     -3,      1,      1,     -2,      1,      2,     -4,     -7,     -6,    -11,      0,     -8,     -7,     -4,     -9,     -1,    -11,     -3,     -5,     -1,     -5,     -2,    -12,      6,     -2,      3,     -3,      9,     -9,     10,     -3,     -2,     -4,     -5,      0,      0,    -10,     -3,     -5,     -2,      4,      0,    -18,     -1,    -13,    -10,      2,      1,      7,     -4,     -5,     -6,      0,      9,      0,     -2,      0,     -1,      5,      9,    -11},
-    {     0,     -9,      6,     -6,     -5,     -4,     -1,     -2,     -4,      0,      6,    -15,     -2,      0,     -1,      4,     -4,     -7,      7,    -10,     -2,     -1,    -15,     -4,     -1,     -2,     20,    -10,      0,     -1,      0,      6,     -6,     -6,      1,     -3,     -6,     -3,      6,    -13,     -3,     -1,      3,     -2,      6,     -7,      9,     -5,    -10,      2,      3,     -9,     -9,      0,      1,     -4,     -3,      3,     -5,     -3,      0,      2,      0,     -1},
-    {    -4,      4,     -4,     -4,      2,     -7,     -8,      3,    -13,    -15,      2,    -15,     -5,      5,      6,      3,      4,      2,      9,     -8,      3,      1,     -6,     -9,     -4,     -2,      7,     -2,      0,     -3,     -2,      4,      9,      1,     19,     -2,     -9,      3,      0,     -3,      2,      6,      6,     -7,      8,     -8,     -5,    -12,      0,     -1,     -1,      1,    -14,     -5,     -5,      0,      1,      0,      4,      1,      2,      9,      8,      5},
-    {     0,      1,      5,     -4,      4,     -2,      1,      3,     -4,     -7,      2,     -3,     -1,      0,     -1,     -1,     -6,     -2,     10,     -3,      4,      4,     -3,     -5,     -5,      0,     10,    -12,     13,      6,      6,      4,      6,      4,     13,     -6,      5,      5,     10,    -11,     -1,    -14,      4,     -2,      7,     -5,     -4,     -8,     -4,      0,      3,      1,     -4,     -6,     -2,      1,      6,     -4,      9,     -8,      4,     -4,     -1,     -1},
-    {    -2,      3,     -1,     -6,     -4,      1,      1,      5,     -5,    -12,     -1,    -16,    -11,     -2,     -8,      0,      5,     -5,      4,      8,     -4,     -2,     -4,     -6,     -3,     -8,      0,     -2,     10,      3,     -6,     -1,     -7,     -4,      5,    -14,      2,      0,      5,     -6,     -3,     -4,      7,      1,      3,     -6,     -6,     -2,     -6,     -6,     -3,     -3,     -6,     -2,     -5,     -2,      6,     -7,      7,     -1,     -1,      2,      4,     -6},
-    {     0,     -3,      0,    -12,      2,     -8,     -8,      6,     -2,     -1,     -1,      3,     -1,    -10,     -2,     -7,    -12,     -1,      2,      0,     -3,      0,     -3,     -1,      1,     -2,    -13,    -10,      6,     -6,     -1,     10,      5,     -3,     -9,      5,      7,      1,     -5,     -8,     -7,     -1,     -3,      1,      0,      2,     -8,     -5,     -6,     -2,      1,      3,     -6,     -8,      1,    -10,      0,      2,      3,      0,      6,     -3,     -1,      3},
-    {     0,      6,     -1,     -3,      5,     -1,     -7,     -6,     -8,    -12,     10,     -7,      5,     -4,      5,    -13,     -2,     -7,      3,     -4,      1,      0,      0,      0,    -11,     -1,      2,      3,     -4,     -6,     -2,      5,     -5,      0,      1,     -3,     -3,      0,    -11,     -3,      2,      2,      5,      0,      5,     -7,     -4,      7,     -5,      1,     -1,      6,     -4,    -11,     -3,      0,     -5,      5,     -2,     -5,      3,      9,     -8,      5},
-    {    -2,    -11,      0,     -2,     -5,     -3,    -11,     -3,     -7,      2,      5,      1,     -9,     -7,    -12,      2,     -4,     -1,      0,     -4,     -1,      3,     -4,     -4,     -5,     -3,     -5,      2,      2,     -1,      5,     -3,     -1,     -5,     -2,    -12,      2,      5,     -6,     -7,     -2,     -1,    -13,     11,     -1,      0,      0,     -1,     -4,      2,      0,     -5,      6,     -3,     -5,     -1,     -6,      2,     -6,     -2,     -1,    -12,     -4,     -4},
-    {    -3,     -1,      2,     -9,      1,      1,     -4,     -4,      0,    -11,     -8,     -5,     -3,      5,     -7,     -4,      0,      5,     -1,    -11,      2,     -1,      1,     -3,      1,     -3,     -4,    -10,      0,      3,     -2,     -1,     -3,     -2,      0,     -9,     -3,      2,      0,     -8,     -9,     -3,     -2,      0,      3,      2,      2,     -5,     -1,     -1,     11,     -9,     -8,      1,     -1,     -2,      7,      0,     -4,    -11,     -4,     -4,     -1,      8},
-    {     7,     -5,     -2,     -9,    -11,    -14,    -11,     -4,     -7,      2,     -9,     -4,     -6,     -7,     -7,     -1,     -4,     -2,     -1,     -5,      1,      1,    -13,    -10,    -13,     -2,      1,      1,     -8,     -2,     -4,     10,     -4,     -5,     -5,    -13,      7,     -2,     -7,    -11,     -6,     -9,     -9,      0,     -3,     -9,     -2,     -8,     -2,     -3,     -2,      6,     -1,     -3,     -5,    -11,      2,      7,     -4,      3,      0,     -8,      0,     -6},
-    {    -2,      0,      8,      0,     -7,     -4,     -2,      6,    -11,     -6,      4,     -2,      1,     -7,      3,      3,     -5,     -4,     -3,     -7,      0,     -6,     -4,     -2,     -6,     -2,     -6,     -8,      1,      2,     -9,     10,    -10,     -1,      1,     -8,      1,     -8,     -2,     -2,     -1,     -3,      4,     -2,      9,     -2,      7,     -7,     -7,     -5,      4,      1,      1,     -4,     -1,    -13,      0,      0,      3,     -2,      7,     -6,      7,     -1},
-    {     2,      5,     -2,     -7,     -7,      2,      4,      7,     -7,     -5,     -2,     -2,      1,      1,     -6,      0,      0,     -6,      0,     -2,     -2,      1,      2,      0,     -1,     -5,      7,     -4,     16,     -5,     -2,      2,      4,      7,     -5,     -8,     -5,     -4,     12,      5,     -7,     -2,      3,     -3,     -1,     -2,     -5,      1,     -7,     -1,     -1,      0,      4,     -4,      0,      1,     -5,      7,     -2,     -4,      3,     -3,     -8,      0},
-    {     0,     -2,      4,     -1,      1,     -2,     -4,      1,     -8,     -6,     -2,     -4,      0,    -10,     -4,     -9,     -2,     -4,      4,     -9,      2,     -6,    -12,     -6,     -1,     -6,      0,     -4,     -6,    -13,      8,     -6,     -3,      2,     -8,     -5,      1,      0,     -7,     -7,      0,      3,     -2,    -13,     -1,     -7,      0,     -4,      1,     -3,     -5,     -2,     -9,      3,     -2,     -1,      3,     -5,      0,      0,     -2,     -7,      4,      5},
-    {     6,     -9,      2,     -8,      6,     -5,     -8,      2,      2,     -6,     -4,     -4,     -4,      5,     -1,     -4,     -6,     -6,      3,     -8,      6,      6,     -3,     -5,    -13,     -5,     -3,     -8,      9,      0,     -4,     12,      3,      1,      3,     -9,      4,      1,      0,     -9,     -5,    -10,      3,     -3,      4,    -14,     -4,     -5,     -4,     -6,      3,     -1,      3,     -3,      6,     -1,      7,     -2,      0,     -7,      1,     -6,      5,      7},
-    {     0,     -3,      3,     -5,      4,      3,      3,      3,     -3,     -4,     -2,     -3,      4,     -1,      4,     -5,     -5,     -4,     -6,     -1,     -4,     -6,     -7,      2,      3,     -4,     -6,      0,      2,      3,     -6,      1,     -4,      2,     -2,      6,     -2,     -2,      0,     -8,     -5,     -3,     -9,      2,     -7,     -6,     -1,     -6,     -3,      5,     -3,      5,     -5,     -6,      3,     -8,      1,      0,      1,     -7,     -2,     -3,      3,     -6},
-    {     2,      0,      0,     -2,     -6,     -4,      0,     -2,    -13,     -4,     -4,    -15,      4,      1,     -6,      4,      1,     -5,      4,    -13,     -3,     -5,     -5,     -1,     -3,      0,      2,     -2,      2,     -2,      6,     10,     -6,     -8,     -4,     -5,      2,     -5,      3,     -5,     -2,      1,      0,      0,      5,     -9,     -7,     -1,     -5,     -2,     -2,      0,    -11,     -7,     -3,     -5,      0,      9,     -2,      1,      1,      0,     -5,      1},
-    {    -3,      0,      5,     -9,      4,     -3,      4,     -3,     -1,     -1,     -8,    -12,      2,      0,      7,      0,     -3,     -5,      5,     -6,     -3,      0,     -2,      0,     -6,     -6,      1,     -9,     12,      1,     -4,     -1,      8,      0,      0,     -1,     -2,      3,     -5,     -2,     -4,     -7,      5,      2,     -2,     -4,     -1,     -4,     -4,     -6,      1,      2,     -5,     -4,      8,     -5,      3,      4,      6,     -1,      2,      2,      3,      3},
-    {     8,     -3,      3,      3,      1,     -1,     -6,     -4,     -3,      1,    -13,     -2,     -2,      5,     -5,      1,      4,     -1,     -3,      0,     -4,     -6,      0,      0,     -4,      0,      1,      2,      6,     -2,     -1,      4,      3,     -6,     -1,     -5,      1,     -9,      0,     -9,      0,      1,      1,      4,     -9,     -5,      4,     -5,     -2,     -6,      9,     -7,     -3,     -3,      7,      0,     -3,      4,     -4,     -2,     -1,     -5,      4,      9},
-    {    -4,      5,     -6,      0,      1,     -5,     -8,      4,      0,      5,     -5,      0,      1,      6,      2,      2,    -12,     -3,     -1,     -3,      6,      0,     -3,     -1,      1,     -2,      3,     -9,     -6,      5,      2,      3,     -5,      0,      8,      0,      0,      1,      8,     -6,     -9,     -3,     -7,      6,     -6,      4,     -4,      4,     -4,      3,      7,     -1,     -6,     -5,     -1,      2,      2,      2,     -9,     -1,     -3,     -1,     -1,      1},
-    {    -2,     -9,     -3,     -9,      6,     -1,      0,     -7,     -1,    -15,     -2,     -6,     -6,     -1,     -5,     -3,      1,     -5,     -9,     -5,      2,      1,     -4,     -8,     -6,    -10,      5,    -11,     -3,      2,     -2,      3,      2,     -1,      4,     -3,      1,     -1,      0,    -11,     -4,     -2,      2,     -1,     -3,     -1,      6,     -6,      3,      1,     -6,     -2,     -5,      4,     -1,     -3,      2,     -1,     -1,     -6,     -1,     -9,     -1,    -10},
-    {     7,      3,     -3,     -5,     -1,     -1,      8,      2,     -2,     -5,     -1,    -10,      2,      3,     -3,     -6,     -3,     -4,      2,     -2,     -1,     -3,      5,     -3,      1,     -3,      0,      1,      4,     -1,     -8,      1,      5,      2,      2,     -1,     -6,     -1,      3,     -2,      4,      7,      2,     -4,      4,     -8,      2,     -3,     -4,     -1,      2,      3,      0,     -1,     -4,     -3,      0,      1,      0,      1,      0,     -4,      3,      1},
-    {    -3,     -4,      1,    -10,      9,     -5,     -3,     -1,     -7,     -7,     -5,     -5,     -2,     -3,     -6,     -3,      0,     -3,     -2,    -10,      1,     -1,     -3,     -1,     -8,     -9,      4,    -13,      2,      4,     -9,      2,     -7,    -10,      0,     -2,     -5,     -4,      7,    -14,      1,      0,     -7,     -2,      3,     -6,      7,     -2,      1,     -1,      5,     -1,     -9,     -6,      3,      1,     -2,      0,     -1,     -2,     -2,     -7,      1,     -5},
-    {     5,      6,     -1,     -8,     -3,      4,      0,      5,     -5,     -7,    -12,      2,      5,     -3,      3,      0,     -7,     -1,     -8,     -6,     -2,     -7,     -5,     -5,     -6,     -5,      3,     -4,      2,      4,     -2,      2,     -3,     -4,      0,     -4,      1,      1,     -7,     -7,     -7,     -6,      6,     -3,      0,     -5,     -5,      1,     -8,      2,     -2,      1,     -5,      2,      0,     -5,      3,     -2,     -2,     -9,     -4,     -6,      3,     -1},
-    {     0,     -7,      3,     -6,      1,      1,      6,     -2,      6,     -1,      1,     -6,    -10,     -6,     -8,     -1,      1,     -3,     -2,     -9,     -3,     -2,      0,     -5,     -9,     -6,     -1,     -1,      0,     -4,      3,      4,     -2,     -4,      3,    -10,      4,      1,      0,     -2,     -3,     -1,     -6,     -7,      2,      0,      1,     -9,     -5,     -6,     -2,      2,      6,      0,      5,     -5,      1,     -4,     -2,      1,      3,     -6,     -1,      0},
-    {    -5,      0,      1,    -11,     -2,      0,    -10,     -6,     -4,     -2,     -5,     -5,      0,     -1,      2,     -3,     -1,     -4,     -8,      1,     -5,     -1,     -8,     -9,     -4,      2,      1,     -6,     -3,      4,     -5,     -1,     -9,     -3,      0,      2,     -6,     -1,     -6,     -3,    -14,     -8,     -2,     -5,     -3,     -7,     -2,      1,     -6,     -3,      1,     -5,    -16,     -1,      1,      3,      5,     -1,      4,      2,     -4,     -5,      2,     -3},
-    {     4,     -3,      4,     -1,      0,     -4,     -1,      7,      0,    -10,     -2,    -21,     -2,      0,     -5,     -4,     -2,     -7,     -2,     -4,     -6,     -3,     -3,     -3,     -4,     -1,      5,     -1,     -3,      1,     -3,     -2,     -3,      0,     -5,      0,      0,      2,      1,     -2,     -7,     -2,     -1,      6,      7,      1,      0,     -9,     -1,     -3,      2,     -2,     -5,     -5,     -4,     -1,      5,      1,     -3,     -3,     -2,      5,      4,     -4},
-    {     1,     -1,     -2,     -2,     -1,     -9,      3,     -7,     -2,      2,     -1,    -17,    -11,     -5,    -18,      6,     -8,     -2,     -4,      1,     12,     -4,     -9,    -12,     -5,     -4,     -2,      6,    -17,     -8,      1,     -4,    -19,     -1,     -6,    -13,     -2,     -1,     -1,    -13,    -11,    -13,    -10,      3,      5,      5,     -1,    -10,     -6,      1,     -2,     -5,      0,      1,     -1,     -7,     -8,      1,     -2,      0,      5,     -4,     -2,      0},
-    {     4,     -6,      7,     -5,     -1,     -1,     -1,     -2,    -10,     -5,     -6,     -7,     -9,     -1,     -6,      0,     -3,     -4,      7,     -2,     -4,     -3,     -5,     -3,     -5,     -2,      1,      0,      7,      3,     -2,     -1,     -1,     -3,    -11,      1,      0,      1,     12,     -5,     -7,      0,      7,     -5,      1,     -8,      6,     -4,     -4,     -3,      1,      0,      2,      0,      3,    -11,     -6,      2,      3,     -4,      0,      2,     -7,      6},
-    {     1,     -1,     -2,     -8,     -3,     -9,     -4,     -5,     -1,      0,     -5,     -3,     -6,     -3,     -3,     -1,     -6,     -4,     -2,      1,     -3,     -7,     -4,     -1,     -9,     -3,     -5,     -5,     -2,     -1,      5,      3,     -4,    -13,     -4,    -14,      1,     -3,     -4,     -8,     -4,    -10,     -2,    -13,      2,    -12,     -1,     -7,     -5,     -4,     -2,     -3,      1,      4,     -7,    -11,     -1,      5,     -4,     -4,     -1,     -4,      0,      1},
-    {     6,      3,      7,    -14,     -5,      4,    -13,    -11,     -7,    -13,     -2,     -6,     -9,     -2,     -5,      2,     -1,     -3,     -1,      0,      2,     -2,    -13,     -9,     -2,      2,      4,     -8,      9,     -5,      1,     -3,     -5,    -10,     -1,      1,      4,     -2,      3,     -4,     -7,     -2,     -5,     -3,      5,      0,     -1,     -3,     -1,     -7,     -1,      2,      4,     -7,      4,     -4,      3,     -5,      0,     -2,      4,      0,     -1,      6},
-    {     3,     -9,     -4,     -7,     -2,     -6,     -7,     -3,     -5,     -8,     -1,     -3,     -7,      3,     -9,     -2,     -3,     -9,     -4,      1,      7,     -3,      2,     -3,     -6,    -12,      1,     -4,      2,     -3,     -5,     -1,     -5,     -7,      2,    -14,      3,      4,      1,     -2,      1,     -1,      5,      3,      3,     -2,     -2,     -5,     -7,     -3,      0,      0,     -3,     -3,      3,     -1,     -1,      8,     -1,    -10,      0,      0,     -7,      6},
-    {     7,     -9,     -3,     -8,      5,      0,    -10,     -6,      1,     -9,     -3,    -14,     -3,      1,     -3,      0,     -3,     -3,      5,     -2,      1,      2,     -6,    -10,     -3,     -6,     -1,      7,     -2,      4,      2,      0,     -2,      4,     -6,     -9,     -6,     -2,     -1,    -13,     -3,     -7,     -7,     -1,     -3,     -6,      8,      1,     -2,     -4,     -4,      8,      5,     -1,      2,     -5,     -9,      6,     -3,     -2,      9,     -4,     -5,     -6},
-    {     6,     -4,     -3,     -2,      4,      5,     -2,      2,     -3,     -7,     -2,     -7,      1,    -10,      4,      5,      1,      1,     -1,     -6,     -3,     -3,      1,     -3,     -4,      5,     -1,     -5,      2,     -4,     -1,      0,      5,      8,     -2,      2,      0,      6,     11,     -6,     -3,      0,      3,     -4,      0,     -6,     -3,     -4,     -2,     -4,      5,      0,      0,     -2,     -6,      2,     -5,     -1,      2,     -5,     -3,     -9,     -2,     -2},
-    {    -1,      7,      2,      1,      5,      2,     -3,     -5,      2,      6,     -5,     -6,      2,      6,     -3,     -2,     -2,     -2,      7,     -1,      5,      3,    -12,     -4,     -2,     -4,     10,     -7,      4,     -3,     -6,     -8,      6,     -1,      4,     -1,      5,      2,     -9,     -7,     -5,      3,     16,     -2,      1,      2,      5,     -6,     -7,     -2,     -1,      2,     -3,     -9,     -1,    -10,      9,     -1,      1,     -4,      9,      0,     -1,     -4},
-    {     3,    -10,     -5,    -16,      5,     -7,    -10,    -11,     -6,      3,     -3,     -2,    -18,     -4,    -14,     -2,    -15,     -8,     -1,      3,     -2,      3,    -18,     -5,     -9,     -4,     -4,    -16,    -14,      4,     -2,      1,     -9,     11,     -7,    -19,      4,     -7,    -10,     -7,     -6,     -7,     -5,     -5,     -4,      0,     -2,      1,     -8,     -3,     -3,     -9,     -2,     -3,     -9,     -9,     -8,      4,     -1,     -7,      3,     -9,     -3,     -7},
-    {     2,     -9,      2,     -6,     -3,     -2,     -3,     -3,     -5,      1,      0,      0,     -1,     -4,     -7,      4,    -10,     -4,     -3,    -10,     -1,     -1,     -8,     -9,    -17,     -1,     -6,     -2,     -3,      5,     -1,      3,    -13,     -4,     -3,     -8,      0,      5,     -6,     -3,     -3,    -14,      1,     -4,    -10,      4,     -6,     -5,      3,     -6,      6,      4,     -6,      0,      7,      2,      4,      7,      0,     -9,     -8,     -9,     -3,     -1},
-    {     1,      8,     -2,     -1,     -3,     -8,     -7,      1,      0,      1,     -2,     -2,     -5,     -3,     -2,     -7,     -7,     -4,     -5,     -5,      2,      4,     -8,     -2,     -9,     -7,     -7,     -1,     12,     -1,     -3,      5,     -8,      3,     13,      1,      8,     -8,      3,    -14,     -4,     -6,      0,     -4,      0,     -1,      6,    -14,     -2,      1,      1,      6,     -8,     -4,     -2,     -5,     -1,      4,     -6,     -2,      3,    -10,      7,     -4},
-    {     5,     -8,     -1,      1,     -1,      0,     -7,      2,     -4,      1,     -3,     -4,     -7,     -3,     -3,      6,     -3,     -7,     -4,      6,      2,     -2,     -8,     -2,     -2,     -4,     -1,      7,      1,     10,      3,     -9,      0,      1,      4,     -2,      1,     -6,      3,     -6,      0,     -7,     -7,      6,      8,     -3,      5,     -5,     -8,     -4,     -4,      3,     -7,     -2,     -1,     -1,      0,      4,      0,     -6,     -8,     -3,      0,     -3},
-    {    -2,     -1,      7,     -9,      1,      3,     -4,      0,      1,     -8,    -14,      0,      0,      4,      9,     -6,     -6,     -5,     -1,     -3,     -1,      7,    -14,      1,    -10,    -12,     -2,    -10,     -1,      3,     -7,      1,     -3,     -5,      0,      2,     -3,     -1,     -7,     -6,     -7,     -8,     -1,      5,      4,     -3,     -3,      3,     -6,     -2,     -3,     -6,     -5,     -7,      1,    -11,      7,      2,      1,     -5,      3,     -7,      9,      0},
-    {     2,     -1,     -4,     -3,     -1,     -1,     -1,      1,     -5,     -2,    -10,    -12,     -2,     -4,     -5,     -4,    -10,     -4,      3,     -8,      0,      0,     -2,     -5,     -5,     -7,      3,     -3,      7,      4,     -9,     -3,     -2,      5,      3,     -9,     -4,      0,      0,     -7,     -9,     -4,     10,      8,     -4,     -3,     -3,      2,     -5,      2,     -1,      0,     -6,     -9,      1,      0,      5,      3,     -8,     -3,      0,      5,      6,      7},
-    {    -1,     14,      4,     -6,      5,    -13,     -1,     -1,    -12,     -6,      0,    -15,      3,      8,      2,      2,      0,      0,     -2,    -11,      2,      0,      1,      0,      5,     -4,      2,     -8,      3,     -3,     -4,      3,      3,     -2,      6,     -4,      4,      7,     -2,     -6,     -5,      2,     16,     -6,      9,     -8,      2,    -15,     -3,     -2,     -1,      2,     -7,     -4,      4,      4,      3,      2,      1,      2,      1,     -1,     -2,      6},
-    {     0,      2,      7,     -1,      2,     -2,     -5,     -3,     -5,    -12,     -5,    -13,      1,      2,     -3,      8,     -8,     -1,     -9,    -12,     -6,      0,      0,     -3,     -3,      0,      3,    -10,      6,     -6,     -6,     -4,      7,     -2,      5,      1,    -16,      0,     -8,     -1,     -3,     -9,     -5,     -4,      1,     -2,     -5,     -2,      5,     -1,      8,     -2,    -12,     -5,     -4,     -2,     -3,      0,     -1,      2,     -4,     -9,     -4,      2},
-    {    -2,      2,      4,    -11,     10,     -2,     -3,     -7,     -6,     -5,      1,      2,     -1,     -1,      8,      1,      1,    -12,      6,     -5,     -5,      2,    -10,     -4,     -6,    -10,     -5,    -12,      2,     -1,     -7,      2,      1,      1,      7,     -2,     -1,      1,     -3,    -11,     -9,      0,      4,     -2,      0,     -2,     -1,     -8,     -3,     -9,      7,      4,      2,     -6,      3,     -3,      8,      5,      4,      1,      8,     -6,      8,      0},
-    {    -3,     -6,     -2,     -2,      8,     -6,     -4,      3,      3,      2,     -9,     -7,      1,      8,     -4,      0,      4,     -2,     12,     -5,      0,     -4,    -10,      2,     -6,    -13,     -8,     -9,     -1,     -1,     -4,     -1,      2,     -2,      2,    -10,      4,     -3,     -3,     -4,     -3,     -2,     12,      2,      0,     -6,     -3,     -6,     -4,      0,      6,     -6,      1,     -6,      3,     -9,     -1,      5,      2,     -1,      7,     -9,     -7,    -16},
-    {    -1,     -2,      5,     -1,      9,     -2,     -8,     -2,     -5,     -7,     -3,      3,     -3,     -4,     -5,      1,     -9,      1,     -7,     -9,      0,     -7,     -6,     -3,     -5,     -9,      3,     -2,      2,      5,     -1,     11,      4,     -2,     -3,     -3,      4,      1,     -3,    -12,     -3,      1,      0,     -7,     -1,     -3,      2,     -4,     -6,     -2,      4,     -2,     -9,     -1,     -1,    -11,     -3,     -1,      0,     -7,      3,     -4,     -6,      5},
-    {    -1,     -5,     -4,     -8,      2,     -3,     -2,      6,     -6,      0,     -3,    -11,    -12,     -2,     -7,     -7,     -1,     -2,      0,      1,      1,     -3,     -3,     -4,      1,     -9,      6,    -11,      4,     -4,     -2,     -1,    -16,      1,      2,    -12,     -1,      3,     -5,     -8,     -6,     -3,      3,     -2,      2,      3,      4,      0,     -4,      5,      2,      2,     -2,     -4,     -8,     -9,      1,      5,     -1,     -1,      1,      7,      0,      1},
-    {     8,     -1,      2,     -3,      0,      0,      3,     -2,     -7,     -6,     -7,     -8,     -5,     -4,    -10,      0,     -4,     -8,     13,      0,      2,     -2,     -1,     -9,     -8,     -3,      5,      2,      4,     -1,     -2,      2,      3,      0,      7,     -3,     10,      5,     -4,     -7,     -7,     -5,      2,      2,     -5,    -15,     10,      4,     -6,    -10,      1,      6,      1,     -4,     -4,     -5,      2,     -1,      0,     -4,      2,     -3,     -5,      2},
-    {     0,     -4,     -3,      2,      1,    -10,     -5,      3,    -14,     -3,     -9,    -11,     -8,     -1,     -9,      0,     -5,     -4,      1,     -1,     -4,     -8,      2,     -4,     -6,    -12,      4,     -4,     -2,      3,    -12,     -2,     -1,     -2,     -4,    -10,     -1,     -1,     -7,     -4,     -5,     -4,     -7,      3,      1,      7,      6,     -3,     -2,     -1,     -8,     -2,     -3,     -5,     -4,      3,     -3,      4,     -3,    -12,     -7,    -10,      3,     -4},
-    {     8,     -5,      0,     -8,      0,      4,     -8,      0,     -1,      0,     -3,      0,     -4,     -1,      1,    -10,     -4,     -8,     -4,      6,      3,     -2,     -7,     -4,    -17,     -7,      4,    -10,     -1,      3,     -5,      2,     -1,     -2,      3,    -13,      1,     -6,     -2,    -12,     -4,     -7,     -2,     -2,     -3,     -4,     -6,     -1,     -3,      3,      3,     -5,     -1,      3,     -2,     -2,     -5,     -2,      2,     -4,      3,     -3,     -1,     -8},
-    {     5,      1,      8,     -6,     -7,     -9,    -19,     -1,    -10,     -5,     -4,     -1,     -3,     -4,    -10,     -2,      1,     -7,      2,    -16,     -1,     -4,     -6,    -17,      1,     -3,      4,    -11,      1,      4,     -8,      1,     -6,     -3,      4,     -5,     11,     -4,      0,    -10,     -5,     -4,     -6,      5,     -4,    -10,     -2,      3,     -2,     -6,     -4,     -3,     -5,      1,     -5,     -7,      0,     -1,     -9,     -2,      6,     -5,     -4,     -4},
-    {     1,      6,      6,      0,      2,     -8,     -7,     -4,      0,     -3,     -6,    -11,     -4,     -5,      0,      1,    -12,     -6,      4,      4,      6,     -3,    -11,     -2,      1,     -7,     -1,     -3,     -1,      3,     -4,     -3,      0,     -2,     -3,     -1,      1,     -4,      1,     -6,     -2,     -6,      4,     -8,      4,     -6,     -8,     -7,     -1,      2,     -1,     -4,     -8,     -4,      2,    -15,     -2,     -1,     -9,     -7,      3,     -2,      5,     -1},
-    {    -4,      2,      7,     -7,      6,     -5,     -8,     -5,     -8,     -3,     -5,     -7,     -3,     -6,      1,      1,     -6,     -4,      5,     -8,     -3,     -2,     -1,     -8,     -4,     -4,     -1,     -3,      6,     -4,     -5,     -6,     -7,     -1,      5,      6,     -5,     -8,      5,     -1,     -6,     -3,     -7,     -1,      2,      2,     -3,      2,      1,      4,      3,     -8,     -5,     -3,     -5,      0,      2,      0,     12,     -4,      0,     -9,     -1,     -6},
-    {    10,    -11,     -2,    -12,      1,     -5,     -4,     -3,     -5,     -3,     -5,      0,    -17,      3,    -12,     -9,     -9,     -5,     -9,     -4,      4,     -2,    -16,    -12,    -10,     -7,     -3,    -15,     -6,     -1,     -5,      5,    -10,      0,     -7,    -15,     -6,     -2,      2,     -3,    -15,    -21,    -16,     -9,     -5,     -2,      1,     -2,     -1,     -8,     -4,      1,     -3,     -3,     -5,    -13,     -9,      9,     -6,     -5,     -1,    -16,      1,     -7},
-    {     8,      2,      0,    -12,     -2,      0,    -10,      3,      1,     -6,     -6,     -2,     -2,     -8,      4,    -11,     -2,      3,     -1,     -9,     -2,     -3,     -8,     -3,    -17,     -9,      9,      1,      1,     -4,     -5,      8,      5,     -8,     -4,    -23,     -2,      0,     -1,     -4,     -4,     -4,      5,     -4,      0,      3,     -1,     -6,      5,     -1,      2,     -6,     -2,     -9,     -4,     -8,      7,     -4,     -2,      4,     -2,     -4,      0,      3},
-    {     4,     -3,      2,     -6,      4,     -6,     -5,     -2,      5,     -3,      1,      4,      7,     -1,      9,     -4,     -5,     -1,      7,      3,     -6,     -2,     -5,     -7,     -3,     -3,     -2,     -7,      8,     -1,      2,      1,      3,      4,      2,      1,      5,     -3,      4,      0,     -6,      0,     -4,    -10,     -1,      4,     -1,      1,     -6,      4,     -5,      0,      2,     -8,     10,     10,      7,      2,      1,      0,      2,     -3,      4,      2},
-    {    -3,    -10,      1,    -11,      9,     -1,     -2,     -2,      0,     -3,    -10,      2,     -7,      3,     -3,      4,     -7,      5,     -5,     -7,      0,     -4,    -17,     -2,     -5,     -8,     -1,    -17,     -8,      1,      0,      0,      1,    -10,      3,    -16,      3,      3,     -6,     -8,     -6,    -10,     -5,     -6,     -4,     -4,     -2,     -3,     -6,     -3,      2,     -4,      1,     -1,      0,      0,      0,      0,      2,     -4,      0,    -10,     -4,      2},
-    {     1,     -3,      3,     -6,      4,      3,     -4,     -1,     -1,      2,     -5,      2,    -11,      5,     -2,      1,     -8,     -1,     -2,     -4,     -2,     -1,     -8,      3,     -7,     -2,      8,     -6,     -9,     -1,      0,      1,     -2,      9,     -1,    -12,     -2,      4,     -8,    -11,      2,    -10,     -1,      1,      2,     -1,     -1,     -2,      1,     -8,      5,     -3,     -1,      1,      6,     -4,      3,     -2,     -5,      4,      2,      3,     -3,     -8},
-    {    -1,      3,     -5,      7,      8,    -15,      5,      0,     -6,     -7,      4,     -9,      4,      4,     -1,     -4,      0,     -1,      2,     -9,      4,     -2,     -7,      0,     -1,    -10,     -3,     -1,      8,     -2,      2,     -4,      3,     -2,     -4,     -6,      2,      0,      1,     -2,     -1,     -6,      8,      3,      4,     -5,     -1,     -6,     -6,     -6,      4,      9,     -7,     -6,      9,     -6,      2,      1,      4,     -4,     -3,      5,      1,     -2},
-    {     3,     -2,     -3,    -15,      7,      3,     -4,      3,     -4,      0,      3,      0,     -8,     -4,     -1,     -5,     -1,     -7,     -9,     -5,     -1,      0,     -2,      7,    -11,     -4,     -3,     -3,     -9,     -2,     -6,      1,     -5,      1,    -13,     -1,      4,     -2,     -8,    -10,      0,    -12,     -2,      1,     -3,     -3,      3,     -5,     -4,     -5,     -5,      1,     -7,     -3,     -1,     -7,     -3,     -3,     -4,     -7,      0,     -5,     -2,      2},
-    {    -1,     -4,      5,     -9,      0,     -5,     -1,      4,     -3,     -9,     -4,    -12,     -1,      4,    -15,     -7,     -2,     -1,     -2,     -9,     -4,      5,     -4,     -2,     -7,     -2,      6,    -11,     -5,     -2,     -2,      0,    -12,      8,      9,    -13,      1,      3,     -3,     -5,     -4,      2,     -2,     -4,     -1,     -9,      1,     -1,      1,     -6,      5,     -8,     -3,     -5,     -1,      3,      2,     11,     -5,     -4,     -3,     -2,     15,     -3},
-    {     1,    -16,     -4,     -6,     -5,     -5,     -6,     -7,     -2,     -2,     -6,     -9,     -6,     -8,     -6,     -5,    -16,     -1,     -5,     -3,     -3,     -1,     -6,    -11,    -10,     -5,     -1,     -6,    -13,      3,    -16,      7,    -14,      1,    -11,    -12,     -9,      5,    -13,    -16,     -9,    -13,    -10,      1,     -9,      4,      0,      0,     -7,     -2,     -8,     -3,     -5,      2,     -1,    -10,     -5,     -5,     -7,     -2,      2,     -4,     -7,     -4},
-    {    -5,     -5,      4,      3,     12,     -3,      2,     -1,     -3,     -9,     -5,    -10,     -2,     -9,     -5,     -3,     -8,    -12,     -2,     -3,      1,     -5,      2,      3,     -8,     -4,     -3,     -6,      3,     -1,      2,     -1,     -3,     -1,      2,      0,      0,     -3,     -4,     -5,     -3,      1,      7,      6,      0,     -5,      5,    -11,      2,     -2,     -4,     -4,    -10,     -4,      4,     -5,      8,      1,     -2,      2,      7,     -7,      3,      5},
-    {     1,      2,      6,     -3,     -5,     -6,    -13,    -17,     -6,     -2,    -11,      0,     -2,    -13,     -2,     -1,     -7,     -4,     -3,    -10,      1,     -3,    -11,     -2,    -11,     -5,     -4,     -4,     -1,      2,     -5,     -2,    -16,      7,      2,    -16,     -1,      1,     -3,    -11,     -9,     -5,     -5,      8,     -5,     -7,     -1,     -3,    -10,     -4,     -1,     -4,     -4,     -3,      1,    -10,     -6,     -1,     -8,     -7,     -4,     -9,     -1,     -4},
-    {     1,     -4,      0,    -15,     -8,    -11,     -7,    -11,     -4,     -5,     -3,    -14,     -6,     -1,     -7,     -5,    -15,    -11,     -7,     -2,     -7,     -1,     -2,     -9,    -12,     -6,     -3,    -10,     -6,     -5,     -1,      3,      0,     -1,     -4,    -10,     -2,      4,     -4,     -6,     -9,     -3,      0,     -6,     -1,     -2,      2,     -4,     -4,      0,      0,      9,    -10,     -6,    -11,     -9,      0,      0,     -4,     -5,     -2,      3,     -8,      3},
-    {     5,     -3,     -1,    -12,      0,     -5,     -7,     -4,     -9,      0,      1,     -4,    -11,      2,     -2,      1,      1,      3,     12,     -5,      7,     -4,     -9,      0,     -6,     -2,     -1,      2,     -4,      2,     -1,      4,      2,     -6,     -3,     -2,      2,     -5,     -2,     -8,     -2,      0,     -9,     -5,      1,      1,     -8,     -5,     -2,      0,      3,     -5,     -8,    -10,     -1,      0,    -10,      2,     -6,     -3,      3,     -6,     -7,      5},
-    {    -1,    -10,      3,    -14,     -5,    -10,     -1,     -9,     -5,     -4,     -4,     -1,    -13,     -6,    -12,     -7,      2,     -6,      3,      0,     -2,     -4,     -5,      0,     -8,     -8,     -1,     -2,     -5,     -6,     -2,     -3,     -2,      0,     -4,     -1,      7,      0,     -3,     -7,     -2,    -14,     -8,     -5,     -9,     -1,      2,     -9,     -4,     -1,     -1,     -4,     -9,     -2,      2,    -15,     -7,      3,     -2,     -6,      3,    -11,     -3,     -8},
-    {     5,      0,      2,     -5,     -5,      0,     -5,     -1,     -3,    -16,     -2,    -12,     -3,      0,     -6,     -1,     -3,     -4,     -6,      3,     -2,     -1,     -6,    -11,     -4,     -5,     -4,     -5,     -6,      0,      8,      9,     -1,    -10,     -8,     -3,      2,     -7,     -6,    -10,      2,     -1,    -12,    -10,     -4,     -7,     -2,     -8,     -3,      3,     10,      3,     -3,      3,     -2,     -4,     -5,     -3,      2,     -2,     -2,     -3,     -3,      9},
-    {     0,    -13,     -4,    -12,     -4,     -6,    -12,     -4,     -4,      2,     -7,      7,    -15,     -9,     -9,      1,    -12,     -7,     -5,     -2,      1,      2,    -11,     -8,    -11,     -1,      0,     -5,    -10,     -1,    -11,      3,    -11,     -4,    -10,    -17,      9,     -8,    -13,     -4,     -2,    -23,    -11,      0,     -7,      3,     -2,     -2,     -3,      1,     -1,     -7,     -6,     -2,     -6,    -14,    -11,      0,     -3,     -4,     -2,     -1,     -3,      0},
-    {     1,     -5,      5,      2,      0,     -2,    -10,      0,    -13,     -4,    -10,      1,     -6,     -7,    -12,      3,    -11,      8,      2,    -13,      4,      4,     -4,     -6,     -8,     -5,      0,    -17,      0,     -7,     -3,      4,      0,     -5,      0,      1,     -1,     -5,      4,     -6,     -7,     -8,      1,     -6,      1,     -9,     -5,     -7,     -6,    -10,     -6,      3,    -13,     -7,      3,     -9,      3,      3,     -5,      1,      2,     -2,    -10,     -5},
-    {    -3,     -6,     -2,    -11,     -2,      2,     -1,      4,     -8,      2,     -8,     -8,    -10,      3,    -18,     -4,     -5,      5,     -3,      3,      3,      1,    -10,      5,     -1,     -5,     -9,     -2,      2,     -6,      0,      2,     -4,      1,     -5,     -7,     -1,     -4,      8,     -5,     -7,      1,      8,     -1,      0,     -5,      5,     -5,     -3,     -4,     -4,     -3,     -4,     -3,      8,      0,     -7,     -2,      3,     -1,      3,     -2,     -3,     -3},
-    {     8,     -3,      1,     -6,      1,     -5,     -1,      0,     -7,     -8,     -6,     -9,     -9,     -6,    -13,      0,     -5,     -5,      1,    -13,      2,      1,     -5,     -2,     -3,      0,     10,     -5,     -9,     -1,     -2,      7,      0,      1,     -2,     -6,     11,     -3,     -3,     -4,     -5,     -8,     -2,      0,     -3,     -4,     -3,     -1,     -5,     -2,     -2,     -4,     -4,      0,     -1,     -9,     -4,      8,     -2,     -1,      1,     -6,      0,     -2},
-    {     7,     -1,      0,     -7,      7,      4,     -5,      0,     -7,     -3,      0,    -10,     -2,      0,    -11,     -2,     -4,     -5,     -3,      5,     -3,     -3,     -4,     -7,     -3,      1,      4,     -4,     -8,      1,     -4,     11,    -11,      4,     -6,     -2,     -3,     -9,     -4,     -8,     -5,     -2,     -5,      2,     -8,     -2,      4,     -9,     -2,     -8,      3,     -1,     -3,     -5,     -1,    -10,     -2,      1,     -1,      2,     -1,      2,     -4,      7},
-    {     9,     -8,     -1,     -5,      5,      0,     -8,      6,      4,     -4,     -3,    -15,     -7,     -8,     -4,     -1,     -6,     -7,     -1,      1,      0,     -3,    -11,      1,     -6,     -5,      7,     -1,      4,      1,     -6,      3,    -11,      0,     -2,     -8,     -1,      1,     -8,     -4,     -6,     -7,     -6,     -1,      1,     -3,     -3,     -1,     -1,     -4,      1,     -6,     -7,      1,     -5,    -11,      2,     -5,      0,      4,      3,     -7,      2,     -3},
-    {    -4,     -4,      1,     -3,      3,     -7,     -1,     -1,     -7,     -9,    -10,     -5,     -5,      6,    -12,      3,     -4,    -10,      7,      0,     -2,     -1,     -2,      3,     -1,    -11,     -1,      1,     -4,     -4,     -2,      0,      6,     -3,     10,     -1,      2,      0,      5,     -1,     -4,     -4,      2,     -1,      3,     -4,     -3,      1,    -10,     -2,      2,     -5,     -9,     -3,      4,     -4,      5,      4,      3,     -5,     -2,     -2,      3,     -2},
-    {     5,    -13,     -2,    -12,      2,      1,    -18,     -8,      5,     -3,    -14,    -11,    -13,     -1,    -11,     -1,    -13,     -3,    -22,     -4,     -2,     -9,    -14,    -11,    -17,     -7,     -2,     -6,     -9,      2,      1,      4,     -5,    -12,     -9,    -15,      1,     -4,    -12,     -9,     -5,     -9,    -20,     -5,     -8,     -2,      2,      6,     -8,     -3,      6,     -3,     -9,      0,     -4,     -4,    -13,     -4,     -4,     -8,      3,    -11,     -8,     -4},
-    {    -6,      0,      5,     -5,      0,     -2,      6,     10,     -8,     -6,      7,     -8,     -6,      2,     -4,     -7,      0,    -10,      8,      1,      4,     -3,      1,      3,     -2,     -3,      1,     -8,     12,     -5,     -1,      3,      4,     -3,     -4,      3,     10,      7,     -4,     -4,     -2,     -4,      8,     -9,     11,     -4,     -9,     -1,     -7,     -1,      0,     -2,     -6,      0,     -7,     -1,     -2,     12,     -1,     -3,      7,      8,     -5,     -1},
-    {    -1,     -3,     -5,     -9,     -4,     -8,     -6,     -2,     -4,      0,     -2,     -3,     -1,      7,     -1,      3,     -5,     -2,     -2,      0,     -2,     -4,     -2,      4,     -4,     -3,     -4,     -1,      1,      0,     -6,     -4,     -1,     -5,      1,     -3,      1,     -7,      4,     -6,     -2,     -9,      3,      7,     -9,     -1,      2,      4,      2,      0,      0,      4,     -7,     -1,     -9,     -5,      4,      1,      5,     -1,      6,      0,      8,      0},
-    {     0,      3,      3,     -1,      4,    -12,    -10,      7,      0,     -2,    -10,      1,      1,      0,     -6,     -4,     -9,     -1,     -3,    -11,      2,      5,    -10,     -9,      3,     -9,      3,     -2,      4,     -1,     -2,      0,     -4,     -6,      2,      0,      5,    -11,     -3,     -6,      0,      0,     -5,      0,     -1,      0,      8,     -6,     -8,     -1,     -1,     -6,    -11,      4,      9,      3,      5,     -2,      3,      1,     -1,     -3,      1,     -6},
-    {     1,     -9,      6,      3,      9,      1,    -12,     -5,     -4,      0,      1,     -9,     -6,      3,     -2,     -8,      1,     -3,     -3,      3,      4,      1,     -6,     -7,     -6,     -2,     -3,      2,      0,      6,     -8,      5,      3,     -5,     -2,      0,      9,      1,     -2,    -12,     -3,      0,     -1,      1,      1,     -8,     -3,     -1,      1,      4,      6,      0,     -1,      4,      3,     -4,      1,     -1,     -8,      9,      6,     -5,     -8,    -10}
-};
-
-static const int16_t nnue_b2[64] = {
-      -254,   -244,   -199,   -254,   -152,     88,   -122,   -133, 
-         6,   -209,   -254,   -254,   -174,    -84,    160,   -149, 
-      -237,    -51,   -254,   -190,     -2,     71,   -235,     67, 
-      -216,   -254,   -224,    -94,    -34,   -249,   -254,   -188, 
-      -201,    -69,    103,   -241,   -173,   -173,   -146,     49, 
-      -243,    -89,   -211,   -254,   -191,     56,     -6,   -137, 
-      -246,    -33,    -85,   -252,   -212,   -206,   -186,     -4, 
-       -53,   -220,   -211,    -55,   -184,   -236,    186,   -125
-};
-
-static const int16_t nnue_w3[64][32] = {
-    {     0,     -1,     -7,      6,      0,      3,      4,     -4,      0,      1,      2,      7,     -2,     -3,      1,      7,     -5,      2,     -1,     -4,     -4,     -5,      3,     -6,     -2,      0,     -2,      0,     -1,      2,     -5,     -5},
-    {    -5,     -1,      8,    -11,     -5,     -1,      9,      1,     12,     -8,      4,     -4,     -3,     -4,      5,      2,      3,     -8,    -14,      3,      0,    -14,     10,    -17,      1,     -6,    -14,      0,     -5,      2,     -6,     -1},
-    {     2,     -1,     -6,      5,      3,     -6,      3,     -2,     -1,      4,     -3,      6,      6,     -4,      7,      7,      0,     -5,      4,      5,     -9,     -8,     -5,     -2,     -1,      0,      0,      5,      3,     -4,     -4,     -4},
-    {    -3,     -7,     11,      1,     -6,     11,      5,      2,     11,      2,     -4,     -6,      0,      6,     -1,     -2,      0,      7,     -7,      8,      2,     -3,     12,      7,     -4,      3,     -1,     -2,     -1,     -6,      5,     -4},
-    {     3,      0,     -4,      0,     -1,     11,     10,      5,     -2,     -3,      6,    -14,      0,      6,     -2,      4,      1,    -10,      4,     -4,    -10,      1,     -2,     -2,      0,     -2,     -1,      2,      5,     -2,     -6,     -1},
-    {    -2,      3,     -4,      6,      3,      4,      8,     -2,      4,      3,      1,     -4,     -1,      0,      0,      3,     -3,      0,      6,    -12,     -3,      9,      2,      5,     -2,      1,      4,      3,     -1,      1,     -7,      0},
-    {     1,     -1,      5,     -5,      2,      0,     11,     -1,      4,      4,      3,    -10,      3,      1,     -1,      7,     -4,     -2,     -9,      7,      8,    -13,     10,    -17,      3,     -5,     -3,      1,     -4,      1,      6,     -1},
-    {    -1,      0,     -8,      2,      7,     -4,      5,      2,     -4,      5,      0,     -9,      3,      3,      4,      7,     -2,      5,     -6,     -6,      0,     -7,      1,    -11,      0,      5,     -6,      1,     -5,      1,     -5,     -1},
-    {     0,     -1,     -4,     -3,    -12,      0,      4,     -1,     -4,      2,     -1,      4,     -5,      2,      3,      5,     -1,      0,     -8,     -5,     -1,      6,      7,     -5,     -5,      0,      2,      8,     -1,      1,     -7,     -1},
-    {    -1,     -1,     -8,     -2,      3,     -2,      8,      3,     -5,     -3,      7,     -1,     -1,      9,      6,      5,     -1,     -2,      5,      2,     -2,      5,      5,     10,     -3,      0,      6,      0,      1,      2,      1,     -3},
-    {   -11,      0,      0,     -5,     -7,     -3,      2,     -7,      0,     -1,     -3,     -1,     -3,      5,      2,      3,      0,     -5,     -3,      3,     -2,     -4,     -3,     -5,     -1,     -2,     -5,      1,     -4,     -1,     -4,     -2},
-    {    -1,      0,      4,     -5,    -12,      6,     -3,      3,     15,      6,      0,     -2,     -7,      0,      0,     -4,     -8,     -1,     -1,     -4,      3,      6,      1,     10,     -2,     -3,      0,      3,      4,      3,      5,     -3},
-    {     4,      1,     13,    -14,     -1,     -8,      9,     -3,      6,      6,      4,     -8,      0,     -4,      1,     -1,      0,     -7,     -8,     14,     -1,    -15,      3,    -13,      0,     -5,    -10,     -1,     -2,      0,     -3,     -3},
-    {    -4,     -1,      0,     16,      0,      2,      1,      3,      1,     -2,      4,      9,     -5,      0,      2,      3,      4,     -4,     -9,    -10,     -2,    -14,      0,    -17,     -1,     -8,    -10,     -4,    -10,      2,    -19,      0},
-    {    -1,      1,      8,     -7,     -8,     -5,     -7,     -7,     11,     -2,    -16,     -6,     10,     -8,     -2,      2,     -2,      9,     -8,      7,      2,     -8,      6,     -7,     -1,     -3,     -7,     -7,      2,     -6,      6,     -1},
-    {    -2,      3,     -6,     -8,      5,      4,      5,      2,     -7,      0,     -1,     -8,     -4,      6,      5,      0,      2,     -1,     -1,     -4,      1,     -1,     -2,     -2,     -1,     -6,     -2,     -4,      1,     -2,      0,     -5},
-    {   -10,     -9,      0,      0,      1,      0,      6,     -4,      1,      0,     -5,     -5,      4,     -2,      2,    -10,      1,     -2,      1,      4,      4,     -3,      6,     -1,     -7,      1,      3,     -5,     -3,      0,      0,     -1},
-    {    -1,      4,      4,     -1,      6,      1,      6,     -2,     -2,      1,      2,      3,      3,      0,      1,      7,     -3,     -4,      4,     -7,      5,      1,     -9,      1,     -1,      0,      0,      4,     -4,     -2,     -1,     -2},
-    {    -3,     -5,      3,      6,      4,     -4,     -2,     -7,      4,     -1,      0,     -2,      2,    -16,      3,     -2,      6,    -14,    -12,     -3,     -4,    -13,     -1,    -16,     -3,     -2,     -7,     -3,    -10,     -2,     -7,     -1},
-    {    -7,      1,     12,      2,     -7,     10,      1,     -9,      2,     -1,     -8,      6,     -6,      4,     -5,     -5,    -10,      3,     -6,     -8,      5,     -2,      1,     -4,     -3,     -9,      2,     -7,     -3,     -1,      3,      1},
-    {    -6,      1,     -6,     -5,      4,     -3,      0,      2,      4,     -1,      2,     -7,     -4,      1,      5,      3,      1,     -3,      2,      7,     -5,     -1,     -3,      5,     -2,     -1,      6,      9,      2,      1,    -10,     -4},
-    {    -1,     -2,      5,      2,      1,     -3,      1,      3,     -7,      0,      4,     -1,     -5,     -2,      2,      0,     -2,     -6,      2,      9,     -9,      0,     -1,     -2,      1,     -7,     -4,      4,     -3,      0,     -3,     -4},
-    {    -7,     -4,     -2,     -4,      1,      5,     16,     -4,      4,      5,      3,     -8,      1,     -3,      0,     -2,     -1,      1,     -3,      2,     -1,    -16,      6,     -7,     -3,      0,      6,     -3,      0,     -1,      0,     -3},
-    {     3,     -2,      2,     -5,      5,      0,     10,      3,      8,      4,      2,      3,     -3,     -3,      3,      4,      1,      4,     -8,      7,     -6,    -14,      2,     -1,     -1,     -3,     -6,      1,     -3,      2,      3,      0},
-    {    -6,     -6,      6,     -7,     -3,      1,      9,     -3,      8,      5,      1,     -9,      5,      2,      2,     -3,     -7,     -8,     -9,     -2,      4,    -14,      8,    -10,     -4,     -9,     -2,     -1,      2,     -7,      1,     -2},
-    {    -2,      5,      2,     -1,     -2,     -1,      6,     -3,      0,      3,      5,     -1,     -4,     -1,      2,     10,     -2,      6,      1,     -5,     -4,      4,     -2,      2,      2,     -4,      2,      1,      0,      0,      4,     -1},
-    {    -2,      0,     -7,     26,      3,     -2,      4,     -2,     -7,    -13,     -5,     14,     -4,     -5,      4,      7,      5,     -9,     -7,      2,     -3,     -5,     -7,      1,     -1,     -2,     -2,     -5,     -5,      0,      1,     -1},
-    {    -3,     -7,     13,     -3,     -3,      7,      4,      6,      8,     -3,      0,     -1,      3,      7,      2,     -1,     -8,     -6,      3,     12,     -7,     -3,      4,     -9,     -2,     -3,      2,     -1,      2,     -5,      9,     -5},
-    {    -3,     -5,      3,      0,      8,     -6,      5,    -14,      7,     -1,     -3,     -7,     -1,     -9,      4,      4,      1,     -2,     -9,      4,     -2,    -17,     -4,    -22,     -3,     -1,    -17,      0,     -5,     -1,     -7,     -1},
-    {    -3,     -3,     -4,      1,     -4,      7,      1,    -10,     -2,      6,     10,     -3,      3,      5,      2,      4,     -2,     -6,    -10,     -4,     -1,     -4,     -5,      3,      1,     -4,     -5,     -3,      8,     -2,     -3,     -2},
-    {     7,      6,      1,     -5,     -6,     -2,      3,      0,      0,      8,      6,     -7,     -2,      3,      4,      1,      2,      1,     -6,      0,      0,    -13,     -5,     -2,     -2,     -5,      1,     -2,     -2,      1,     -3,     -2},
-    {    -6,     -3,     -1,      3,      4,      0,      7,     -5,      6,      2,     -2,      1,     -3,     -2,     -5,      3,      7,     -3,     -6,      0,     -5,     -6,     -8,    -12,     -1,      2,     -7,     -3,     -3,      2,    -10,     -3},
-    {   -10,     -6,      0,     13,      9,      1,      4,     -4,      8,     -2,      2,      5,      6,    -18,      5,     -1,     -1,      6,    -13,      7,      1,    -14,     -8,    -22,     -5,     -3,    -19,     -5,    -12,     -6,     -3,     -1},
-    {     1,     -6,      0,      2,     -1,      5,      8,     -9,      2,      8,     -5,      0,     -3,     -3,      4,      2,      2,     -2,     -4,      6,     -1,     -1,    -12,     -4,     -4,     -3,     -7,     -3,     -2,     -2,      5,     -3},
-    {    -7,     -6,    -16,     24,     12,      3,    -13,     -3,     -9,      3,      2,     13,      4,     -7,      4,      4,      5,    -10,    -14,     -1,      0,    -18,     -7,    -16,     -5,      5,     -8,     -5,    -13,     -3,     -9,     -4},
-    {    -5,     -8,      9,     -3,     -8,     -1,      3,      0,      5,     -2,     -1,      0,      8,     -4,      1,     -5,     -8,      8,     -7,      1,     -5,     -4,      9,    -13,      1,     -8,     -6,     -1,      3,      1,     -2,     -2},
-    {     7,      6,     -6,      9,     -2,      3,      1,     -8,      1,     -1,     10,      0,      0,     -3,      1,      5,     -2,     -8,      3,      2,    -10,     -7,    -10,     -4,      1,      2,    -10,     -4,     -7,      3,     -5,     -4},
-    {    -7,      4,    -10,     14,      3,      0,     -4,     -6,      1,     -6,      2,      5,     -3,      3,      0,      0,     -3,     -7,      2,     -9,      1,     -9,     -6,     -8,     -3,     -2,      3,     -5,     -6,     -2,     -5,     -1},
-    {    -8,     -4,      4,     -1,     -2,     -6,      5,     -9,     10,     -4,      5,     -4,     -6,     -2,     -5,      0,      6,     -2,     -8,      3,     -2,    -11,     -9,    -18,     -4,      1,    -10,     -2,     -6,     -2,      3,     -2},
-    {    -5,      1,      5,     -3,      1,      4,      5,     -1,      2,      4,      4,      1,      4,      1,      3,      0,      8,     -1,    -10,      7,     -2,     -9,    -11,     -1,      0,     -4,    -11,     -2,     -6,      0,      3,     -1},
-    {     0,      1,     -6,     -4,      7,     -2,      9,      6,      2,      3,      5,      4,     -4,     -4,      2,      1,      1,     -3,      4,      4,     -4,     -1,      2,     -8,      0,     -5,      4,      3,      1,      0,     -4,      0},
-    {    -2,      2,      5,     -9,    -10,      0,     -6,    -10,     14,      1,    -10,    -12,     -1,     -3,      5,     -1,      6,     -3,    -10,      1,      6,     -9,      1,    -13,     -1,     -3,      2,      0,     -7,     -3,      5,     -2},
-    {     3,      4,      4,      6,      4,      1,      2,     -9,      0,     -1,     -1,      1,      8,     -8,      4,      2,      9,     -1,    -14,      2,     -4,    -14,    -10,    -12,      1,     -4,    -13,     -4,     -6,     -2,     -5,     -3},
-    {    -1,     -1,      2,      1,      0,     -2,      7,      1,     -7,      7,     -6,      4,      1,      3,     -6,      1,      5,     -5,     -7,      7,     -6,     -1,      1,     -2,     -3,      1,      0,     -1,      2,     -2,     -6,     -3},
-    {     0,      9,    -13,      2,      1,    -10,     -4,     -5,     -4,     -2,      5,     -2,      3,     -3,      3,     -1,      5,     -7,      2,     -3,     -2,     -5,     -3,     -2,     -2,      0,     -4,      0,     -1,      1,     -9,     -1},
-    {     7,      1,     -5,      5,     -8,      0,      0,      0,     -3,      3,      4,     -1,      4,     10,      4,      4,     -4,      4,      5,     -1,      2,      4,     -2,      1,      2,      0,      1,      2,      6,     -3,     -2,     -4},
-    {     1,      4,      2,     -2,     -1,     -7,     -2,      4,     -6,     -4,      0,     -1,     -1,     -1,      7,      7,      3,     -2,     -4,      1,     -5,      2,     -4,      8,      1,     -2,      0,      0,     -3,      1,     -7,     -2},
-    {     1,     -4,      0,      6,     -1,      3,     10,     -4,      5,      3,      5,      0,      2,     -2,      0,      0,     -5,      2,      4,      9,     -1,      7,     -9,     -1,      3,     -1,     -6,      5,      1,      2,      6,     -3},
-    {    -3,     -6,     -5,     -6,      0,      2,      4,      1,     -8,      2,      3,     -3,      5,      6,      6,      9,     -4,    -10,      2,      1,      2,      1,      4,     -6,      0,      1,     -1,      0,      4,      1,      3,     -1},
-    {     5,     -2,      4,      0,     -1,      2,      7,     -8,      2,      1,     -3,      0,     -5,     -2,      2,     -1,     -1,      3,     -3,     -6,     -9,     -3,     -1,      1,     -3,     -2,     -4,     -2,     -5,      1,     -6,     -5},
-    {    -3,     -1,     -3,      5,      5,     -9,      4,      3,     -8,      6,      0,      0,     -6,      4,     -2,      5,     10,     -3,      9,      1,     -6,     -3,     -4,     -6,     -2,     -4,      0,      2,      8,      3,      1,     -4},
-    {     1,     -3,      0,     -5,     -1,     -4,      0,     -4,      1,      1,      4,     -6,     -2,     -5,      1,      1,      4,     -4,     -3,     -7,     -3,     -1,     -7,     -3,     -2,     -3,     -4,      4,     -1,     -5,     -6,     -5},
-    {    -4,     -9,     10,     -5,     -4,      7,      0,      0,     10,      4,     -6,      1,      0,      3,      0,     -9,    -10,     -6,      2,     -1,      1,     -2,     10,     -3,     -3,      0,     -2,    -10,      1,     -3,      4,     -2},
-    {     3,      6,      0,      3,    -11,     -1,      3,     -5,     -8,     11,      8,     -1,     -5,     -1,      7,      9,     -4,     -1,      1,     -2,     -2,      7,     -2,      3,     -3,      3,      4,      1,      2,      1,     -5,     -2},
-    {    -3,     11,     -4,      1,     -4,     -5,      5,     -5,     -4,      4,     -4,     -3,      1,     -2,      0,      2,     -4,     -9,      2,     -3,     -7,     -7,     -5,      1,     -2,     -2,     -4,      2,      4,      0,     -5,     -3},
-    {   -10,     -4,      9,      1,      1,     -8,     -2,      2,      1,      3,     -4,      9,      5,     -3,      2,     -5,     -1,     -7,     -2,     -5,      0,     -9,      7,     -5,     -3,     -4,     -6,     -2,      2,     -3,      2,     -2},
-    {    -3,     -6,    -10,     12,     -2,     -1,      1,     -8,     -8,     -7,      3,      7,      5,      1,      6,      2,      3,     -6,     -7,     -5,      1,    -20,    -11,    -21,     -1,      3,     -6,     -2,     -8,     -3,     -4,     -3},
-    {    -5,      1,     -5,     -5,      4,     -2,      1,     -3,     -2,     -4,     -3,      5,     -3,     -3,      1,      5,      0,     -5,     -4,     -1,     -4,     -2,     -8,     -1,     -2,      3,    -10,     -2,     -1,     -4,     -8,      1},
-    {     4,     -6,     -4,     -6,     -4,     -3,      8,     -2,      0,      4,      2,    -17,     -5,      2,      3,     11,      3,     -2,     -1,      0,     -1,     -7,     -2,     -1,      4,      0,      2,     -3,     -4,     -1,    -10,     -1},
-    {    -5,     -1,      0,     -6,      0,     -4,      0,      1,      0,      6,     -1,      3,     12,     -6,      1,      6,     -2,    -12,      0,    -10,     -4,     -4,      0,     -1,     -2,     -1,     -1,      5,      0,      1,      8,      0},
-    {    -4,      5,     -2,      2,      2,     -5,      5,      3,      0,     -5,     -1,     -1,      0,      4,     -2,      8,      2,     -5,      1,      0,    -10,      1,      1,      0,     -2,      0,      0,      4,     -7,      1,     -5,     -2},
-    {     3,      4,      1,     -1,      8,      3,      4,     -1,      3,      1,      5,     -4,     -9,     -2,      4,      5,     -2,     -8,     -6,     -1,      5,     -4,      5,    -12,      0,     -5,     -6,      6,     -8,      2,     -2,      0},
-    {     5,    -12,     -5,     13,     -3,     -2,     -5,      0,    -11,     -2,      0,      4,      1,     -5,      7,     -1,      6,     -7,     -6,      5,      4,    -14,    -13,    -16,     -1,     -5,     -4,     -2,    -12,     -2,     -3,     -2},
-    {    -1,     -2,     -6,     -2,     -6,      2,      0,      0,     -4,     -2,      6,     -3,     -2,    -10,      1,      4,      6,      3,     -6,      1,     -5,    -10,     -2,    -16,      4,     -5,    -12,      3,     -6,      5,     -5,     -4}
-};
-
-static const int16_t nnue_b3[32] = {
-      -197,   -251,   -235,   -196,    -41,   -254,   -243,   -184, 
-      -172,    -66,   -204,      9,   -114,    -90,   -217,   -251, 
-      -156,    -50,   -238,    -82,   -244,   -147,    -53,    -23, 
-      -245,   -226,    100,   -253,    141,   -251,   -202,   -254
-};
-
-
-static const int16_t nnue_w4[32] = {
-      8,   11,    7,  -27,
-     11,   -5,  -13,  -10,
-      9,   -9,    6,   -8,
-     13,  -15,    4,    7,
-     16,   16,  -18,   13,
-      9,  -44,   16,  -52,
-      2,   -3,  -24,    6,
-    -16,    2,    7,    1
-};
-
-static const int16_t nnue_b4[1] = {
-        36
-};
-
-static const int16_t nnue_bn_gamma1[128] = {
-       127,    128,    130,    130,    134,    130,    129,    125, 
-       133,    125,    130,    127,    130,    127,    123,    124, 
-       125,    131,    127,    125,    134,    126,    132,    136, 
-       134,    125,    125,    133,    127,    132,    130,    129, 
-       131,    128,    132,    132,    131,    134,    125,    126, 
-       129,    133,    123,    126,    131,    134,    130,    133, 
-       131,    131,    128,    128,    127,    131,    131,    130, 
-       127,    130,    132,    128,    120,    130,    130,    127, 
-       129,    123,    126,    119,    130,    126,    132,    131, 
-       130,    134,    125,    132,    130,    132,    131,    129, 
-       130,    119,    125,    133,    133,    131,    126,    132, 
-       127,    127,    128,    125,    132,    130,    131,    129, 
-       133,    128,    132,    131,    133,    128,    127,    134, 
-       131,    129,    126,    125,    129,    128,    131,    132, 
-       130,    125,    129,    128,    129,    131,    131,    132, 
-       131,    128,    130,    134,    127,    123,    131,    127
-};
-
-static const int16_t nnue_bn_beta1[128] = {
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0
-};
-
-static const int16_t nnue_bn_gamma2[64] = {
-       122,    125,    129,    128,    129,    127,    123,    129, 
-       122,    128,    123,    129,    125,    121,    125,    124, 
-       125,    125,    126,    123,    125,    127,    126,    122, 
-       123,    125,    124,    123,    120,    129,    125,    128, 
-       124,    121,    128,    124,    127,    122,    125,    123, 
-       124,    120,    129,    124,    129,    127,    126,    132, 
-       124,    123,    131,    124,    126,    129,    127,    121, 
-       124,    127,    129,    124,    129,    126,    127,    126
-};
-
-static const int16_t nnue_bn_beta2[64] = {
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0
-};
-
-static const int16_t nnue_bn_gamma3[32] = {
-       128,    127,    119,    118,    124,    124,    131,    128, 
-       119,    127,    128,    122,    119,    125,    127,    128, 
-       126,    120,    124,    120,    122,    127,    123,    127, 
-       124,    124,    125,    127,    125,    125,    121,    125
-};
-
-static const int16_t nnue_bn_beta3[32] = {
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0, 
-         0,      0,      0,      0,      0,      0,      0,      0
-};
-
-static const float nnue_bn_mean1[128] = {
-    -3.152202f, -0.741129f, 1.537194f, -1.670146f, 
-    4.412823f, 0.893151f, -1.275821f, -0.854372f, 
-    -2.428089f, -2.789216f, -1.603064f, -2.273585f, 
-    -0.666483f, -0.993114f, -2.168650f, -1.969873f, 
-    -2.479200f, 2.264951f, -1.687117f, -0.296839f, 
-    -3.005656f, -0.874010f, -1.148079f, 1.934113f, 
-    0.861329f, -1.410181f, -0.934612f, 0.879848f, 
-    -1.131828f, 0.598899f, 2.488116f, 5.686697f, 
-    -2.388058f, -0.223824f, 1.566764f, 0.354639f, 
-    4.625873f, -2.496436f, -1.779774f, -3.941687f, 
-    -3.883825f, 2.684864f, -2.070757f, -2.509288f, 
-    -0.540989f, 2.062085f, -0.647225f, 2.011559f, 
-    -1.407005f, 0.976639f, -1.239643f, -0.493553f, 
-    -2.687130f, -1.862480f, -0.343179f, 1.331162f, 
-    -0.361567f, 3.125839f, 3.715665f, -2.693244f, 
-    -1.626161f, -0.496247f, 0.344244f, -2.428668f, 
-    0.441131f, -1.491610f, -2.800881f, -1.963027f, 
-    2.530914f, -3.996974f, 0.230100f, 0.838050f, 
-    3.358314f, 0.390121f, -0.995762f, 8.486859f, 
-    -2.229512f, 0.654390f, -1.582736f, 1.249458f, 
-    -0.505681f, -1.340715f, -3.426728f, -1.539345f, 
-    2.386426f, 0.108042f, -1.743533f, 1.687899f, 
-    0.845153f, -2.176224f, 0.384949f, -2.459154f, 
-    -0.820619f, -0.642487f, 1.085419f, 2.355635f, 
-    2.501682f, -1.613193f, -0.400941f, -0.418794f, 
-    -2.604705f, 6.341526f, -0.792932f, -2.835541f, 
-    -1.333472f, -1.940373f, -3.082024f, 2.526720f, 
-    -1.705495f, -0.807334f, -0.107096f, 0.497359f, 
-    5.988043f, -2.322472f, 0.518409f, 4.249300f, 
-    1.727660f, 0.318899f, -1.026169f, 2.832058f, 
-    1.984829f, -2.218293f, 1.916516f, 8.664614f, 
-    -2.264503f, -1.598105f, -0.905238f, 0.059299f
-};
-
-static const float nnue_bn_var1[128] = {
-    0.042613f, 0.025526f, 0.086697f, 0.128894f, 
-    0.081383f, 0.084955f, 0.071816f, 0.046862f, 
-    0.082004f, 0.137568f, 0.110524f, 0.018683f, 
-    0.057172f, 0.099083f, 0.085059f, 0.025964f, 
-    0.105529f, 0.084760f, 0.113074f, 0.063957f, 
-    0.029912f, 0.033522f, 0.208747f, 0.134930f, 
-    0.144241f, 0.038243f, 0.060858f, 0.070742f, 
-    0.041220f, 0.191421f, 0.282584f, 0.729353f, 
-    0.059454f, 0.086449f, 0.063361f, 0.101550f, 
-    0.199805f, 0.075784f, 0.036827f, 0.042476f, 
-    0.093097f, 0.078080f, 0.033345f, 0.129661f, 
-    0.070138f, 0.098973f, 0.163485f, 0.272768f, 
-    0.077344f, 0.129582f, 0.077658f, 0.036534f, 
-    0.057513f, 0.053250f, 0.030660f, 0.025966f, 
-    0.188862f, 0.034124f, 0.059783f, 0.050407f, 
-    0.135250f, 0.130479f, 0.027999f, 0.099976f, 
-    0.034511f, 0.032347f, 0.040051f, 0.049489f, 
-    0.054217f, 0.098411f, 0.091390f, 0.102592f, 
-    0.038465f, 0.044498f, 0.027402f, 0.573355f, 
-    0.030138f, 0.298179f, 0.092181f, 0.035115f, 
-    0.047750f, 0.081633f, 0.062867f, 0.117276f, 
-    0.056625f, 0.103783f, 0.042491f, 0.044949f, 
-    0.069583f, 0.049550f, 0.068772f, 0.036801f, 
-    0.078234f, 0.061927f, 0.069869f, 0.048018f, 
-    0.194425f, 0.027875f, 0.045061f, 0.153825f, 
-    0.065526f, 0.474147f, 0.039072f, 0.044100f, 
-    0.057997f, 0.015179f, 0.032250f, 0.268520f, 
-    0.041616f, 0.086756f, 0.081357f, 0.128531f, 
-    0.224120f, 0.075035f, 0.084214f, 0.146278f, 
-    0.350708f, 0.089208f, 0.025339f, 0.102151f, 
-    0.209754f, 0.048181f, 0.075026f, 0.445516f, 
-    0.033785f, 0.017768f, 0.105944f, 0.061557f
-};
-
-static const float nnue_bn_mean2[64] = {
-    -1.325846f, -2.982300f, -1.127484f, -3.877228f, 
-    -0.762648f, -0.330396f, -2.581607f, -1.596522f, 
-    -1.401755f, -3.148480f, -3.453418f, -4.447477f, 
-    -2.788877f, -1.030364f, -0.443562f, -1.794188f, 
-    -3.369311f, -1.826025f, -1.977947f, -2.749263f, 
-    0.094268f, -0.179282f, -3.637237f, -1.014890f, 
-    -3.666377f, -3.766633f, -1.230087f, -2.972965f, 
-    -0.140127f, -2.354138f, -2.761362f, -0.882652f, 
-    -2.179424f, -0.995189f, 0.969236f, -4.131924f, 
-    -0.817324f, -1.403364f, -1.386012f, -2.128974f, 
-    -3.481716f, -2.319432f, -1.987760f, -2.530803f, 
-    -1.151526f, -0.973430f, -0.215246f, -2.388394f, 
-    -3.404438f, -0.732760f, -0.518574f, -2.429647f, 
-    -3.466443f, -2.566742f, -1.458329f, -1.761600f, 
-    -0.490128f, -0.941086f, -1.884704f, -1.370017f, 
-    -1.054529f, -3.328848f, 1.566655f, -1.136067f
-};
-
-static const float nnue_bn_var2[64] = {
-    0.249562f, 0.302124f, 0.132324f, 0.297617f, 
-    0.109572f, 0.090872f, 0.220217f, 0.166194f, 
-    0.090859f, 0.142058f, 0.121089f, 0.204831f, 
-    0.314775f, 0.161857f, 0.353454f, 0.057301f, 
-    0.121974f, 0.098413f, 0.265398f, 0.097519f, 
-    0.111142f, 0.092801f, 0.156911f, 0.163948f, 
-    0.237353f, 0.079301f, 0.100583f, 0.231066f, 
-    0.255085f, 0.067441f, 0.089597f, 0.238218f, 
-    0.182781f, 0.071166f, 0.407201f, 0.473437f, 
-    0.076557f, 0.065035f, 0.210367f, 0.210900f, 
-    0.081270f, 0.272148f, 0.323859f, 0.074923f, 
-    0.167905f, 0.151114f, 0.173140f, 0.063732f, 
-    0.143910f, 0.051182f, 0.219910f, 0.080022f, 
-    0.117544f, 0.108957f, 0.071313f, 0.257203f, 
-    0.344009f, 0.194460f, 0.190664f, 0.104636f, 
-    0.055046f, 0.207008f, 0.151058f, 0.087850f
-};
-
-static const float nnue_bn_mean3[32] = {
-    -1.822110f, -2.160989f, -1.846261f, -1.310031f, 
-    -0.417888f, -1.976864f, -1.227415f, -1.874711f, 
-    -1.113841f, -0.241694f, -1.533775f, -0.052520f, 
-    -0.891340f, -0.870391f, -1.447011f, -1.679172f, 
-    -1.246217f, -0.894368f, -2.625583f, -0.508302f, 
-    -2.217696f, -2.296005f, -0.564003f, -1.342687f, 
-    -2.130707f, -2.251410f, 0.082487f, -2.132840f, 
-    0.692964f, -2.105748f, -1.949547f, -2.415455f
-};
-
-static const float nnue_bn_var3[32] = {
-    0.079551f, 0.076048f, 0.155267f, 0.241793f, 
-    0.080978f, 0.044757f, 0.204906f, 0.109845f, 
-    0.132753f, 0.066911f, 0.033540f, 0.090538f, 
-    0.041244f, 0.100056f, 0.064987f, 0.064862f, 
-    0.102995f, 0.195027f, 0.449948f, 0.100775f, 
-    0.055273f, 1.048397f, 0.112751f, 1.175662f, 
-    0.027923f, 0.142884f, 0.385083f, 0.050977f, 
-    0.191821f, 0.037114f, 0.143124f, 0.065669f
-};
-
-#define NNUE_SCALE 127
-#define NNUE_OUTPUT_SCALE 200
-#define HAS_NNUE_WEIGHTS
-
-#endif // NNUE_WEIGHTS_GENERATED_H
@@ -0,0 +1,258 @@
+// pattern_fit.c - Fit the OctaFlip pattern tables from recorded games
+// Team Shannon - Assignment 3
+//
+// Usage: ./pattern_fit [-o octaflip.pat] [-epochs N] octaflip_game_*.log
+//
+// Reads every board the server logged ("Board State:" blocks) together with
+// the game's final score and fits the pattern tables by least squares to the
+// disc margin the side to move still gains: final minus current margin, from
+// its point of view. Boards are read with the side to move's pieces as digit
+// 1, and configurations related by the instance's board symmetry share one
+// weight.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "patterns.h"
+#include "game_log.h"
+
+#define BOARD_SIZE 8
+#define REGULARIZATION 20.0  // pulls rarely seen configurations towards 0
+#define STEP 0.1             // at most 1 / PATTERN_INSTANCES, or the updates diverge
+
+typedef struct {
+    uint16_t index[PATTERN_INSTANCES];
+    float target;
+} Position;
+
+static Position* positions = NULL;
+static size_t positionCount = 0;
+static size_t positionCapacity = 0;
+
+// Canonical (smallest) index of every configuration under PATTERN_MIRROR
+static int32_t* canonical[PATTERN_TYPES];
+
+static int digitsOf(int index, int length, int* digits) {
+    for (int k = 0; k < length; k++) {
+        digits[k] = index % 3;
+        index /= 3;
+    }
+    return length;
+}
+
+static int indexOf(const int* digits, int length) {
+    int index = 0;
+    for (int k = length - 1; k >= 0; k--) {
+        index = index * 3 + digits[k];
+    }
+    return index;
+}
+
+static void buildCanonical() {
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        int length = PATTERN_LENGTH[t];
+        canonical[t] = malloc(PATTERN_TABLE_SIZE[t] * sizeof(int32_t));
+        
+        for (int index = 0; index < PATTERN_TABLE_SIZE[t]; index++) {
+            int digits[PATTERN_MAX_LENGTH], mirrored[PATTERN_MAX_LENGTH];
+            digitsOf(index, length, digits);
+            for (int k = 0; k < length; k++) {
+                mirrored[k] = digits[PATTERN_MIRROR[t][k]];
+            }
+            int other = indexOf(mirrored, length);
+            canonical[t][index] = index < other ? index : other;
+        }
+    }
+}
+
+// side: 0 when red is to move, 1 when blue is
+static void addPosition(const char board[BOARD_SIZE][BOARD_SIZE], int finalMargin, int side) {
+    if (positionCount == positionCapacity) {
+        positionCapacity = positionCapacity ? positionCapacity * 2 : 4096;
+        positions = realloc(positions, positionCapacity * sizeof(Position));
+        if (!positions) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+    }
+    
+    Position* pos = &positions[positionCount++];
+    int margin = 0;
+    for (int r = 0; r < BOARD_SIZE; r++) {
+        for (int c = 0; c < BOARD_SIZE; c++) {
+            if (board[r][c] == 'R') margin++;
+            else if (board[r][c] == 'B') margin--;
+        }
+    }
+    pos->target = side ? margin - finalMargin : finalMargin - margin;
+    
+    char own = side ? 'B' : 'R';
+    char opponent = side ? 'R' : 'B';
+    
+    for (int i = 0; i < PATTERN_INSTANCES; i++) {
+        int digits[PATTERN_MAX_LENGTH];
+        int length = PATTERN_LENGTH[PATTERN_LIST[i].type];
+        for (int k = 0; k < length; k++) {
+            int sq = PATTERN_LIST[i].squares[k];
+            char piece = board[sq / BOARD_SIZE][sq % BOARD_SIZE];
+            digits[k] = piece == own ? 1 : (piece == opponent ? 2 : 0);
+        }
+        pos->index[i] = indexOf(digits, length);
+    }
+}
+
+static void addGame(const GameLogGame* game, void* ctx) {
+    (void)ctx;
+    for (int i = 0; i < game->boardCount; i++) {
+        addPosition(game->boards[i], game->red - game->blue, game->toMove[i]);
+    }
+}
+
+static uint32_t checksum(const unsigned char* data, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static double predict(const Position* pos, double* weights[PATTERN_TYPES]) {
+    double sum = 0.0;
+    for (int i = 0; i < PATTERN_INSTANCES; i++) {
+        int t = PATTERN_LIST[i].type;
+        sum += weights[t][canonical[t][pos->index[i]]];
+    }
+    return sum;
+}
+
+// Jacobi-style least squares: every weight moves by its mean residual,
+// damped by REGULARIZATION for configurations seen only a few times
+static void fit(double* weights[PATTERN_TYPES], int epochs) {
+    double* gradient[PATTERN_TYPES];
+    double* count[PATTERN_TYPES];
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        gradient[t] = malloc(PATTERN_TABLE_SIZE[t] * sizeof(double));
+        count[t] = calloc(PATTERN_TABLE_SIZE[t], sizeof(double));
+    }
+    
+    for (size_t p = 0; p < positionCount; p++) {
+        for (int i = 0; i < PATTERN_INSTANCES; i++) {
+            int t = PATTERN_LIST[i].type;
+            count[t][canonical[t][positions[p].index[i]]] += 1.0;
+        }
+    }
+    
+    for (int epoch = 1; epoch <= epochs; epoch++) {
+        for (int t = 0; t < PATTERN_TYPES; t++) {
+            memset(gradient[t], 0, PATTERN_TABLE_SIZE[t] * sizeof(double));
+        }
+        
+        double squaredError = 0.0;
+        for (size_t p = 0; p < positionCount; p++) {
+            double error = positions[p].target - predict(&positions[p], weights);
+            squaredError += error * error;
+            
+            for (int i = 0; i < PATTERN_INSTANCES; i++) {
+                int t = PATTERN_LIST[i].type;
+                gradient[t][canonical[t][positions[p].index[i]]] += error;
+            }
+        }
+        
+        for (int t = 0; t < PATTERN_TYPES; t++) {
+            for (int c = 0; c < PATTERN_TABLE_SIZE[t]; c++) {
+                if (count[t][c] > 0) {
+                    weights[t][c] += STEP * (gradient[t][c] - REGULARIZATION * weights[t][c]) /
+                                     (count[t][c] + REGULARIZATION);
+                }
+            }
+        }
+        
+        if (epoch == 1 || epoch % 25 == 0 || epoch == epochs) {
+            printf("epoch %4d: rms error %.3f discs\n", epoch, sqrt(squaredError / positionCount));
+        }
+    }
+    
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        free(gradient[t]);
+        free(count[t]);
+    }
+}
+
+static int writeTables(const char* path, double* weights[PATTERN_TYPES]) {
+    static int16_t values[PATTERN_VALUE_COUNT];
+    
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        for (int index = 0; index < PATTERN_TABLE_SIZE[t]; index++) {
+            long scaled = lround(weights[t][canonical[t][index]] * PATTERN_UNITS);
+            if (scaled > INT16_MAX) scaled = INT16_MAX;
+            if (scaled < INT16_MIN) scaled = INT16_MIN;
+            values[PATTERN_TABLE_OFFSET[t] + index] = (int16_t)scaled;
+        }
+    }
+    
+    PatternFileHeader header;
+    memcpy(header.magic, PATTERN_FILE_MAGIC, sizeof(header.magic));
+    header.version = PATTERN_FILE_VERSION;
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        header.tableSize[t] = PATTERN_TABLE_SIZE[t];
+    }
+    header.payloadBytes = sizeof(values);
+    header.checksum = checksum((const unsigned char*)values, sizeof(values));
+    
+    // Write next to the target and rename, so a running client never sees a partial file
+    char tmpPath[1024];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    FILE* file = fopen(tmpPath, "wb");
+    if (!file) {
+        fprintf(stderr, "Cannot write %s\n", tmpPath);
+        return 0;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+             fwrite(values, sizeof(values), 1, file) == 1;
+    ok = (fclose(file) == 0) && ok;
+    if (!ok || rename(tmpPath, path) != 0) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        remove(tmpPath);
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    const char* output = DEFAULT_PATTERN_FILE;
+    int epochs = 200;
+    int games = 0;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-epochs") == 0 && i + 1 < argc) {
+            epochs = atoi(argv[++i]);
+        } else {
+            games += gameLog_read(argv[i], addGame, NULL);
+        }
+    }
+    
+    if (positionCount == 0) {
+        fprintf(stderr, "Usage: %s [-o %s] [-epochs N] octaflip_game_*.log\n", argv[0], DEFAULT_PATTERN_FILE);
+        fprintf(stderr, "No finished games found\n");
+        return 1;
+    }
+    printf("%d games, %zu positions\n", games, positionCount);
+    
+    buildCanonical();
+    
+    double* weights[PATTERN_TYPES];
+    for (int t = 0; t < PATTERN_TYPES; t++) {
+        weights[t] = calloc(PATTERN_TABLE_SIZE[t], sizeof(double));
+    }
+    
+    fit(weights, epochs);
+    
+    if (!writeTables(output, weights)) {
+        return 1;
+    }
+    printf("Wrote %s\n", output);
+    return 0;
+}
@@ -0,0 +1,65 @@
+// patterns.h - OctaFlip pattern evaluation tables
+// Shared by the client and the pattern_fit tool
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+#include <stdint.h>
+
+// Each pattern instance reads its squares as base-3 digits (0 = empty or
+// blocked, 1 = side to move, 2 = opponent); digit k has weight 3^k.
+// Instances of the same type share one table of values for the side to
+// move, in 1/PATTERN_UNITS of a disc of final margin.
+#define PATTERN_TYPES 3
+#define PATTERN_INSTANCES 10
+#define PATTERN_MAX_LENGTH 9
+#define PATTERN_VALUE_COUNT (6561 + 19683 + 6561)
+#define PATTERN_UNITS 100
+#define PATTERN_FILE_MAGIC "OFPT"
+#define PATTERN_FILE_VERSION 1
+#define DEFAULT_PATTERN_FILE "octaflip.pat"
+
+enum { PATTERN_EDGE, PATTERN_CORNER, PATTERN_DIAGONAL };
+
+static const int PATTERN_LENGTH[PATTERN_TYPES] = {8, 9, 8};
+static const int PATTERN_TABLE_SIZE[PATTERN_TYPES] = {6561, 19683, 6561};
+static const int PATTERN_TABLE_OFFSET[PATTERN_TYPES] = {0, 6561, 6561 + 19683};
+
+typedef struct {
+    int type;
+    int squares[PATTERN_MAX_LENGTH];  // r * 8 + c, digit order
+} PatternInstance;
+
+// Edges clockwise from a corner, the 3x3 block at each corner (row by row
+// away from the corner) and both long diagonals
+static const PatternInstance PATTERN_LIST[PATTERN_INSTANCES] = {
+    {PATTERN_EDGE, {0, 1, 2, 3, 4, 5, 6, 7}},
+    {PATTERN_EDGE, {7, 15, 23, 31, 39, 47, 55, 63}},
+    {PATTERN_EDGE, {63, 62, 61, 60, 59, 58, 57, 56}},
+    {PATTERN_EDGE, {56, 48, 40, 32, 24, 16, 8, 0}},
+    {PATTERN_CORNER, {0, 1, 2, 8, 9, 10, 16, 17, 18}},
+    {PATTERN_CORNER, {7, 6, 5, 15, 14, 13, 23, 22, 21}},
+    {PATTERN_CORNER, {63, 62, 61, 55, 54, 53, 47, 46, 45}},
+    {PATTERN_CORNER, {56, 57, 58, 48, 49, 50, 40, 41, 42}},
+    {PATTERN_DIAGONAL, {0, 9, 18, 27, 36, 45, 54, 63}},
+    {PATTERN_DIAGONAL, {7, 14, 21, 28, 35, 42, 49, 56}}
+};
+
+// Digit permutation of the board symmetry that maps an instance onto
+// itself: edges and diagonals reversed, corner blocks transposed
+static const int PATTERN_MIRROR[PATTERN_TYPES][PATTERN_MAX_LENGTH] = {
+    {7, 6, 5, 4, 3, 2, 1, 0},
+    {0, 3, 6, 1, 4, 7, 2, 5, 8},
+    {7, 6, 5, 4, 3, 2, 1, 0}
+};
+
+// File layout (little-endian): this header, then the int16 tables of each
+// type in order
+typedef struct {
+    char magic[4];                      // PATTERN_FILE_MAGIC
+    uint32_t version;
+    uint32_t tableSize[PATTERN_TYPES];
+    uint32_t payloadBytes;
+    uint32_t checksum;                  // FNV-1a over the payload
+} PatternFileHeader;
+
+#endif // PATTERNS_H
@@ -10,8 +10,24 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <signal.h>
-#include <sys/select.h>
+#include <math.h>
+#include <limits.h>
+#include <stddef.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdarg.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sys/uio.h>
+#include <poll.h>
+#include <sched.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #include "cJSON.h"
+#include "wire.h"
+#include "event_log.h"
+#include "game_record.h"
 
 // Board and game constants
 #define BOARD_SIZE 8
@@ -21,12 +37,117 @@
 #define BLOCKED '#'
 #define MAX_PLAYERS 2
 #define TIMEOUT_SECONDS 5  
+#define TIMEOUT_MS (TIMEOUT_SECONDS * 1000)
 #define BUFFER_SIZE 4096
+#define JSON_LINE_MAX 4096  // Longest per-move message: a board and two escaped usernames
+#define DEFAULT_PORT "8080"
+
+// Connection constants
+#define MAX_CONNECTIONS 65536             // Highest fd the server keeps a connection for
+#define MAX_EVENTS 256                    // epoll events handled per wakeup
+#define INPUT_BUFFER_SIZE (BUFFER_SIZE * 2)
+#define OUTPUT_HIGH_WATER (64 * 1024)     // Stop reading from a client that does not drain its output
+#define OUTPUT_MAX_SIZE (1024 * 1024)     // Drop a client whose output grows past this
+#define OUTPUT_IOV_MAX 64                 // Buffers gathered into one send
+
+// Threading constants
+#define MAX_WORKERS 64                    // Game shards; the main thread only accepts and matches
+
+// Logging constants
+#define LOG_RING_SIZE 4096                // Pending log events; a power of two
+#define LOG_TEXT_MAX 1024                 // Longer log lines are cut
+#define LOG_FILE_BUFFER (64 * 1024)       // stdio buffer per log file, written out on flush
+#define DEFAULT_LOG_FLUSH_MS 100
+
+// Matchmaking constants
+#define INITIAL_RATING 1500.0
+#define ELO_K 32.0
 
 // Move types
 #define CLONE 1
 #define JUMP 2
 
+// Matchmaking modes
+typedef enum {
+    MATCH_FIFO,      // Pair players in registration order
+    MATCH_RATING     // Pair the longest-waiting player with the closest Elo rating
+} MatchMode;
+
+typedef enum {
+    HANDOFF_GAME,                 // A matched game, main -> worker
+    HANDOFF_CONNECTION            // Players and spectators leaving a game, spectators joining one
+} HandoffKind;
+
+// Intrusive node of a HandoffQueue
+typedef struct HandoffNode {
+    _Atomic(struct HandoffNode*) next;
+    HandoffKind kind;
+} HandoffNode;
+
+// Unbounded multi-producer, single-consumer queue (Vyukov). Pushing is one
+// atomic exchange, so threads hand games and connections to each other
+// without locks; only the owning thread pops.
+typedef struct {
+    _Atomic(HandoffNode*) head;   // Last pushed node
+    HandoffNode* tail;            // Next node to pop (consumer only)
+    HandoffNode stub;
+} HandoffQueue;
+
+#define HANDOFF_ENTRY(node, type, member) ((type*)((char*)(node) - offsetof(type, member)))
+
+// One game's log. Created by the game's loop, then owned by the logger
+// thread, which opens, writes and closes the file and frees it.
+typedef struct LogStream {
+    char path[256];
+    char players[2][256];
+    int game;
+    FILE* file;
+    int dirty;                    // Written since the last flush
+    uint64_t red, blue;           // Last board, for the event log's deltas
+    struct LogStream* prev;
+    struct LogStream* next;       // Logger's list of open streams
+} LogStream;
+
+typedef enum {
+    LOG_OPEN,                     // Open the stream's file and write text (the header)
+    LOG_TEXT,                     // Write text
+    LOG_BOARD,                    // Format the board block after a time stamp and text
+    LOG_CLOSE,                    // Write the footer, close the file and free the stream
+    LOG_ARCHIVE                   // Append data (an encoded game record) to the archive and free it
+} LogKind;
+
+// A pending log event. Any kind may also carry a record for the binary event log.
+typedef struct {
+    LogStream* stream;
+    long long time_ms;            // Wall clock, taken on the game loop
+    uint8_t kind;
+    uint8_t record;               // EventType, 0 for none
+    uint8_t seat;
+    uint16_t move;
+    uint64_t red, blue, blocked;  // Board for LOG_BOARD and the record
+    int moves_count;              // For LOG_BOARD; EVENT_END's move count
+    int pass_count;
+    uint8_t* data;                // LOG_ARCHIVE only
+    size_t size;
+    uint32_t game;                // LOG_ARCHIVE: game ID for the index entry
+    int len;
+    char text[LOG_TEXT_MAX];
+} LogEvent;
+
+typedef struct {
+    LogEvent event;
+    atomic_size_t sequence;       // Slot index when free, index + 1 when filled
+} LogSlot;
+
+// An encoded message shared by every spectator of a game. Each spectator's
+// output queue holds a reference; whichever sends it last frees it, which
+// may be the main thread after the game ends.
+typedef struct {
+    atomic_int refs;
+    size_t len;
+    char data[];
+} SharedBuffer;
+
 // Player structure
 typedef struct {
     char username[256];
@@ -36,8 +157,12 @@ typedef struct {
     int is_human;  
 } Player;
 
-// Game state
-typedef struct {
+// Game state, one per match. Games live on the activeGames list of the
+// event loop that owns them from the moment two players are paired until
+// game over: the main thread creates them and hands them to worker
+// (id % workerCount), which owns the game and both player connections.
+typedef struct GameState {
+    int id;
     char board[BOARD_SIZE][BOARD_SIZE];
     Player players[MAX_PLAYERS];
     int num_players;
@@ -46,703 +171,2780 @@ typedef struct {
     int game_over;
     int moves_count;
     int pass_count;
-    time_t last_move_time;
+    long long deadline_ms;        // Monotonic time the current AI player must move by, 0 if none
+    long long turn_started_ms;    // Monotonic time of the last your_turn
+    long long started_at_ms;      // Wall clock at game start, for the archive
+    uint64_t start_red, start_blue, start_blocked;
+    uint8_t* record_moves;        // Archive (code, ms) pairs of the moves so far
+    int record_count;
+    int record_capacity;
+    int timer_index;              // Slot in the owning loop's timer heap, -1 when not armed
+    LogStream* log;
+    struct Connection* spectators;
+    int spectator_count;
+    struct GameState* prev;
+    struct GameState* next;
+    HandoffNode handoff_node;
 } GameState;
 
+// Per-connection buffers, indexed by fd. Sockets are non-blocking and
+// registered edge-triggered, so input is read and output is written until
+// the kernel returns EAGAIN.
+typedef struct Connection {
+    int fd;
+    char in[INPUT_BUFFER_SIZE];   // Received bytes not yet ending in '\n'
+    int in_len;
+    char* out;                    // Queued bytes not yet accepted by the kernel
+    size_t out_start;
+    size_t out_len;
+    size_t out_cap;
+    SharedBuffer** shared;        // Ring of queued shared buffers, sent after out
+    int shared_head;
+    int shared_count;
+    int shared_cap;
+    size_t shared_offset;         // Bytes of the first one already sent
+    size_t shared_bytes;          // Unsent bytes across the ring
+    int read_paused;              // Output above OUTPUT_HIGH_WATER
+    int binary;                   // Speaks wire.h frames since its register_ack
+    int closing;
+    struct Connection* next_closing;
+    int handoff;                  // Moving to another event loop at the end of this batch
+    struct Connection* next_handoff;
+    HandoffNode handoff_node;
+    
+    // Registration: a registered connection waits in the lobby or plays in game
+    char username[256];
+    int registered;
+    int is_human;  
+    GameState* game;
+    int player_idx;
+    int in_lobby;
+    struct Connection* lobby_prev;
+    struct Connection* lobby_next;
+    
+    // Spectating: the connection moves to the game's worker and only listens
+    int watch_id;                 // Requested game while it moves there
+    int watch_binary;             // Asked for frames with its spectate
+    GameState* watching;
+    struct Connection* spectator_prev;
+    struct Connection* spectator_next;
+} Connection;
+
+// One epoll loop per thread. The main thread's loop accepts connections and
+// runs the lobby; each worker loop runs the games handed to it. A connection
+// and its game belong to exactly one loop at a time.
+typedef struct EventLoop {
+    int id;                           // 0 for the main thread, 1..workerCount for workers
+    pthread_t thread;
+    int epollfd;
+    int wakefd;                       // eventfd, written after pushing to inbox
+    int timerfd;                      // Fires at the earliest move deadline of this loop's games
+    long long timerfd_deadline;       // Deadline timerfd is armed for, 0 if disarmed
+    GameState** timers;               // Min-heap of games by deadline_ms
+    int timer_count;
+    int timer_capacity;
+    HandoffQueue inbox;               // Games and spectators (workers) or connections back from games (main)
+    GameState* activeGames;
+    GameState* finishedGames;
+    Connection* closingConnections;
+    Connection* handoffConnections;
+} EventLoop;
+
+// Elo rating of a username, kept for the lifetime of the server
+typedef struct {
+    char username[256];
+    double rating;
+    int games;
+} RatingEntry;
+
+// Arena tally of one of its two players
+typedef struct {
+    int wins;
+    int draws;
+    int losses;
+    int discs;
+} ArenaScore;
+
 // Global game state
-GameState game;
-FILE* logFile = NULL;
+int nextGameId = 1;
+atomic_int gamesPlayed = 0;
+
+// Global lobby state
+Connection* lobbyHead = NULL;
+Connection* lobbyTail = NULL;
+MatchMode matchMode = MATCH_FIFO;
+RatingEntry* ratings = NULL;
+int ratingCount = 0;
+int ratingCapacity = 0;
+pthread_mutex_t ratingsLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Global arena state; the results are tallied by whichever worker ends a game
+int arenaGames = 0;                       // -arena N, 0 when off
+int arenaSwapColors = 0;
+int arenaStarted = 0;                     // Main thread only
+char arenaPlayers[2][256];                // Red and Blue of the first game
+ArenaScore arenaScores[2];
+int arenaFinished = 0;
+pthread_mutex_t arenaLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Usernames of registered connections (lobby or game), shared by all threads
+char (*usernames)[256] = NULL;
+int usernameCount = 0;
+int usernameCapacity = 0;
+pthread_mutex_t usernamesLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Global logger state; producers are the event loops, the consumer the logger thread
+LogSlot logRing[LOG_RING_SIZE];
+atomic_size_t logHead = 0;
+size_t logTail = 0;                       // Logger thread only
+int loggerWakefd = -1;
+atomic_int loggerSleeping = 0;
+atomic_int loggerStopping = 0;
+pthread_t loggerThread;
+int logFlushMs = DEFAULT_LOG_FLUSH_MS;
+int traceMessages = 0;                    // -trace: echo every protocol message to stdout
+const char* eventLogPath = NULL;
+FILE* eventLog = NULL;                    // Logger thread only
+const char* archivePath = NULL;
+FILE* archiveData = NULL;                 // Logger thread only
+FILE* archiveIndex = NULL;                // Logger thread only
+LogStream* openStreams = NULL;            // Logger thread only
+
+// Global connection state
+// Each slot is used by the loop owning that fd; a closed fd can be reused
+// by accept() on the main thread as soon as close() returns
+_Atomic(Connection*) connections[MAX_CONNECTIONS];
+
+// Global thread state
+EventLoop acceptorLoop;
+EventLoop workers[MAX_WORKERS];
+int workerCount = 0;
+__thread EventLoop* currentLoop = NULL;
+atomic_int stopRequested = 0;             // SIGINT / SIGTERM: leave the loops and drain the logs
 
 // Function prototypes - FIXED: Added player_type parameter
-void initializeBoard();
-void initializeLog();
-void logBoardState(const char* event);
-void logMove(const char* player, int sx, int sy, int tx, int ty, const char* result);
+void initializeBoard(GameState* g);
+void initializeLog(GameState* g);
+void logBoardState(GameState* g, const char* event);
+void logMove(GameState* g, EventType type, const char* player, int sx, int sy, int tx, int ty, const char* result);
+void logText(LogStream* stream, const char* format, ...);
 void sendJSON(int sockfd, cJSON* json);
-void handleRegister(int clientfd, const char* username, const char* player_type);
+void handleRegister(int clientfd, const char* username, const char* player_type, int binary);
 void handleMove(int clientfd, const char* username, int sx, int sy, int tx, int ty);
-void broadcastGameStart();
-void sendYourTurn(int player_idx);
-void sendGameOver();
-int isValidMove(int sx, int sy, int tx, int ty, int player_idx);
-void makeMove(int sx, int sy, int tx, int ty, int player_idx);
-void flipAdjacentPieces(int r, int c, char playerPiece);
+void broadcastGameStart(GameState* g);
+void sendYourTurn(GameState* g, int player_idx);
+void sendGameOver(GameState* g);
+int isValidMove(GameState* g, int sx, int sy, int tx, int ty, int player_idx);
+void makeMove(GameState* g, int sx, int sy, int tx, int ty, int player_idx);
+void flipAdjacentPieces(GameState* g, int r, int c, char playerPiece);
 int getMoveType(int sx, int sy, int tx, int ty);
-cJSON* boardToJSON();
-void printBoard();
-void handleClientDisconnect(int clientfd);
-void sendPassMessage(int player_idx);
-int countPieces(char piece);
-int hasValidMove(int player_idx);
-int isGameOver();
+void printBoard(GameState* g);
+void handleClientDisconnect(Connection* conn);
+void sendPassMessage(GameState* g, int player_idx);
+int countPieces(GameState* g, char piece);
+int hasValidMove(GameState* g, int player_idx);
+int isGameOver(GameState* g);
 void handlePass(int clientfd, const char* username);
-void closeLog();
+void handleClientMessage(int clientfd, char* line);
+void handleClientFrame(int clientfd, const uint8_t* payload, size_t len);
+void closeLog(GameState* g);
+void scheduleClose(Connection* conn);
+void flushOutput(Connection* conn);
+int watchConnection(Connection* conn);
+void processInput(Connection* conn);
+void runMatchmaker();
+GameState* createGame(Connection* red, Connection* blue);
+void requestStop(int sig);
+void timer_arm(GameState* g, long long deadline);
+void timer_cancel(GameState* g);
+long long now_ms();
 
-// Initialize log file
-void initializeLog() {
-    char filename[256];
-    time_t now = time(NULL);
-    struct tm *tm_info = localtime(&now);
-    
-    strftime(filename, sizeof(filename), "octaflip_game_%Y%m%d_%H%M%S.log", tm_info);
-    logFile = fopen(filename, "w");
-    
-    if (logFile) {
-        fprintf(logFile, "=== OctaFlip Game Log ===\n");
-        fprintf(logFile, "Started at: %s", ctime(&now));
-        fprintf(logFile, "========================\n\n");
-        fflush(logFile);
-        printf("Log file created: %s\n", filename);
-    }
+// ===== ASYNC LOGGER =====
+// Game loops never touch log files. They fill slots of a bounded lock-free
+// ring (Vyukov's MPMC queue with a single consumer); the logger thread
+// formats boards, writes through large stdio buffers and flushes every
+// logFlushMs, sleeping on an eventfd when there is nothing to do.
+
+long long wallclock_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
 }
 
-// Log board state
-void logBoardState(const char* event) {
-    if (!logFile) return;
-    
-    time_t now = time(NULL);
-    char timeStr[100];
-    strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", localtime(&now));
-    
-    fprintf(logFile, "\n[%s] %s\n", timeStr, event);
-    fprintf(logFile, "Board State:\n");
-    fprintf(logFile, "  1 2 3 4 5 6 7 8\n");
-    
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        fprintf(logFile, "%d ", i + 1);
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            fprintf(logFile, "%c ", game.board[i][j]);
+// Claim a slot. A full ring makes the caller wait for the logger rather
+// than drop lines the log readers need.
+LogEvent* logBegin(LogStream* stream, LogKind kind) {
+    size_t pos = atomic_load_explicit(&logHead, memory_order_relaxed);
+    LogSlot* slot;
+    
+    for (;;) {
+        slot = &logRing[pos & (LOG_RING_SIZE - 1)];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        long diff = (long)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&logHead, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            sched_yield();
+            pos = atomic_load_explicit(&logHead, memory_order_relaxed);
+        } else {
+            pos = atomic_load_explicit(&logHead, memory_order_relaxed);
         }
-        fprintf(logFile, "\n");
     }
     
-    fprintf(logFile, "Red: %d, Blue: %d, Empty: %d\n",
-            countPieces(RED), countPieces(BLUE), countPieces(EMPTY));
-    fprintf(logFile, "Move #%d, Pass count: %d\n", game.moves_count, game.pass_count);
-    fprintf(logFile, "------------------------\n");
-    fflush(logFile);
+    LogEvent* ev = &slot->event;
+    ev->stream = stream;
+    ev->time_ms = wallclock_ms();
+    ev->kind = kind;
+    ev->record = 0;
+    ev->len = 0;
+    return ev;
 }
 
-// Log move
-void logMove(const char* player, int sx, int sy, int tx, int ty, const char* result) {
-    if (!logFile) return;
-    
-    if (sx == 0 && sy == 0 && tx == 0 && ty == 0) {
-        fprintf(logFile, "Player %s: PASS - %s\n", player, result);
-    } else {
-        fprintf(logFile, "Player %s: (%d,%d) -> (%d,%d) - %s\n", 
-                player, sx, sy, tx, ty, result);
+// Publish a claimed slot and wake the logger if it sleeps
+void logCommit(LogEvent* ev) {
+    LogSlot* slot = (LogSlot*)ev;  // The event is the slot's first member
+    size_t pos = atomic_load_explicit(&slot->sequence, memory_order_relaxed);
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+    
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(&loggerSleeping, memory_order_relaxed) &&
+        atomic_exchange(&loggerSleeping, 0)) {
+        uint64_t one = 1;
+        if (write(loggerWakefd, &one, sizeof(one)) == -1 && errno != EAGAIN) {
+            perror("logger eventfd write error");
+        }
     }
-    fflush(logFile);
 }
 
-// Close log file
-void closeLog() {
-    if (logFile) {
-        fprintf(logFile, "\n=== Game Session Ended ===\n");
-        fclose(logFile);
-        logFile = NULL;
-    }
+void logTextV(LogEvent* ev, const char* format, va_list args) {
+    int n = vsnprintf(ev->text, sizeof(ev->text), format, args);
+    ev->len = n < 0 ? 0 : (n >= (int)sizeof(ev->text) ? (int)sizeof(ev->text) - 1 : n);
 }
 
-// Initialize the game board
-void initializeBoard() {
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            game.board[i][j] = EMPTY;
-        }
+void logText(LogStream* stream, const char* format, ...) {
+    if (!stream) return;
+    
+    LogEvent* ev = logBegin(stream, LOG_TEXT);
+    va_list args;
+    va_start(args, format);
+    logTextV(ev, format, args);
+    va_end(args);
+    logCommit(ev);
+}
+
+void boardToBits(GameState* g, uint64_t* red, uint64_t* blue, uint64_t* blocked) {
+    *red = *blue = *blocked = 0;
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        char cell = g->board[sq / BOARD_SIZE][sq % BOARD_SIZE];
+        if (cell == RED) *red |= 1ULL << sq;
+        else if (cell == BLUE) *blue |= 1ULL << sq;
+        else if (cell == BLOCKED) *blocked |= 1ULL << sq;
     }
-    
-    // Set initial pieces
-    game.board[0][0] = RED;
-    game.board[0][7] = BLUE;
-    game.board[7][0] = BLUE;
-    game.board[7][7] = RED;
 }
 
-// Convert board to JSON array
-cJSON* boardToJSON() {
-    cJSON* board_array = cJSON_CreateArray();
-    if (!board_array) return NULL;
-    
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        char row_str[BOARD_SIZE + 1];
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            row_str[j] = game.board[i][j];
-        }
-        row_str[BOARD_SIZE] = '\0';
-        cJSON* row_item = cJSON_CreateString(row_str);
-        if (row_item) {
-            cJSON_AddItemToArray(board_array, row_item);
+// Next filled slot, or NULL when the ring is empty (logger thread only)
+LogEvent* loggerPeek() {
+    LogSlot* slot = &logRing[logTail & (LOG_RING_SIZE - 1)];
+    size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+    return seq == logTail + 1 ? &slot->event : NULL;
+}
+
+void loggerRelease() {
+    LogSlot* slot = &logRing[logTail & (LOG_RING_SIZE - 1)];
+    atomic_store_explicit(&slot->sequence, logTail + LOG_RING_SIZE, memory_order_release);
+    logTail++;
+}
+
+void loggerWriteRecord(LogEvent* ev) {
+    LogStream* st = ev->stream;
+    EventRecord r;
+    size_t n = 0;
+    
+    r.time_ms = (uint64_t)ev->time_ms;
+    r.game = (uint32_t)st->game;
+    r.type = ev->record;
+    r.seat = ev->seat;
+    
+    switch (ev->record) {
+        case EVENT_START: {
+            char board[8][8];
+            for (int sq = 0; sq < 64; sq++) {
+                uint64_t bit = 1ULL << sq;
+                board[sq >> 3][sq & 7] = (ev->red & bit) ? RED : (ev->blue & bit) ? BLUE :
+                                         (ev->blocked & bit) ? BLOCKED : EMPTY;
+            }
+            n += wire_putBoard(r.data, (const char (*)[8])board);
+            n += wire_putString(r.data + n, st->players[0]);
+            n += wire_putString(r.data + n, st->players[1]);
+            st->red = ev->red;
+            st->blue = ev->blue;
+            break;
         }
+        case EVENT_MOVE:
+            n += wire_putMove(r.data, ev->move);
+            wire_putU64(r.data + n, st->red ^ ev->red);
+            wire_putU64(r.data + n + 8, st->blue ^ ev->blue);
+            n += 16;
+            st->red = ev->red;
+            st->blue = ev->blue;
+            break;
+        case EVENT_INVALID:
+            n += wire_putMove(r.data, ev->move);
+            break;
+        case EVENT_END:
+            n += wire_putVarint(r.data, __builtin_popcountll(ev->red));
+            n += wire_putVarint(r.data + n, __builtin_popcountll(ev->blue));
+            n += wire_putVarint(r.data + n, ev->moves_count);
+            break;
     }
+    r.len = (uint16_t)n;
     
-    return board_array;
+    uint8_t out[EVENT_LOG_HEADER + EVENT_LOG_MAX_DATA];
+    fwrite(out, 1, eventLog_encode(&r, out), eventLog);
 }
 
-// Send JSON message to client
-void sendJSON(int sockfd, cJSON* json) {
-    if (!json || sockfd < 0) return;
-    
-    char* json_str = cJSON_PrintUnformatted(json);
-    if (json_str) {
-        send(sockfd, json_str, strlen(json_str), MSG_NOSIGNAL);
-        send(sockfd, "\n", 1, MSG_NOSIGNAL);
-        printf("[SERVER->CLIENT %d] %s\n", sockfd, json_str);
-        
-        if (logFile) {
-            fprintf(logFile, "[SERVER->CLIENT %d] %s\n", sockfd, json_str);
-            fflush(logFile);
-        }
-        
-        free(json_str);
+// Record first, then its index entry: a reader never sees an entry whose
+// record is missing, only a record without an entry after a crash
+void loggerArchive(LogEvent* ev) {
+    if (archiveData && archiveIndex) {
+        uint8_t entry[GAME_INDEX_ENTRY];
+        uint64_t offset = (uint64_t)ftell(archiveData);
+        fwrite(ev->data, 1, ev->size, archiveData);
+        fflush(archiveData);
+        gameArchive_indexEntry(entry, offset, (uint32_t)ev->size, ev->game);
+        fwrite(entry, 1, sizeof(entry), archiveIndex);
     }
+    free(ev->data);
 }
 
-// Handle register request
-void handleRegister(int clientfd, const char* username, const char* player_type) {
-    printf("Registration request from %s (fd=%d, type=%s)\n", username, clientfd, 
-           player_type ? player_type : "ai");
-    
-    cJSON* response = cJSON_CreateObject();
-    if (!response) return;
+void loggerHandle(LogEvent* ev) {
+    LogStream* st = ev->stream;
     
-    // Check if game is already running
-    if (game.game_started) {
-        cJSON_AddStringToObject(response, "type", "register_nack");
-        cJSON_AddStringToObject(response, "reason", "game is already running");
-        sendJSON(clientfd, response);
-        cJSON_Delete(response);
+    if (ev->kind == LOG_ARCHIVE) {
+        loggerArchive(ev);
         return;
     }
     
-    // Check if username already exists
-    for (int i = 0; i < game.num_players; i++) {
-        if (strcmp(game.players[i].username, username) == 0) {
-            cJSON_AddStringToObject(response, "type", "register_nack");
-            cJSON_AddStringToObject(response, "reason", "username already exists");
-            sendJSON(clientfd, response);
-            cJSON_Delete(response);
-            return;
+    if (ev->kind == LOG_OPEN) {
+        st->file = fopen(st->path, "w");
+        if (!st->file) {
+            fprintf(stderr, "Cannot create log file %s\n", st->path);
+        } else {
+            setvbuf(st->file, NULL, _IOFBF, LOG_FILE_BUFFER);
         }
+        st->next = openStreams;
+        if (openStreams) openStreams->prev = st;
+        openStreams = st;
     }
     
-    // Add player
-    if (game.num_players < MAX_PLAYERS) {
-        strncpy(game.players[game.num_players].username, username, sizeof(game.players[game.num_players].username) - 1);
-        game.players[game.num_players].sockfd = clientfd;
-        game.players[game.num_players].color = (game.num_players == 0) ? RED : BLUE;
-        game.players[game.num_players].connected = 1;
-        
-        // Set human flag
-        if (player_type && strcmp(player_type, "human") == 0) {
-            game.players[game.num_players].is_human = 1;
-        } else {
-            game.players[game.num_players].is_human = 0;
+    if (ev->record && eventLog) {
+        loggerWriteRecord(ev);
+    }
+    
+    FILE* f = st->file;
+    if (f) {
+        if (ev->kind == LOG_BOARD) {
+            time_t now = (time_t)(ev->time_ms / 1000);
+            struct tm tm_now;
+            char timeStr[100];
+            localtime_r(&now, &tm_now);
+            strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", &tm_now);
+            
+            char block[512];
+            int title = ev->len < 128 ? ev->len : 128;  // Keeps the block inside its buffer
+            int n = snprintf(block, sizeof(block), "\n[%s] %.*s\nBoard State:\n  1 2 3 4 5 6 7 8\n",
+                             timeStr, title, ev->text);
+            for (int i = 0; i < BOARD_SIZE; i++) {
+                block[n++] = '1' + i;
+                block[n++] = ' ';
+                for (int j = 0; j < BOARD_SIZE; j++) {
+                    uint64_t bit = 1ULL << (i * BOARD_SIZE + j);
+                    block[n++] = (ev->red & bit) ? RED : (ev->blue & bit) ? BLUE :
+                                 (ev->blocked & bit) ? BLOCKED : EMPTY;
+                    block[n++] = ' ';
+                }
+                block[n++] = '\n';
+            }
+            int red = __builtin_popcountll(ev->red), blue = __builtin_popcountll(ev->blue);
+            int empty = BOARD_SIZE * BOARD_SIZE - __builtin_popcountll(ev->red | ev->blue | ev->blocked);
+            n += snprintf(block + n, sizeof(block) - n,
+                          "Red: %d, Blue: %d, Empty: %d\nMove #%d, Pass count: %d\n------------------------\n",
+                          red, blue, empty, ev->moves_count, ev->pass_count);
+            fwrite(block, 1, n, f);
+        } else if (ev->len > 0) {
+            fwrite(ev->text, 1, ev->len, f);
+        }
+        st->dirty = 1;
+    }
+    
+    if (ev->kind == LOG_CLOSE) {
+        if (f) {
+            fputs("\n=== Game Session Ended ===\n", f);
+            fclose(f);
+        }
+        if (st->prev) st->prev->next = st->next;
+        else openStreams = st->next;
+        if (st->next) st->next->prev = st->prev;
+        free(st);
+    }
+}
+
+void loggerFlush() {
+    for (LogStream* st = openStreams; st; st = st->next) {
+        if (st->dirty && st->file) fflush(st->file);
+        st->dirty = 0;
+    }
+    if (eventLog) fflush(eventLog);
+    if (archiveIndex) fflush(archiveIndex);
+}
+
+void* loggerMain(void* arg) {
+    (void)arg;
+    long long nextFlush = now_ms() + logFlushMs;
+    int pending = 0;  // Written since the last flush
+    
+    for (;;) {
+        LogEvent* ev;
+        while ((ev = loggerPeek()) != NULL) {
+            loggerHandle(ev);
+            loggerRelease();
+            pending = 1;
         }
         
-        game.num_players++;
-        
-        cJSON_AddStringToObject(response, "type", "register_ack");
-        sendJSON(clientfd, response);
-        cJSON_Delete(response);
+        long long now = now_ms();
+        if (pending && now >= nextFlush) {
+            loggerFlush();
+            pending = 0;
+        }
+        if (!pending) nextFlush = now + logFlushMs;
         
-        printf("Player %s registered as %c (%s) (total: %d)\n", username, 
-               game.players[game.num_players-1].color,
-               game.players[game.num_players-1].is_human ? "human" : "ai",
-               game.num_players);
+        if (atomic_load(&loggerStopping)) break;
         
-        if (logFile) {
-            fprintf(logFile, "Player %s registered as %c (%s)\n", username, 
-                    game.players[game.num_players-1].color,
-                    game.players[game.num_players-1].is_human ? "human" : "ai");
-            fflush(logFile);
+        // Sleep until an event arrives or the next flush is due
+        atomic_store(&loggerSleeping, 1);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (loggerPeek()) {
+            atomic_store(&loggerSleeping, 0);
+            continue;
         }
-        
-        // Start game if two players registered
-        if (game.num_players == MAX_PLAYERS) {
-            game.game_started = 1;
-            game.current_player = 0;
-            game.last_move_time = time(NULL);
-            logBoardState("Game Started - Initial Board");
-            broadcastGameStart();
-            usleep(100000); // Small delay
-            sendYourTurn(game.current_player);
+        struct pollfd pfd = { loggerWakefd, POLLIN, 0 };
+        poll(&pfd, 1, pending ? (int)(nextFlush - now) : -1);
+        atomic_store(&loggerSleeping, 0);
+        uint64_t count;
+        if (read(loggerWakefd, &count, sizeof(count)) == -1 && errno != EAGAIN) {
+            perror("logger eventfd read error");
         }
     }
+    
+    // Shutting down: drain what is left and leave every file complete on disk
+    LogEvent* ev;
+    while ((ev = loggerPeek()) != NULL) {
+        loggerHandle(ev);
+        loggerRelease();
+    }
+    loggerFlush();
+    for (LogStream* st = openStreams; st; st = st->next) {
+        if (st->file) fclose(st->file);
+        st->file = NULL;
+    }
+    if (eventLog) fclose(eventLog);
+    if (archiveData) fclose(archiveData);
+    if (archiveIndex) fclose(archiveIndex);
+    return NULL;
 }
 
-
-// Broadcast game start to both players
-void broadcastGameStart() {
-    cJSON* message = cJSON_CreateObject();
-    if (!message) return;
-    
-    cJSON* players_array = cJSON_CreateArray();
-    
-    if (!players_array) {
-        cJSON_Delete(message);
-        return;
+// Open an archive file for appending, writing its magic if it is new
+FILE* openArchiveFile(const char* path, const char* magic) {
+    FILE* file = fopen(path, "ab");
+    if (!file) {
+        fprintf(stderr, "Cannot open archive file %s\n", path);
+        return NULL;
     }
-    
-    cJSON_AddStringToObject(message, "type", "game_start");
-    
-    cJSON_AddItemToArray(players_array, cJSON_CreateString(game.players[0].username));
-    cJSON_AddItemToArray(players_array, cJSON_CreateString(game.players[1].username));
-    cJSON_AddItemToObject(message, "players", players_array);
-    
-    cJSON_AddStringToObject(message, "first_player", game.players[0].username);
-    
-    // Don't include board in game_start (as per TA specification)
-    
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].connected) {
-            sendJSON(game.players[i].sockfd, message);
-        }
+    fseek(file, 0, SEEK_END);
+    if (ftell(file) == 0) {
+        fwrite(magic, 1, GAME_ARCHIVE_MAGIC_SIZE, file);
     }
-    
-    cJSON_Delete(message);
+    return file;
 }
 
-// Send your_turn message
-void sendYourTurn(int player_idx) {
-    if (player_idx < 0 || player_idx >= MAX_PLAYERS) return;
-    
-    cJSON* message = cJSON_CreateObject();
-    cJSON* board_json = boardToJSON();
-    
-    if (!message || !board_json) {
-        if (message) cJSON_Delete(message);
-        if (board_json) cJSON_Delete(board_json);
-        return;
+int startLogger() {
+    for (size_t i = 0; i < LOG_RING_SIZE; i++) {
+        atomic_init(&logRing[i].sequence, i);
     }
     
-    cJSON_AddStringToObject(message, "type", "your_turn");
-    cJSON_AddItemToObject(message, "board", board_json);
-    
-    // Set timeout based on player type
-    if (game.players[player_idx].is_human) {
-        cJSON_AddNumberToObject(message, "timeout", 999999);  // Effectively no timeout
-    } else {
-        cJSON_AddNumberToObject(message, "timeout", TIMEOUT_SECONDS);
+    if (eventLogPath) {
+        eventLog = fopen(eventLogPath, "ab");
+        if (!eventLog) {
+            perror("event log open error");
+            return -1;
+        }
+        setvbuf(eventLog, NULL, _IOFBF, LOG_FILE_BUFFER);
+        if (ftell(eventLog) == 0) {
+            fwrite(EVENT_LOG_MAGIC, 1, EVENT_LOG_MAGIC_SIZE, eventLog);
+        }
     }
     
-    if (game.players[player_idx].connected) {
-        sendJSON(game.players[player_idx].sockfd, message);
-        game.last_move_time = time(NULL);
+    if (archivePath) {
+        char indexPath[4096];
+        snprintf(indexPath, sizeof(indexPath), "%s.idx", archivePath);
+        archiveData = openArchiveFile(archivePath, GAME_ARCHIVE_MAGIC);
+        archiveIndex = openArchiveFile(indexPath, GAME_INDEX_MAGIC);
+        if (!archiveData || !archiveIndex) return -1;
     }
     
-    cJSON_Delete(message);
+    loggerWakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (loggerWakefd == -1) {
+        perror("eventfd error");
+        return -1;
+    }
+    if (pthread_create(&loggerThread, NULL, loggerMain, NULL) != 0) {
+        fprintf(stderr, "Cannot start the logger thread\n");
+        return -1;
+    }
+    return 0;
 }
 
-
-// Get move type
-int getMoveType(int sx, int sy, int tx, int ty) {
-    int dx = abs(tx - sx);
-    int dy = abs(ty - sy);
-    
-    if (dx == 0 && dy == 0) return -1;
-    
-    if (dx <= 1 && dy <= 1) return CLONE;
-    
-    if ((dx == 2 && dy == 0) || (dx == 0 && dy == 2) || (dx == 2 && dy == 2)) return JUMP;
-    
-    return -1;
+void stopLogger() {
+    atomic_store(&loggerStopping, 1);
+    uint64_t one = 1;
+    if (write(loggerWakefd, &one, sizeof(one)) == -1 && errno != EAGAIN) {
+        perror("logger eventfd write error");
+    }
+    pthread_join(loggerThread, NULL);
 }
 
-// Check if move is valid
-int isValidMove(int sx, int sy, int tx, int ty, int player_idx) {
-    if (sx < 0 || sx >= BOARD_SIZE || sy < 0 || sy >= BOARD_SIZE ||
-        tx < 0 || tx >= BOARD_SIZE || ty < 0 || ty >= BOARD_SIZE) {
-        return 0;
-    }
-    
-    char playerPiece = game.players[player_idx].color;
-    if (game.board[sx][sy] != playerPiece) {
-        return 0;
+// Initialize log file
+void initializeLog(GameState* g) {
+    char stamp[64];
+    time_t now = time(NULL);
+    struct tm tm_info;
+    char startedAt[64];
+    localtime_r(&now, &tm_info);
+    ctime_r(&now, startedAt);
+    
+    LogStream* stream = calloc(1, sizeof(LogStream));
+    if (!stream) return;
+    
+    // One file per game; the game ID keeps games started in the same second apart
+    strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &tm_info);
+    snprintf(stream->path, sizeof(stream->path), "octaflip_game_%s_%d.log", stamp, g->id);
+    stream->game = g->id;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        snprintf(stream->players[i], sizeof(stream->players[i]), "%s", g->players[i].username);
     }
-    
-    if (game.board[tx][ty] != EMPTY) {
-        return 0;
+    g->log = stream;
+    
+    LogEvent* ev = logBegin(stream, LOG_OPEN);
+    ev->record = EVENT_START;
+    ev->seat = 0;
+    boardToBits(g, &ev->red, &ev->blue, &ev->blocked);
+    int n = snprintf(ev->text, sizeof(ev->text),
+                     "=== OctaFlip Game Log ===\nGame #%d: %s (Red) vs %s (Blue)\nStarted at: %s========================\n\n",
+                     g->id, g->players[0].username, g->players[1].username, startedAt);
+    ev->len = n >= (int)sizeof(ev->text) ? (int)sizeof(ev->text) - 1 : n;
+    logCommit(ev);
+    
+    printf("Log file created: %s\n", stream->path);
+}
+
+// Log board state
+void logBoardState(GameState* g, const char* event) {
+    if (!g->log) return;
+    
+    LogEvent* ev = logBegin(g->log, LOG_BOARD);
+    boardToBits(g, &ev->red, &ev->blue, &ev->blocked);
+    ev->moves_count = g->moves_count;
+    ev->pass_count = g->pass_count;
+    ev->len = snprintf(ev->text, sizeof(ev->text), "%s", event);
+    logCommit(ev);
+}
+
+// Log move. Called before the turn passes, so the mover is g->current_player;
+// type is what the binary event log records.
+void logMove(GameState* g, EventType type, const char* player, int sx, int sy, int tx, int ty, const char* result) {
+    if (!g->log) return;
+    
+    LogEvent* ev = logBegin(g->log, LOG_TEXT);
+    ev->record = type;
+    ev->seat = (uint8_t)g->current_player;
+    // An invalid move's coordinates are whatever the client sent
+    int onBoard = sx >= 1 && sx <= BOARD_SIZE && sy >= 1 && sy <= BOARD_SIZE &&
+                  tx >= 1 && tx <= BOARD_SIZE && ty >= 1 && ty <= BOARD_SIZE;
+    int pass = sx == 0 && sy == 0 && tx == 0 && ty == 0;
+    ev->move = onBoard || pass ? wire_packMove(sx, sy, tx, ty) : EVENT_OFF_BOARD_MOVE;
+    boardToBits(g, &ev->red, &ev->blue, &ev->blocked);
+    
+    if (pass) {
+        ev->len = snprintf(ev->text, sizeof(ev->text), "Player %s: PASS - %s\n", player, result);
+    } else {
+        ev->len = snprintf(ev->text, sizeof(ev->text), "Player %s: (%d,%d) -> (%d,%d) - %s\n",
+                           player, sx, sy, tx, ty, result);
     }
-    
-    return getMoveType(sx, sy, tx, ty) > 0;
+    if (ev->len >= (int)sizeof(ev->text)) ev->len = sizeof(ev->text) - 1;
+    logCommit(ev);
 }
 
-// Flip adjacent pieces
-void flipAdjacentPieces(int r, int c, char playerPiece) {
-    char opponentPiece = (playerPiece == RED) ? BLUE : RED;
-    
-    for (int dr = -1; dr <= 1; dr++) {
-        for (int dc = -1; dc <= 1; dc++) {
-            if (dr == 0 && dc == 0) continue;
-            
-            int nr = r + dr;
-            int nc = c + dc;
-            
-            if (nr >= 0 && nr < BOARD_SIZE && nc >= 0 && nc < BOARD_SIZE) {
-                if (game.board[nr][nc] == opponentPiece) {
-                    game.board[nr][nc] = playerPiece;
-                }
-            }
-        }
+// Note a move, pass or forced pass for the archive with the time its mover used
+void recordMove(GameState* g, uint16_t code) {
+    if (!archivePath || g->record_count >= GAME_RECORD_MAX_MOVES) return;
+    
+    if (g->record_count == g->record_capacity) {
+        int capacity = g->record_capacity ? g->record_capacity * 2 : 128;
+        uint8_t* moves = realloc(g->record_moves, 4 * (size_t)capacity);
+        if (!moves) return;
+        g->record_moves = moves;
+        g->record_capacity = capacity;
     }
+    
+    long long used = now_ms() - g->turn_started_ms;
+    if (used > 0xFFFF) used = 0xFFFF;
+    uint8_t* p = g->record_moves + 4 * g->record_count++;
+    wire_putMove(p, code);
+    p[2] = (uint8_t)used;
+    p[3] = (uint8_t)(used >> 8);
 }
 
-// Make a move on the board
-void makeMove(int sx, int sy, int tx, int ty, int player_idx) {
-    char playerPiece = game.players[player_idx].color;
-    int moveType = getMoveType(sx, sy, tx, ty);
+// Encode the finished game and give it to the logger to append
+void archiveGame(GameState* g, int red_count, int blue_count) {
+    if (!archivePath) return;
+    
+    GameRecord r;
+    memset(&r, 0, sizeof(r));
+    r.time_ms = (uint64_t)g->started_at_ms;
+    r.game = (uint32_t)g->id;
+    r.red = g->start_red;
+    r.blue = g->start_blue;
+    r.blocked = g->start_blocked;
+    r.redScore = red_count;
+    r.blueScore = blue_count;
+    r.end = (g->players[0].connected && g->players[1].connected) ? GAME_END_NORMAL : GAME_END_DISCONNECT;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        snprintf(r.players[i], sizeof(r.players[i]), "%s", g->players[i].username);
+    }
+    r.moveCount = g->record_count;
+    r.moves = g->record_moves;
     
-    game.board[tx][ty] = playerPiece;
+    uint8_t* data = malloc(gameRecord_size(&r));
+    if (!data) return;
     
-    if (moveType == JUMP) {
-        game.board[sx][sy] = EMPTY;
+    LogEvent* ev = logBegin(NULL, LOG_ARCHIVE);
+    ev->data = data;
+    ev->size = gameRecord_encode(&r, data);
+    ev->game = r.game;
+    logCommit(ev);
+}
+
+// Close log file; the logger frees the stream once it has written it out
+void closeLog(GameState* g) {
+    if (g->log) {
+        logCommit(logBegin(g->log, LOG_CLOSE));
+        g->log = NULL;
     }
-    
-    flipAdjacentPieces(tx, ty, playerPiece);
 }
 
-// Count pieces
-int countPieces(char piece) {
-    int count = 0;
+// Initialize the game board
+void initializeBoard(GameState* g) {
     for (int i = 0; i < BOARD_SIZE; i++) {
         for (int j = 0; j < BOARD_SIZE; j++) {
-            if (game.board[i][j] == piece) {
-                count++;
-            }
+            g->board[i][j] = EMPTY;
         }
     }
-    return count;
+    
+    // Set initial pieces
+    g->board[0][0] = RED;
+    g->board[0][7] = BLUE;
+    g->board[7][0] = BLUE;
+    g->board[7][7] = RED;
 }
 
-// Check if player has valid moves
-int hasValidMove(int player_idx) {
-    if (player_idx < 0 || player_idx >= MAX_PLAYERS) return 0;
-    
-    char playerPiece = game.players[player_idx].color;
+SharedBuffer* sharedCreate(const void* data, size_t len) {
+    SharedBuffer* buf = malloc(sizeof(SharedBuffer) + len);
+    if (!buf) return NULL;
+    atomic_init(&buf->refs, 1);
+    buf->len = len;
+    memcpy(buf->data, data, len);
+    return buf;
+}
+
+void sharedRelease(SharedBuffer* buf) {
+    if (atomic_fetch_sub_explicit(&buf->refs, 1, memory_order_acq_rel) == 1) free(buf);
+}
+
+// Queue a reference to a shared buffer behind everything else for the client
+void queueShared(Connection* conn, SharedBuffer* buf) {
+    if (conn->out_len + conn->shared_bytes + buf->len > OUTPUT_MAX_SIZE) {
+        printf("Client %d is not reading, dropping it\n", conn->fd);
+        scheduleClose(conn);
+        return;
+    }
     
-    for (int sx = 0; sx < BOARD_SIZE; sx++) {
-        for (int sy = 0; sy < BOARD_SIZE; sy++) {
-            if (game.board[sx][sy] == playerPiece) {
-                for (int tx = 0; tx < BOARD_SIZE; tx++) {
-                    for (int ty = 0; ty < BOARD_SIZE; ty++) {
-                        if (isValidMove(sx, sy, tx, ty, player_idx)) {
-                            return 1;
-                        }
-                    }
-                }
-            }
+    if (conn->shared_count == conn->shared_cap) {
+        int cap = conn->shared_cap ? conn->shared_cap * 2 : 16;
+        SharedBuffer** ring = malloc(cap * sizeof(SharedBuffer*));
+        if (!ring) {
+            scheduleClose(conn);
+            return;
+        }
+        for (int i = 0; i < conn->shared_count; i++) {
+            ring[i] = conn->shared[(conn->shared_head + i) % conn->shared_cap];
         }
+        free(conn->shared);
+        conn->shared = ring;
+        conn->shared_head = 0;
+        conn->shared_cap = cap;
     }
-    return 0;
-}
-
-// Check if game is over
-int isGameOver() {
-    if (countPieces(EMPTY) == 0) return 1;
-    if (countPieces(RED) == 0 || countPieces(BLUE) == 0) return 1;
-    if (game.pass_count >= 2) return 1;
     
-    return 0;
+    atomic_fetch_add_explicit(&buf->refs, 1, memory_order_relaxed);
+    conn->shared[(conn->shared_head + conn->shared_count++) % conn->shared_cap] = buf;
+    conn->shared_bytes += buf->len;
+    flushOutput(conn);
 }
 
-// Handle pass
-void handlePass(int clientfd, const char* username) {
-    int player_idx = -1;
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].sockfd == clientfd) {
-            player_idx = i;
-            break;
-        }
+// Drop the references a closing connection still holds
+void releaseShared(Connection* conn) {
+    while (conn->shared_count > 0) {
+        sharedRelease(conn->shared[conn->shared_head]);
+        conn->shared_head = (conn->shared_head + 1) % conn->shared_cap;
+        conn->shared_count--;
     }
+    free(conn->shared);
+    conn->shared = NULL;
+    conn->shared_cap = 0;
+}
+
+// Queue bytes for a client and write as much as the socket takes
+void queueOutput(Connection* conn, const void* data, size_t len) {
+    size_t needed = conn->out_len + len;
     
-    if (player_idx == -1 || player_idx != game.current_player) {
-        cJSON* response = cJSON_CreateObject();
-        if (response) {
-            cJSON_AddStringToObject(response, "type", "invalid_move");
-            cJSON_AddStringToObject(response, "reason", "not your turn");
-            sendJSON(clientfd, response);
-            cJSON_Delete(response);
-        }
+    if (needed + conn->shared_bytes > OUTPUT_MAX_SIZE) {
+        printf("Client %d is not reading, dropping it\n", conn->fd);
+        scheduleClose(conn);
         return;
     }
     
-    cJSON* response = cJSON_CreateObject();
-    cJSON* board_json = boardToJSON();
-    
-    if (!response || !board_json) {
-        if (response) cJSON_Delete(response);
-        if (board_json) cJSON_Delete(board_json);
+    // Shared buffers are still waiting; go behind them to keep the order
+    if (conn->shared_count > 0) {
+        SharedBuffer* buf = sharedCreate(data, len);
+        if (!buf) {
+            scheduleClose(conn);
+            return;
+        }
+        queueShared(conn, buf);
+        sharedRelease(buf);
         return;
     }
     
-    if (hasValidMove(player_idx)) {
-        // Has valid moves, cannot pass
-        cJSON_AddStringToObject(response, "type", "invalid_move");
-        cJSON_AddItemToObject(response, "board", board_json);
-        cJSON_AddStringToObject(response, "next_player", game.players[game.current_player].username);
-        
-        for (int i = 0; i < MAX_PLAYERS; i++) {
-            if (game.players[i].connected) {
-                sendJSON(game.players[i].sockfd, response);
-            }
+    if (conn->out_start > 0 && conn->out_start + needed > conn->out_cap) {
+        memmove(conn->out, conn->out + conn->out_start, conn->out_len);
+        conn->out_start = 0;
+    }
+    if (conn->out_start + needed > conn->out_cap) {
+        size_t cap = conn->out_cap ? conn->out_cap : BUFFER_SIZE;
+        while (cap < needed) cap *= 2;
+        char* out = realloc(conn->out, cap);
+        if (!out) {
+            scheduleClose(conn);
+            return;
         }
-        
-        logMove(username, 0, 0, 0, 0, "Invalid pass - has valid moves");
-    } else {
-        // Valid pass
-        game.pass_count++;
-        game.moves_count++;
-        
-        cJSON_AddStringToObject(response, "type", "move_ok");
-        cJSON_AddItemToObject(response, "board", board_json);
-        cJSON_AddStringToObject(response, "next_player", game.players[1 - game.current_player].username);
-        
-        for (int i = 0; i < MAX_PLAYERS; i++) {
-            if (game.players[i].connected) {
-                sendJSON(game.players[i].sockfd, response);
+        conn->out = out;
+        conn->out_cap = cap;
+    }
+    memcpy(conn->out + conn->out_start + conn->out_len, data, len);
+    conn->out_len += len;
+    flushOutput(conn);
+}
+
+// Send JSON message to client
+void sendJSON(int sockfd, cJSON* json) {
+    if (!json || sockfd < 0 || sockfd >= MAX_CONNECTIONS) return;
+    
+    Connection* conn = connections[sockfd];
+    if (!conn || conn->closing) return;
+    
+    char* json_str = cJSON_PrintUnformatted(json);
+    if (json_str) {
+        // Payload and newline go out together
+        size_t len = strlen(json_str);
+        json_str[len] = '\n';
+        queueOutput(conn, json_str, len + 1);
+        json_str[len] = '\0';
+        
+        if (traceMessages) printf("[SERVER->CLIENT %d] %s\n", sockfd, json_str);
+        
+        if (conn->game) logText(conn->game->log, "[SERVER->CLIENT %d] %s\n", sockfd, json_str);
+        
+        free(json_str);
+    }
+}
+
+// ===== MESSAGE ENCODING =====
+// The per-move messages have a fixed shape, so they are formatted straight
+// into a stack buffer instead of going through a cJSON tree and a heap string
+
+typedef struct {
+    char text[JSON_LINE_MAX];
+    size_t len;
+} JsonLine;
+
+// Every append leaves room for the closing newline
+void lineRaw(JsonLine* line, const char* s) {
+    while (*s && line->len < JSON_LINE_MAX - 2) line->text[line->len++] = *s++;
+}
+
+void lineString(JsonLine* line, const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    
+    lineRaw(line, "\"");
+    for (; *s && line->len < JSON_LINE_MAX - 8; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '"' || c == '\\') {
+            line->text[line->len++] = '\\';
+            line->text[line->len++] = c;
+        } else if (c < 0x20) {
+            memcpy(line->text + line->len, "\\u00", 4);
+            line->text[line->len + 4] = hex[c >> 4];
+            line->text[line->len + 5] = hex[c & 15];
+            line->len += 6;
+        } else {
+            line->text[line->len++] = c;
+        }
+    }
+    lineRaw(line, "\"");
+}
+
+void lineInt(JsonLine* line, long long value) {
+    char digits[24];
+    snprintf(digits, sizeof(digits), "%lld", value);
+    lineRaw(line, digits);
+}
+
+void lineBoard(JsonLine* line, GameState* g) {
+    lineRaw(line, "[");
+    for (int i = 0; i < BOARD_SIZE && line->len + BOARD_SIZE + 4 < JSON_LINE_MAX; i++) {
+        if (i > 0) line->text[line->len++] = ',';
+        line->text[line->len++] = '"';
+        memcpy(line->text + line->len, g->board[i], BOARD_SIZE);
+        line->len += BOARD_SIZE;
+        line->text[line->len++] = '"';
+    }
+    lineRaw(line, "]");
+}
+
+// Start a message: {"type":"<type>"
+void lineBegin(JsonLine* line, const char* type) {
+    line->len = 0;
+    lineRaw(line, "{\"type\":");
+    lineString(line, type);
+}
+
+// Close the object and terminate the line
+void lineEnd(JsonLine* line) {
+    lineRaw(line, "}");
+    line->text[line->len++] = '\n';
+}
+
+// Queue a finished line; it reaches the socket in the same send as anything
+// already waiting in the output buffer
+void sendLine(int sockfd, const JsonLine* line) {
+    if (sockfd < 0 || sockfd >= MAX_CONNECTIONS) return;
+    
+    Connection* conn = connections[sockfd];
+    if (!conn || conn->closing) return;
+    
+    queueOutput(conn, line->text, line->len);
+    
+    int printed = (int)line->len - 1;
+    if (traceMessages) printf("[SERVER->CLIENT %d] %.*s\n", sockfd, printed, line->text);
+    
+    if (conn->game) logText(conn->game->log, "[SERVER->CLIENT %d] %.*s\n", sockfd, printed, line->text);
+}
+
+// Send one wire.h frame (payload[0] is its type) to a binary client
+void sendFrame(int sockfd, const uint8_t* payload, size_t len) {
+    if (sockfd < 0 || sockfd >= MAX_CONNECTIONS) return;
+    
+    Connection* conn = connections[sockfd];
+    if (!conn || conn->closing) return;
+    
+    uint8_t frame[WIRE_MAX_HEADER + WIRE_MAX_FRAME];
+    size_t header = wire_putHeader(frame, len);
+    memcpy(frame + header, payload, len);
+    queueOutput(conn, frame, header + len);
+    
+    if (traceMessages) printf("[SERVER->CLIENT %d] frame type %d, %zu bytes\n", sockfd, payload[0], header + len);
+}
+
+int isBinary(int sockfd) {
+    return sockfd >= 0 && sockfd < MAX_CONNECTIONS && connections[sockfd] && connections[sockfd]->binary;
+}
+
+// Does any connected player of the game use the given protocol?
+int gameUses(GameState* g, int binary) {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        if (g->players[i].connected && isBinary(g->players[i].sockfd) == binary) return 1;
+    }
+    return 0;
+}
+
+// Send a message to every connected player of a game, as a JSON line or as
+// a frame depending on what each negotiated; either encoding may be NULL
+// when no player uses it
+void broadcast(GameState* g, const JsonLine* line, const uint8_t* payload, size_t len) {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        if (!g->players[i].connected) continue;
+        if (isBinary(g->players[i].sockfd)) {
+            if (payload) sendFrame(g->players[i].sockfd, payload, len);
+        } else if (line) {
+            sendLine(g->players[i].sockfd, line);
+        }
+    }
+}
+
+// move_ok / invalid_move with the current board; next_player is the seat to move
+void broadcastBoardUpdate(GameState* g, const char* type, uint16_t move, int next_player) {
+    int valid = strcmp(type, "move_ok") == 0;
+    
+    if (gameUses(g, 1)) {
+        uint8_t payload[WIRE_BOARD_BYTES + 8];
+        size_t n = 0;
+        payload[n++] = valid ? WIRE_MOVE_OK : WIRE_INVALID_MOVE;
+        if (!valid) payload[n++] = 1;  // Board, move and next player follow
+        n += wire_putBoard(payload + n, (const char (*)[8])g->board);
+        n += wire_putMove(payload + n, move);
+        payload[n++] = (uint8_t)next_player;
+        broadcast(g, NULL, payload, n);
+    }
+    
+    if (gameUses(g, 0)) {
+        JsonLine line;
+        lineBegin(&line, type);
+        lineRaw(&line, ",\"board\":");
+        lineBoard(&line, g);
+        lineRaw(&line, ",\"next_player\":");
+        lineString(&line, g->players[next_player].username);
+        lineEnd(&line);
+        broadcast(g, &line, NULL, 0);
+    }
+}
+
+// ===== SPECTATORS =====
+// A spectator names a game and moves to that game's worker. It gets a
+// snapshot of the board, then one delta per move or pass and the game over.
+// Each of those is encoded once per protocol, and the same buffer is queued
+// on every spectator.
+
+uint64_t pieceBits(GameState* g, char piece) {
+    uint64_t bits = 0;
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        if (g->board[sq >> 3][sq & 7] == piece) bits |= 1ULL << sq;
+    }
+    return bits;
+}
+
+// Queue a message on every spectator of the game, as a JSON line or as a
+// frame; either encoding may be NULL when no spectator uses it
+void broadcastSpectators(GameState* g, const JsonLine* line, const uint8_t* payload, size_t len) {
+    SharedBuffer* encoded[2] = {NULL, NULL};  // JSON, binary
+    
+    for (Connection* c = g->spectators; c; c = c->spectator_next) {
+        int binary = c->binary;
+        if (!encoded[binary]) {
+            if (binary && payload) {
+                uint8_t frame[WIRE_MAX_HEADER + WIRE_MAX_FRAME];
+                size_t header = wire_putHeader(frame, len);
+                memcpy(frame + header, payload, len);
+                encoded[binary] = sharedCreate(frame, header + len);
+            } else if (!binary && line) {
+                encoded[binary] = sharedCreate(line->text, line->len);
             }
+            if (!encoded[binary]) continue;
+        }
+        queueShared(c, encoded[binary]);
+    }
+    
+    if (encoded[0]) {
+        if (traceMessages) printf("[SERVER->SPECTATORS game %d] %.*s\n", g->id, (int)line->len - 1, line->text);
+        sharedRelease(encoded[0]);
+    }
+    if (encoded[1]) {
+        if (traceMessages) {
+            printf("[SERVER->SPECTATORS game %d] frame type %d, %zu bytes\n", g->id, payload[0], encoded[1]->len);
+        }
+        sharedRelease(encoded[1]);
+    }
+}
+
+// A move or pass as spectators see it; flipped holds the opponent's squares
+// the mover took, so the move itself and this mask rebuild the board
+void broadcastDelta(GameState* g, uint16_t move, uint64_t flipped, int next_player) {
+    if (!g->spectators) return;
+    
+    uint8_t payload[1 + 2 + 8 + 1];
+    size_t n = 0;
+    payload[n++] = WIRE_DELTA;
+    n += wire_putMove(payload + n, move);
+    wire_putU64(payload + n, flipped);
+    n += 8;
+    payload[n++] = (uint8_t)next_player;
+    
+    int coords[4];
+    char mask[20];
+    wire_unpackMove(move, &coords[0], &coords[1], &coords[2], &coords[3]);
+    snprintf(mask, sizeof(mask), "%016llx", (unsigned long long)flipped);
+    
+    JsonLine line;
+    lineBegin(&line, "delta");
+    lineRaw(&line, ",\"move\":[");
+    for (int i = 0; i < 4; i++) {
+        if (i > 0) lineRaw(&line, ",");
+        lineInt(&line, coords[i]);
+    }
+    lineRaw(&line, "],\"flipped\":");
+    lineString(&line, mask);
+    lineRaw(&line, ",\"next_player\":");
+    lineString(&line, g->players[next_player].username);
+    lineEnd(&line);
+    
+    broadcastSpectators(g, &line, payload, n);
+}
+
+// The position a new spectator starts from; every later delta applies to it
+void sendSnapshot(GameState* g, Connection* conn) {
+    if (conn->binary) {
+        uint8_t payload[1 + 10 + WIRE_BOARD_BYTES + 2 * 258 + 1 + 10];
+        size_t n = 0;
+        payload[n++] = WIRE_SNAPSHOT;
+        n += wire_putVarint(payload + n, g->id);
+        n += wire_putBoard(payload + n, (const char (*)[8])g->board);
+        n += wire_putString(payload + n, g->players[0].username);
+        n += wire_putString(payload + n, g->players[1].username);
+        payload[n++] = (uint8_t)g->current_player;
+        n += wire_putVarint(payload + n, g->moves_count);
+        sendFrame(conn->fd, payload, n);
+        return;
+    }
+    
+    JsonLine line;
+    lineBegin(&line, "snapshot");
+    lineRaw(&line, ",\"game_id\":");
+    lineInt(&line, g->id);
+    lineRaw(&line, ",\"players\":[");
+    lineString(&line, g->players[0].username);
+    lineRaw(&line, ",");
+    lineString(&line, g->players[1].username);
+    lineRaw(&line, "],\"board\":");
+    lineBoard(&line, g);
+    lineRaw(&line, ",\"next_player\":");
+    lineString(&line, g->players[g->current_player].username);
+    lineRaw(&line, ",\"moves\":");
+    lineInt(&line, g->moves_count);
+    lineEnd(&line);
+    sendLine(conn->fd, &line);
+}
+
+// Answer a spectate in the connection's protocol; reason is NULL to accept.
+// A binary connection gets no ack, the snapshot follows directly.
+void sendSpectateResult(Connection* conn, const char* reason, int game_id) {
+    if (conn->binary) {
+        if (!reason) return;
+        uint8_t payload[2 + 256];
+        size_t n = 0;
+        payload[n++] = WIRE_SPECTATE_NACK;
+        n += wire_putString(payload + n, reason);
+        sendFrame(conn->fd, payload, n);
+        return;
+    }
+    
+    JsonLine line;
+    lineBegin(&line, reason ? "spectate_nack" : "spectate_ack");
+    if (reason) {
+        lineRaw(&line, ",\"reason\":");
+        lineString(&line, reason);
+    } else {
+        lineRaw(&line, ",\"game_id\":");
+        lineInt(&line, game_id);
+        if (conn->watch_binary) {
+            lineRaw(&line, ",\"protocol\":");
+            lineString(&line, WIRE_PROTOCOL_NAME);
+        }
+    }
+    lineEnd(&line);
+    sendLine(conn->fd, &line);
+    
+    // Everything after this ack is framed
+    if (!reason && conn->watch_binary) conn->binary = 1;
+}
+
+// Main thread: send the connection to the worker running the game; game_id
+// 0 picks the latest game. Players cannot watch while registered.
+void handleSpectate(int clientfd, int game_id, int binary) {
+    printf("Spectate request for game %d (fd=%d%s)\n", game_id, clientfd, binary ? ", binary" : "");
+    
+    Connection* conn = connections[clientfd];
+    if (!conn) return;
+    
+    if (conn->registered) {
+        sendSpectateResult(conn, "already registered", game_id);
+        return;
+    }
+    if (game_id <= 0) game_id = nextGameId - 1;
+    if (game_id <= 0 || game_id >= nextGameId) {
+        sendSpectateResult(conn, "no such game", game_id);
+        return;
+    }
+    
+    conn->watch_id = game_id;
+    conn->watch_binary = binary;
+    conn->handoff = 1;  // handOff passes it on after the game itself
+    conn->next_handoff = currentLoop->handoffConnections;
+    currentLoop->handoffConnections = conn;
+}
+
+// Worker: subscribe a spectator that arrived for one of this loop's games,
+// or refuse it and send it back if the game is over
+void startSpectating(Connection* conn) {
+    GameState* g = currentLoop->activeGames;
+    while (g && g->id != conn->watch_id) g = g->next;
+    conn->handoff = 0;
+    
+    if (!g) {
+        sendSpectateResult(conn, "game is over", conn->watch_id);
+        if (!conn->closing) {
+            conn->handoff = 1;
+            conn->next_handoff = currentLoop->handoffConnections;
+            currentLoop->handoffConnections = conn;
+        }
+        return;
+    }
+    if (watchConnection(conn) == -1) {
+        scheduleClose(conn);
+        return;
+    }
+    
+    conn->watching = g;
+    conn->spectator_prev = NULL;
+    conn->spectator_next = g->spectators;
+    if (g->spectators) g->spectators->spectator_prev = conn;
+    g->spectators = conn;
+    g->spectator_count++;
+    printf("Spectator %d watches game #%d (%d watching)\n", conn->fd, g->id, g->spectator_count);
+    
+    sendSpectateResult(conn, NULL, g->id);
+    sendSnapshot(g, conn);
+    processInput(conn);
+}
+
+void stopSpectating(Connection* conn) {
+    GameState* g = conn->watching;
+    if (!g) return;
+    
+    if (conn->spectator_prev) {
+        conn->spectator_prev->spectator_next = conn->spectator_next;
+    } else {
+        g->spectators = conn->spectator_next;
+    }
+    if (conn->spectator_next) {
+        conn->spectator_next->spectator_prev = conn->spectator_prev;
+    }
+    conn->spectator_prev = NULL;
+    conn->spectator_next = NULL;
+    conn->watching = NULL;
+    g->spectator_count--;
+}
+
+// ===== ARENA =====
+// -arena N: the first two players to register play N games back to back,
+// on the connections they keep open or on new ones under the same names.
+// Each game ends with an "ARENA {...}" result line on stdout, the last one
+// also with a summary line, and then the server shuts down.
+
+// Why a register is refused in arena mode, NULL if it is not
+const char* arenaRefusal(const char* username) {
+    if (arenaGames == 0) return NULL;
+    if (arenaStarted >= arenaGames) return "arena is over";
+    if (arenaPlayers[0][0] && strcmp(username, arenaPlayers[0]) != 0 &&
+        strcmp(username, arenaPlayers[1]) != 0) {
+        return "arena is full";
+    }
+    return NULL;
+}
+
+// Start the next arena game once both players wait in the lobby
+void runArenaMatch() {
+    if (arenaStarted >= arenaGames || !lobbyHead || !lobbyHead->lobby_next) return;
+    
+    if (!arenaPlayers[0][0]) {
+        snprintf(arenaPlayers[0], sizeof(arenaPlayers[0]), "%s", lobbyHead->username);
+        snprintf(arenaPlayers[1], sizeof(arenaPlayers[1]), "%s", lobbyHead->lobby_next->username);
+    }
+    
+    Connection* seats[2] = {NULL, NULL};
+    for (Connection* c = lobbyHead; c; c = c->lobby_next) {
+        for (int i = 0; i < 2; i++) {
+            if (!seats[i] && strcmp(c->username, arenaPlayers[i]) == 0) seats[i] = c;
+        }
+    }
+    if (!seats[0] || !seats[1]) return;
+    
+    int swap = arenaSwapColors && (arenaStarted % 2 == 1);
+    if (!createGame(seats[swap], seats[1 - swap])) {
+        printf("Out of memory, cannot start a game\n");
+        return;
+    }
+    arenaStarted++;
+}
+
+// Worker: tally a finished arena game and print its result line; the last
+// game also prints the summary and stops the server
+void arenaReport(GameState* g, int red_count, int blue_count) {
+    int scores[MAX_PLAYERS] = {red_count, blue_count};
+    int disconnected = !g->players[0].connected || !g->players[1].connected;
+    JsonLine line;
+    
+    pthread_mutex_lock(&arenaLock);
+    int game = ++arenaFinished;
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        ArenaScore* score = &arenaScores[strcmp(g->players[i].username, arenaPlayers[0]) == 0 ? 0 : 1];
+        score->discs += scores[i];
+        if (scores[i] > scores[1 - i]) score->wins++;
+        else if (scores[i] < scores[1 - i]) score->losses++;
+        else score->draws++;
+    }
+    
+    lineBegin(&line, "arena_result");
+    lineRaw(&line, ",\"game\":");
+    lineInt(&line, game);
+    lineRaw(&line, ",\"red\":");
+    lineString(&line, g->players[0].username);
+    lineRaw(&line, ",\"blue\":");
+    lineString(&line, g->players[1].username);
+    lineRaw(&line, ",\"red_score\":");
+    lineInt(&line, red_count);
+    lineRaw(&line, ",\"blue_score\":");
+    lineInt(&line, blue_count);
+    lineRaw(&line, ",\"winner\":");
+    if (red_count == blue_count) lineRaw(&line, "null");
+    else lineString(&line, g->players[red_count > blue_count ? 0 : 1].username);
+    lineRaw(&line, ",\"moves\":");
+    lineInt(&line, g->moves_count);
+    lineRaw(&line, ",\"duration_ms\":");
+    lineInt(&line, wallclock_ms() - g->started_at_ms);
+    lineRaw(&line, ",\"end\":");
+    lineString(&line, disconnected ? "disconnect" : "normal");
+    lineEnd(&line);
+    printf("ARENA %.*s", (int)line.len, line.text);
+    
+    if (game == arenaGames) {
+        lineBegin(&line, "arena_summary");
+        lineRaw(&line, ",\"games\":");
+        lineInt(&line, game);
+        lineRaw(&line, ",\"players\":[");
+        for (int i = 0; i < 2; i++) {
+            lineRaw(&line, i ? ",{\"name\":" : "{\"name\":");
+            lineString(&line, arenaPlayers[i]);
+            lineRaw(&line, ",\"wins\":");
+            lineInt(&line, arenaScores[i].wins);
+            lineRaw(&line, ",\"draws\":");
+            lineInt(&line, arenaScores[i].draws);
+            lineRaw(&line, ",\"losses\":");
+            lineInt(&line, arenaScores[i].losses);
+            lineRaw(&line, ",\"discs\":");
+            lineInt(&line, arenaScores[i].discs);
+            lineRaw(&line, "}");
+        }
+        lineRaw(&line, "]");
+        lineEnd(&line);
+        printf("ARENA %.*s", (int)line.len, line.text);
+    }
+    fflush(stdout);
+    pthread_mutex_unlock(&arenaLock);
+    
+    if (game == arenaGames) requestStop(0);
+}
+
+// ===== LOBBY AND MATCHMAKING =====
+
+// Rating of a username, created at INITIAL_RATING on first sight.
+// Callers hold ratingsLock.
+RatingEntry* findRating(const char* username) {
+    for (int i = 0; i < ratingCount; i++) {
+        if (strcmp(ratings[i].username, username) == 0) {
+            return &ratings[i];
+        }
+    }
+    
+    if (ratingCount == ratingCapacity) {
+        int capacity = ratingCapacity ? ratingCapacity * 2 : 64;
+        RatingEntry* grown = realloc(ratings, capacity * sizeof(RatingEntry));
+        if (!grown) return NULL;
+        ratings = grown;
+        ratingCapacity = capacity;
+    }
+    
+    RatingEntry* entry = &ratings[ratingCount++];
+    memset(entry, 0, sizeof(*entry));
+    strncpy(entry->username, username, sizeof(entry->username) - 1);
+    entry->rating = INITIAL_RATING;
+    return entry;
+}
+
+double ratingOf(const char* username) {
+    pthread_mutex_lock(&ratingsLock);
+    RatingEntry* entry = findRating(username);
+    double rating = entry ? entry->rating : INITIAL_RATING;
+    pthread_mutex_unlock(&ratingsLock);
+    return rating;
+}
+
+// Elo update from red's point of view: score is 1 for a red win, 0.5 for a draw
+void updateRatings(GameState* g, double score) {
+    pthread_mutex_lock(&ratingsLock);
+    RatingEntry* red = findRating(g->players[0].username);
+    RatingEntry* blue = findRating(g->players[1].username);
+    if (red && blue) {
+        double expected = 1.0 / (1.0 + pow(10.0, (blue->rating - red->rating) / 400.0));
+        red->rating += ELO_K * (score - expected);
+        blue->rating -= ELO_K * (score - expected);
+        red->games++;
+        blue->games++;
+    }
+    pthread_mutex_unlock(&ratingsLock);
+}
+
+// Reserve a username for a registering connection; fails if a player in the
+// lobby or in a game (on any thread) already uses it
+int claimUsername(const char* username) {
+    int claimed = 0;
+    pthread_mutex_lock(&usernamesLock);
+    
+    int inUse = 0;
+    for (int i = 0; i < usernameCount && !inUse; i++) {
+        inUse = strcmp(usernames[i], username) == 0;
+    }
+    
+    if (!inUse && usernameCount == usernameCapacity) {
+        int capacity = usernameCapacity ? usernameCapacity * 2 : 64;
+        char (*grown)[256] = realloc(usernames, capacity * sizeof(*usernames));
+        if (grown) {
+            usernames = grown;
+            usernameCapacity = capacity;
+        }
+    }
+    if (!inUse && usernameCount < usernameCapacity) {
+        snprintf(usernames[usernameCount++], sizeof(usernames[0]), "%s", username);
+        claimed = 1;
+    }
+    
+    pthread_mutex_unlock(&usernamesLock);
+    return claimed;
+}
+
+void releaseUsername(const char* username) {
+    pthread_mutex_lock(&usernamesLock);
+    for (int i = 0; i < usernameCount; i++) {
+        if (strcmp(usernames[i], username) == 0) {
+            memcpy(usernames[i], usernames[--usernameCount], sizeof(usernames[0]));
+            break;
+        }
+    }
+    pthread_mutex_unlock(&usernamesLock);
+}
+
+// Leave the lobby or a game: the name becomes free and the connection may register again
+void unregister(Connection* conn) {
+    if (!conn->registered) return;
+    releaseUsername(conn->username);
+    conn->registered = 0;
+}
+
+// The lobby is only touched by the main thread
+void lobbyAdd(Connection* conn) {
+    conn->in_lobby = 1;
+    conn->lobby_prev = lobbyTail;
+    conn->lobby_next = NULL;
+    if (lobbyTail) {
+        lobbyTail->lobby_next = conn;
+    } else {
+        lobbyHead = conn;
+    }
+    lobbyTail = conn;
+}
+
+void lobbyRemove(Connection* conn) {
+    if (!conn->in_lobby) return;
+    conn->in_lobby = 0;
+    
+    if (conn->lobby_prev) {
+        conn->lobby_prev->lobby_next = conn->lobby_next;
+    } else {
+        lobbyHead = conn->lobby_next;
+    }
+    if (conn->lobby_next) {
+        conn->lobby_next->lobby_prev = conn->lobby_prev;
+    } else {
+        lobbyTail = conn->lobby_prev;
+    }
+    conn->lobby_prev = NULL;
+    conn->lobby_next = NULL;
+}
+
+// Start a game between two lobby players; red is the one who waited longer.
+// The game stays on the main thread's activeGames until the end of the
+// current batch of events, when handOffGames passes it to its worker.
+GameState* createGame(Connection* red, Connection* blue) {
+    GameState* g = calloc(1, sizeof(GameState));
+    if (!g) return NULL;
+    
+    g->id = nextGameId++;
+    g->timer_index = -1;
+    g->handoff_node.kind = HANDOFF_GAME;
+    initializeBoard(g);
+    boardToBits(g, &g->start_red, &g->start_blue, &g->start_blocked);
+    g->started_at_ms = wallclock_ms();
+    
+    Connection* seats[MAX_PLAYERS] = {red, blue};
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        Connection* conn = seats[i];
+        lobbyRemove(conn);
+        snprintf(g->players[i].username, sizeof(g->players[i].username), "%s", conn->username);
+        g->players[i].sockfd = conn->fd;
+        g->players[i].color = (i == 0) ? RED : BLUE;
+        g->players[i].connected = 1;
+        g->players[i].is_human = conn->is_human;
+        conn->game = g;
+        conn->player_idx = i;
+        conn->handoff = 1;  // Stop reading its input here; the worker takes over
+    }
+    g->num_players = MAX_PLAYERS;
+    
+    g->next = currentLoop->activeGames;
+    if (currentLoop->activeGames) currentLoop->activeGames->prev = g;
+    currentLoop->activeGames = g;
+    
+    initializeLog(g);
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        logText(g->log, "Player %s registered as %c (%s)\n", g->players[i].username,
+                g->players[i].color, g->players[i].is_human ? "human" : "ai");
+    }
+    
+    printf("Game #%d: %s (Red) vs %s (Blue)\n", g->id, g->players[0].username, g->players[1].username);
+    
+    g->game_started = 1;
+    g->current_player = 0;
+    logBoardState(g, "Game Started - Initial Board");
+    broadcastGameStart(g);
+    sendYourTurn(g, g->current_player);
+    return g;
+}
+
+// Pair waiting players until fewer than two are left
+void runMatchmaker() {
+    if (arenaGames > 0) {
+        runArenaMatch();
+        return;
+    }
+    
+    while (lobbyHead && lobbyHead->lobby_next) {
+        Connection* first = lobbyHead;
+        Connection* second = first->lobby_next;
+        
+        if (matchMode == MATCH_RATING) {
+            double rating = ratingOf(first->username);
+            double bestGap = fabs(ratingOf(second->username) - rating);
+            for (Connection* c = second->lobby_next; c; c = c->lobby_next) {
+                double gap = fabs(ratingOf(c->username) - rating);
+                if (gap < bestGap) {
+                    bestGap = gap;
+                    second = c;
+                }
+            }
+        }
+        
+        if (!createGame(first, second)) {
+            printf("Out of memory, cannot start a game\n");
+            return;
+        }
+    }
+}
+
+// Detach a finished game from its players and the active list; it is freed
+// after the current event, once no handler can still be using it. A worker
+// returns the players' connections to the main thread's lobby side.
+void releaseGame(GameState* g) {
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        int fd = g->players[i].sockfd;
+        if (!g->players[i].connected || fd < 0 || fd >= MAX_CONNECTIONS) continue;
+        
+        Connection* conn = connections[fd];
+        if (!conn || conn->game != g) continue;
+        
+        conn->game = NULL;
+        unregister(conn);
+        
+        if (currentLoop == &acceptorLoop) {
+            conn->handoff = 0;  // Ended before reaching a worker
+        } else if (!conn->closing) {
+            conn->handoff = 1;
+            conn->next_handoff = currentLoop->handoffConnections;
+            currentLoop->handoffConnections = conn;
+        }
+    }
+    
+    // Spectators go back as well, free to watch another game or register
+    while (g->spectators) {
+        Connection* conn = g->spectators;
+        stopSpectating(conn);
+        if (currentLoop != &acceptorLoop && !conn->closing) {
+            conn->handoff = 1;
+            conn->next_handoff = currentLoop->handoffConnections;
+            currentLoop->handoffConnections = conn;
+        }
+    }
+    
+    if (g->prev) g->prev->next = g->next;
+    else currentLoop->activeGames = g->next;
+    if (g->next) g->next->prev = g->prev;
+    
+    g->prev = NULL;
+    g->next = currentLoop->finishedGames;
+    currentLoop->finishedGames = g;
+}
+
+void freeFinishedGames() {
+    while (currentLoop->finishedGames) {
+        GameState* g = currentLoop->finishedGames;
+        currentLoop->finishedGames = g->next;
+        closeLog(g);
+        free(g->record_moves);
+        free(g);
+    }
+}
+
+// Answer a register in the connection's protocol; reason is NULL for an ack
+void sendRegisterResult(Connection* conn, const char* reason, int binary) {
+    if (conn->binary) {
+        uint8_t payload[2 + 256];
+        size_t n = 0;
+        payload[n++] = reason ? WIRE_REGISTER_NACK : WIRE_REGISTER_ACK;
+        if (reason) n += wire_putString(payload + n, reason);
+        sendFrame(conn->fd, payload, n);
+        return;
+    }
+    
+    cJSON* response = cJSON_CreateObject();
+    if (!response) return;
+    
+    cJSON_AddStringToObject(response, "type", reason ? "register_nack" : "register_ack");
+    if (reason) {
+        cJSON_AddStringToObject(response, "reason", reason);
+    } else if (binary) {
+        cJSON_AddStringToObject(response, "protocol", WIRE_PROTOCOL_NAME);
+    }
+    sendJSON(conn->fd, response);
+    cJSON_Delete(response);
+    
+    // Everything after this ack is framed
+    if (!reason && binary) conn->binary = 1;
+}
+
+// Handle register request
+void handleRegister(int clientfd, const char* username, const char* player_type, int binary) {
+    printf("Registration request from %s (fd=%d, type=%s%s)\n", username, clientfd,
+           player_type ? player_type : "ai", binary ? ", binary" : "");
+    
+    Connection* conn = connections[clientfd];
+    if (!conn) return;
+    
+    // A connection plays one game at a time; it may register again after game over
+    if (conn->registered) {
+        sendRegisterResult(conn, "already registered", binary);
+        return;
+    }
+    
+    const char* refusal = arenaRefusal(username);
+    if (refusal) {
+        sendRegisterResult(conn, refusal, binary);
+        return;
+    }
+    
+    // Check if username already exists
+    if (!claimUsername(username)) {
+        sendRegisterResult(conn, "username already exists", binary);
+        return;
+    }
+    
+    // Add player to the lobby
+    strncpy(conn->username, username, sizeof(conn->username) - 1);
+    conn->is_human = (player_type && strcmp(player_type, "human") == 0);
+    conn->registered = 1;
+    lobbyAdd(conn);
+    
+    sendRegisterResult(conn, NULL, binary);
+    
+    printf("Player %s joined the lobby (%s, rating %.0f)\n", username,
+           conn->is_human ? "human" : "ai", ratingOf(username));
+    // tournament.py waits for this line before starting the second player;
+    // like the ARENA lines it must not sit in a full stdout buffer
+    if (arenaGames > 0) fflush(stdout);
+    
+    runMatchmaker();
+}
+
+
+// Broadcast game start to both players
+void broadcastGameStart(GameState* g) {
+    // Don't include board in game_start (as per TA specification)
+    JsonLine line;
+    lineBegin(&line, "game_start");
+    lineRaw(&line, ",\"players\":[");
+    lineString(&line, g->players[0].username);
+    lineRaw(&line, ",");
+    lineString(&line, g->players[1].username);
+    lineRaw(&line, "],\"first_player\":");
+    lineString(&line, g->players[0].username);
+    lineEnd(&line);
+    
+    uint8_t payload[1 + 2 * 258];
+    size_t n = 0;
+    payload[n++] = WIRE_GAME_START;
+    n += wire_putString(payload + n, g->players[0].username);
+    n += wire_putString(payload + n, g->players[1].username);
+    
+    broadcast(g, &line, payload, n);
+}
+
+// Send your_turn message
+void sendYourTurn(GameState* g, int player_idx) {
+    if (player_idx < 0 || player_idx >= MAX_PLAYERS) return;
+    
+    g->turn_started_ms = now_ms();
+    
+    // Set timeout based on player type; AI players get a deadline that the
+    // loop's timerfd enforces to the millisecond
+    long long timeout_ms, time_left_ms;
+    if (g->players[player_idx].is_human) {
+        timeout_ms = 999999000LL;  // Effectively no timeout
+        time_left_ms = -1;
+        timer_cancel(g);
+    } else {
+        long long deadline = now_ms() + TIMEOUT_MS;
+        timer_arm(g, deadline);
+        timeout_ms = TIMEOUT_MS;
+        time_left_ms = deadline - now_ms();
+    }
+    
+    if (!g->players[player_idx].connected) return;
+    int sockfd = g->players[player_idx].sockfd;
+    
+    if (isBinary(sockfd)) {
+        uint8_t payload[1 + WIRE_BOARD_BYTES + 20];
+        size_t n = 0;
+        payload[n++] = WIRE_YOUR_TURN;
+        n += wire_putBoard(payload + n, (const char (*)[8])g->board);
+        n += wire_putVarint(payload + n, (uint64_t)timeout_ms);
+        n += wire_putVarint(payload + n, (uint64_t)(time_left_ms < 0 ? timeout_ms : time_left_ms));
+        sendFrame(sockfd, payload, n);
+        return;
+    }
+    
+    JsonLine line;
+    lineBegin(&line, "your_turn");
+    lineRaw(&line, ",\"board\":");
+    lineBoard(&line, g);
+    lineRaw(&line, ",\"timeout\":");
+    lineInt(&line, timeout_ms / 1000);
+    if (time_left_ms >= 0) {
+        lineRaw(&line, ",\"time_left_ms\":");
+        lineInt(&line, time_left_ms);
+    }
+    lineEnd(&line);
+    
+    sendLine(sockfd, &line);
+}
+
+
+// Get move type
+int getMoveType(int sx, int sy, int tx, int ty) {
+    int dx = abs(tx - sx);
+    int dy = abs(ty - sy);
+    
+    if (dx == 0 && dy == 0) return -1;
+    
+    if (dx <= 1 && dy <= 1) return CLONE;
+    
+    if ((dx == 2 && dy == 0) || (dx == 0 && dy == 2) || (dx == 2 && dy == 2)) return JUMP;
+    
+    return -1;
+}
+
+// Check if move is valid
+int isValidMove(GameState* g, int sx, int sy, int tx, int ty, int player_idx) {
+    if (sx < 0 || sx >= BOARD_SIZE || sy < 0 || sy >= BOARD_SIZE ||
+        tx < 0 || tx >= BOARD_SIZE || ty < 0 || ty >= BOARD_SIZE) {
+        return 0;
+    }
+    
+    char playerPiece = g->players[player_idx].color;
+    if (g->board[sx][sy] != playerPiece) {
+        return 0;
+    }
+    
+    if (g->board[tx][ty] != EMPTY) {
+        return 0;
+    }
+    
+    return getMoveType(sx, sy, tx, ty) > 0;
+}
+
+// Flip adjacent pieces
+void flipAdjacentPieces(GameState* g, int r, int c, char playerPiece) {
+    char opponentPiece = (playerPiece == RED) ? BLUE : RED;
+    
+    for (int dr = -1; dr <= 1; dr++) {
+        for (int dc = -1; dc <= 1; dc++) {
+            if (dr == 0 && dc == 0) continue;
+            
+            int nr = r + dr;
+            int nc = c + dc;
+            
+            if (nr >= 0 && nr < BOARD_SIZE && nc >= 0 && nc < BOARD_SIZE) {
+                if (g->board[nr][nc] == opponentPiece) {
+                    g->board[nr][nc] = playerPiece;
+                }
+            }
+        }
+    }
+}
+
+// Make a move on the board
+void makeMove(GameState* g, int sx, int sy, int tx, int ty, int player_idx) {
+    char playerPiece = g->players[player_idx].color;
+    int moveType = getMoveType(sx, sy, tx, ty);
+    
+    g->board[tx][ty] = playerPiece;
+    
+    if (moveType == JUMP) {
+        g->board[sx][sy] = EMPTY;
+    }
+    
+    flipAdjacentPieces(g, tx, ty, playerPiece);
+}
+
+// Count pieces
+int countPieces(GameState* g, char piece) {
+    int count = 0;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            if (g->board[i][j] == piece) {
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+// Check if player has valid moves
+int hasValidMove(GameState* g, int player_idx) {
+    if (player_idx < 0 || player_idx >= MAX_PLAYERS) return 0;
+    
+    char playerPiece = g->players[player_idx].color;
+    
+    for (int sx = 0; sx < BOARD_SIZE; sx++) {
+        for (int sy = 0; sy < BOARD_SIZE; sy++) {
+            if (g->board[sx][sy] == playerPiece) {
+                for (int tx = 0; tx < BOARD_SIZE; tx++) {
+                    for (int ty = 0; ty < BOARD_SIZE; ty++) {
+                        if (isValidMove(g, sx, sy, tx, ty, player_idx)) {
+                            return 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+// Check if game is over
+int isGameOver(GameState* g) {
+    if (countPieces(g, EMPTY) == 0) return 1;
+    if (countPieces(g, RED) == 0 || countPieces(g, BLUE) == 0) return 1;
+    if (g->pass_count >= 2) return 1;
+    
+    return 0;
+}
+
+// Game and seat of the player on clientfd, if it is that player's turn
+GameState* gameOnTurn(int clientfd, int* player_idx) {
+    Connection* conn = connections[clientfd];
+    if (!conn || !conn->game || conn->game->game_over) return NULL;
+    
+    GameState* g = conn->game;
+    if (conn->player_idx != g->current_player) return NULL;
+    
+    *player_idx = conn->player_idx;
+    return g;
+}
+
+void sendNotYourTurn(int clientfd) {
+    if (isBinary(clientfd)) {
+        uint8_t payload[2] = {WIRE_INVALID_MOVE, 0};
+        sendFrame(clientfd, payload, sizeof(payload));
+        return;
+    }
+    
+    JsonLine line;
+    lineBegin(&line, "invalid_move");
+    lineRaw(&line, ",\"reason\":\"not your turn\"");
+    lineEnd(&line);
+    sendLine(clientfd, &line);
+}
+
+// Handle pass
+void handlePass(int clientfd, const char* username) {
+    int player_idx = -1;
+    GameState* g = gameOnTurn(clientfd, &player_idx);
+    
+    if (!g) {
+        sendNotYourTurn(clientfd);
+        return;
+    }
+    
+    if (hasValidMove(g, player_idx)) {
+        // Has valid moves, cannot pass
+        broadcastBoardUpdate(g, "invalid_move", WIRE_PASS_MOVE, g->current_player);
+        
+        logMove(g, EVENT_INVALID, username, 0, 0, 0, 0, "Invalid pass - has valid moves");
+    } else {
+        // Valid pass
+        g->pass_count++;
+        g->moves_count++;
+        
+        broadcastBoardUpdate(g, "move_ok", WIRE_PASS_MOVE, 1 - g->current_player);
+        broadcastDelta(g, WIRE_PASS_MOVE, 0, 1 - g->current_player);
+        
+        logMove(g, EVENT_PASS, username, 0, 0, 0, 0, "Valid pass");
+        recordMove(g, WIRE_PASS_MOVE);
+        logBoardState(g, "After Pass");
+        
+        g->current_player = 1 - g->current_player;
+        
+        if (isGameOver(g)) {
+            sendGameOver(g);
+        } else {
+            sendYourTurn(g, g->current_player);
+        }
+    }
+}
+
+// Handle move request
+void handleMove(int clientfd, const char* username, int sx, int sy, int tx, int ty) {
+    int player_idx = -1;
+    GameState* g = gameOnTurn(clientfd, &player_idx);
+    
+    if (!g) {
+        sendNotYourTurn(clientfd);
+        return;
+    }
+    
+    // Check for pass move
+    if (sx == 0 && sy == 0 && tx == 0 && ty == 0) {
+        handlePass(clientfd, username);
+        return;
+    }
+    
+    // Convert from 1-indexed to 0-indexed
+    sx--; sy--; tx--; ty--;
+    
+    int next_player = 1 - g->current_player;
+    int onBoard = sx >= 0 && sx < BOARD_SIZE && sy >= 0 && sy < BOARD_SIZE &&
+                  tx >= 0 && tx < BOARD_SIZE && ty >= 0 && ty < BOARD_SIZE;
+    uint16_t move = onBoard ? wire_packMove(sx+1, sy+1, tx+1, ty+1) : WIRE_OFF_BOARD_MOVE;
+    
+    if (isValidMove(g, sx, sy, tx, ty, player_idx)) {
+        char opponent = g->players[next_player].color;
+        uint64_t opponent_before = g->spectators ? pieceBits(g, opponent) : 0;
+        makeMove(g, sx, sy, tx, ty, player_idx);
+        
+        logMove(g, EVENT_MOVE, username, sx+1, sy+1, tx+1, ty+1, "Valid move");
+        recordMove(g, move);
+        logBoardState(g, "After Move");
+        
+        g->pass_count = 0;  // Reset pass counter
+        g->current_player = next_player;
+        g->moves_count++;
+        
+        broadcastBoardUpdate(g, "move_ok", move, next_player);
+        if (g->spectators) {
+            broadcastDelta(g, move, opponent_before & ~pieceBits(g, opponent), next_player);
+        }
+        
+        printBoard(g);
+        
+        if (isGameOver(g)) {
+            sendGameOver(g);
+        } else {
+            sendYourTurn(g, g->current_player);
+        }
+    } else {
+        logMove(g, EVENT_INVALID, username, sx+1, sy+1, tx+1, ty+1, "Invalid move");
+        
+        broadcastBoardUpdate(g, "invalid_move", move, g->current_player);
+    }
+}
+
+// Send pass message when timeout occurs
+void sendPassMessage(GameState* g, int player_idx) {
+    int next_player = 1 - player_idx;
+    
+    JsonLine line;
+    lineBegin(&line, "pass");
+    lineRaw(&line, ",\"next_player\":");
+    lineString(&line, g->players[next_player].username);
+    lineEnd(&line);
+    
+    uint8_t payload[2] = {WIRE_PASS, (uint8_t)next_player};
+    broadcast(g, &line, payload, sizeof(payload));
+    broadcastDelta(g, WIRE_PASS_MOVE, 0, next_player);
+}
+
+// Send game over message
+void sendGameOver(GameState* g) {
+    int red_count = countPieces(g, RED);
+    int blue_count = countPieces(g, BLUE);
+    
+    JsonLine line;
+    lineBegin(&line, "game_over");
+    lineRaw(&line, ",\"scores\":{");
+    for (int i = 0; i < MAX_PLAYERS; i++) {
+        int player_score = (g->players[i].color == RED) ? red_count : blue_count;
+        if (i > 0) lineRaw(&line, ",");
+        lineString(&line, g->players[i].username);
+        lineRaw(&line, ":");
+        lineInt(&line, player_score);
+    }
+    lineRaw(&line, "}");
+    lineEnd(&line);
+    
+    uint8_t payload[1 + 2 * 10];
+    size_t n = 0;
+    payload[n++] = WIRE_GAME_OVER;
+    n += wire_putVarint(payload + n, red_count);
+    n += wire_putVarint(payload + n, blue_count);
+    broadcast(g, &line, payload, n);
+    broadcastSpectators(g, &line, payload, n);
+    
+    printf("\n=== GAME OVER (Game #%d) ===\n", g->id);
+    printf("Red: %d, Blue: %d\n", red_count, blue_count);
+    printf("Total moves: %d\n", g->moves_count);
+    
+    logBoardState(g, "Game Over - Final Board");
+    if (g->log) {
+        LogEvent* ev = logBegin(g->log, LOG_TEXT);
+        ev->record = EVENT_END;
+        ev->seat = 0;
+        boardToBits(g, &ev->red, &ev->blue, &ev->blocked);
+        ev->moves_count = g->moves_count;
+        ev->len = snprintf(ev->text, sizeof(ev->text),
+                           "\nFinal Score: Red=%d, Blue=%d\nTotal moves: %d\n\nGame completed successfully\n",
+                           red_count, blue_count, g->moves_count);
+        logCommit(ev);
+    }
+    
+    archiveGame(g, red_count, blue_count);
+    updateRatings(g, red_count > blue_count ? 1.0 : (red_count < blue_count ? 0.0 : 0.5));
+    atomic_fetch_add(&gamesPlayed, 1);
+    if (arenaGames > 0) arenaReport(g, red_count, blue_count);
+    
+    g->game_started = 0;
+    g->game_over = 1;
+    timer_cancel(g);
+    releaseGame(g);
+}
+
+// Handle client disconnect
+void handleClientDisconnect(Connection* conn) {
+    if (conn->watching) {
+        printf("Spectator %d left game #%d\n", conn->fd, conn->watching->id);
+        stopSpectating(conn);
+        return;
+    }
+    
+    GameState* g = conn->game;
+    if (!g) {
+        lobbyRemove(conn);
+        if (conn->registered) {
+            printf("Player %s left the lobby\n", conn->username);
+        }
+        unregister(conn);
+        return;
+    }
+    
+    int i = conn->player_idx;
+    g->players[i].connected = 0;
+    conn->game = NULL;
+    unregister(conn);
+    printf("Player %s disconnected\n", g->players[i].username);
+    
+    if (g->log) {
+        LogEvent* ev = logBegin(g->log, LOG_TEXT);
+        ev->record = EVENT_DISCONNECT;
+        ev->seat = (uint8_t)i;
+        ev->len = snprintf(ev->text, sizeof(ev->text), "Player %s disconnected\n", g->players[i].username);
+        logCommit(ev);
+    }
+    
+    // Check if both disconnected
+    int connected_count = 0;
+    for (int j = 0; j < MAX_PLAYERS; j++) {
+        if (g->players[j].connected) connected_count++;
+    }
+    
+    if (connected_count == 0 && g->game_started) {
+        printf("Both players disconnected. Game terminated.\n");
+        sendGameOver(g);
+    } else if (g->game_started && i == g->current_player) {
+        // Pass turn to other player
+        recordMove(g, GAME_RECORD_FORCED);
+        g->pass_count++;
+        g->current_player = 1 - i;
+        if (g->players[g->current_player].connected) {
+            sendPassMessage(g, i);
+            sendYourTurn(g, g->current_player);
+        }
+    }
+}
+
+// Force a pass on an AI player whose deadline passed
+void handleTimeout(GameState* g) {
+    printf("Timeout for player %s\n", g->players[g->current_player].username);
+    
+    logMove(g, EVENT_TIMEOUT, g->players[g->current_player].username, 0, 0, 0, 0, "Timeout - forced pass");
+    recordMove(g, GAME_RECORD_FORCED);
+    
+    g->pass_count++;
+    sendPassMessage(g, g->current_player);
+    g->current_player = 1 - g->current_player;
+    
+    if (isGameOver(g)) {
+        sendGameOver(g);
+    } else {
+        sendYourTurn(g, g->current_player);
+    }
+}
+
+// Print board
+void printBoard(GameState* g) {
+    printf("\nCurrent Board (Game #%d):\n", g->id);
+    printf("  1 2 3 4 5 6 7 8\n");
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        printf("%d ", i + 1);
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            printf("%c ", g->board[i][j]);
         }
+        printf("\n");
+    }
+    printf("Red: %d, Blue: %d, Empty: %d\n",
+           countPieces(g, RED), countPieces(g, BLUE), countPieces(g, EMPTY));
+    printf("\n");
+}
+
+// ===== CONNECTIONS =====
+
+int setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    if (flags == -1) return -1;
+    return fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+// Register a connection with the current thread's epoll
+int watchConnection(Connection* conn) {
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    ev.data.fd = conn->fd;
+    if (epoll_ctl(currentLoop->epollfd, EPOLL_CTL_ADD, conn->fd, &ev) == -1) {
+        perror("epoll_ctl error");
+        return -1;
+    }
+    return 0;
+}
+
+// Take ownership of an accepted socket
+Connection* openConnection(int fd) {
+    if (fd >= MAX_CONNECTIONS || setNonBlocking(fd) == -1) {
+        close(fd);
+        return NULL;
+    }
+    
+    Connection* conn = calloc(1, sizeof(Connection));
+    if (!conn) {
+        close(fd);
+        return NULL;
+    }
+    conn->fd = fd;
+    conn->handoff_node.kind = HANDOFF_CONNECTION;
+    connections[fd] = conn;
+    
+    // Every message is one small write that the peer waits on; don't let
+    // Nagle hold it back for the previous one's delayed ACK
+    int nodelay = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+    
+    if (watchConnection(conn) == -1) {
+        connections[fd] = NULL;
+        close(fd);
+        free(conn);
+        return NULL;
+    }
+    return conn;
+}
+
+// Close at the end of the current event, so handlers never see a freed
+// connection. One that is moving to another loop is closed by that loop.
+void scheduleClose(Connection* conn) {
+    if (conn->closing || conn->handoff) return;
+    conn->closing = 1;
+    conn->next_closing = currentLoop->closingConnections;
+    currentLoop->closingConnections = conn;
+}
+
+void closePendingConnections() {
+    while (currentLoop->closingConnections) {
+        Connection* conn = currentLoop->closingConnections;
+        currentLoop->closingConnections = conn->next_closing;
         
-        logMove(username, 0, 0, 0, 0, "Valid pass");
-        logBoardState("After Pass");
-        
-        game.current_player = 1 - game.current_player;
-        game.last_move_time = time(NULL);
+        // May queue messages to (and closes of) other players
+        handleClientDisconnect(conn);
         
-        if (isGameOver()) {
-            sendGameOver();
-        } else {
-            sendYourTurn(game.current_player);
+        // Release the slot before the fd, and only if it is still ours, so a
+        // client accepted on the reused fd keeps its connection
+        int fd = conn->fd;
+        Connection* expected = conn;
+        epoll_ctl(currentLoop->epollfd, EPOLL_CTL_DEL, fd, NULL);
+        atomic_compare_exchange_strong(&connections[fd], &expected, NULL);
+        close(fd);
+        releaseShared(conn);
+        free(conn->out);
+        free(conn);
+    }
+    freeFinishedGames();
+}
+
+// Drop sent bytes from the front of out, then of the shared buffers
+void consumeOutput(Connection* conn, size_t sent) {
+    size_t fromOut = sent < conn->out_len ? sent : conn->out_len;
+    conn->out_start += fromOut;
+    conn->out_len -= fromOut;
+    sent -= fromOut;
+    
+    while (sent > 0) {
+        SharedBuffer* buf = conn->shared[conn->shared_head];
+        size_t left = buf->len - conn->shared_offset;
+        if (sent < left) {
+            conn->shared_offset += sent;
+            conn->shared_bytes -= sent;
+            return;
         }
+        sent -= left;
+        conn->shared_bytes -= left;
+        conn->shared_offset = 0;
+        conn->shared_head = (conn->shared_head + 1) % conn->shared_cap;
+        conn->shared_count--;
+        sharedRelease(buf);
     }
-    
-    cJSON_Delete(response);
 }
 
-// Handle move request
-void handleMove(int clientfd, const char* username, int sx, int sy, int tx, int ty) {
-    int player_idx = -1;
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].sockfd == clientfd) {
-            player_idx = i;
+// Write queued output until the socket would block; EPOLLOUT resumes it.
+// out and the shared buffers queued behind it go out in one gathered send.
+void flushOutput(Connection* conn) {
+    while ((conn->out_len > 0 || conn->shared_count > 0) && !conn->closing) {
+        struct iovec iov[OUTPUT_IOV_MAX];
+        int count = 0;
+        if (conn->out_len > 0) {
+            iov[count].iov_base = conn->out + conn->out_start;
+            iov[count++].iov_len = conn->out_len;
+        }
+        for (int i = 0; i < conn->shared_count && count < OUTPUT_IOV_MAX; i++) {
+            SharedBuffer* buf = conn->shared[(conn->shared_head + i) % conn->shared_cap];
+            size_t skip = (i == 0) ? conn->shared_offset : 0;
+            iov[count].iov_base = buf->data + skip;
+            iov[count++].iov_len = buf->len - skip;
+        }
+        
+        struct msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count;
+        ssize_t sent = sendmsg(conn->fd, &msg, MSG_NOSIGNAL);
+        if (sent > 0) {
+            consumeOutput(conn, sent);
+        } else if (sent == -1 && errno == EINTR) {
+            continue;
+        } else if (sent == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
             break;
+        } else {
+            scheduleClose(conn);
         }
     }
+    if (conn->out_len == 0) {
+        conn->out_start = 0;
+    }
+}
+
+// Hand every complete line in the input buffer to the message handler
+void processInput(Connection* conn) {
+    char* start = conn->in;
     
-    if (player_idx == -1 || player_idx != game.current_player) {
-        cJSON* response = cJSON_CreateObject();
-        if (response) {
-            cJSON_AddStringToObject(response, "type", "invalid_move");
-            cJSON_AddStringToObject(response, "reason", "not your turn");
-            sendJSON(clientfd, response);
-            cJSON_Delete(response);
+    // A register_ack can switch the connection to frames between two messages
+    while (!conn->closing && !conn->handoff) {
+        size_t available = conn->in_len - (start - conn->in);
+        
+        if (conn->binary) {
+            const uint8_t* payload;
+            size_t len;
+            int span = wire_nextFrame((const uint8_t*)start, available, &payload, &len);
+            if (span < 0) {
+                printf("Corrupt frame from client %d\n", conn->fd);
+                scheduleClose(conn);
+                break;
+            }
+            if (span == 0) break;
+            handleClientFrame(conn->fd, payload, len);
+            start += span;
+        } else {
+            char* newline = memchr(start, '\n', available);
+            if (!newline) break;
+            *newline = '\0';
+            handleClientMessage(conn->fd, start);
+            start = newline + 1;
         }
-        return;
     }
     
-    // Check for pass move
-    if (sx == 0 && sy == 0 && tx == 0 && ty == 0) {
-        handlePass(clientfd, username);
-        return;
+    // Move remaining data to beginning
+    int remaining = conn->in_len - (start - conn->in);
+    if (remaining > 0 && start != conn->in) {
+        memmove(conn->in, start, remaining);
     }
-    
-    // Convert from 1-indexed to 0-indexed
-    sx--; sy--; tx--; ty--;
-    
-    cJSON* response = cJSON_CreateObject();
-    if (!response) return;
-    
-    cJSON* board_json = NULL;
-    int next_player = 1 - game.current_player;
-    
-    if (isValidMove(sx, sy, tx, ty, player_idx)) {
-        makeMove(sx, sy, tx, ty, player_idx);
-        board_json = boardToJSON();
+    conn->in_len = remaining;
+}
+
+// Read until the socket would block, unless the client stops draining its output
+void readInput(Connection* conn) {
+    while (!conn->closing && !conn->handoff) {
+        if (conn->out_len > OUTPUT_HIGH_WATER) {
+            conn->read_paused = 1;
+            return;
+        }
         
-        if (board_json) {
-            cJSON_AddStringToObject(response, "type", "move_ok");
-            cJSON_AddItemToObject(response, "board", board_json);
-            cJSON_AddStringToObject(response, "next_player", game.players[next_player].username);
-            
-            logMove(username, sx+1, sy+1, tx+1, ty+1, "Valid move");
-            logBoardState("After Move");
-            
-            game.pass_count = 0;  // Reset pass counter
-            game.current_player = next_player;
-            game.moves_count++;
-            game.last_move_time = time(NULL);
-            
-            for (int i = 0; i < MAX_PLAYERS; i++) {
-                if (game.players[i].connected) {
-                    sendJSON(game.players[i].sockfd, response);
-                }
-            }
-            
-            printBoard();
-            
-            if (isGameOver()) {
-                sendGameOver();
-            } else {
-                sendYourTurn(game.current_player);
+        int space = INPUT_BUFFER_SIZE - 1 - conn->in_len;
+        if (space <= 0) {
+            printf("Message from client %d exceeds %d bytes, dropping it\n", conn->fd, INPUT_BUFFER_SIZE);
+            scheduleClose(conn);
+            return;
+        }
+        
+        ssize_t bytes_received = recv(conn->fd, conn->in + conn->in_len, space, 0);
+        if (bytes_received > 0) {
+            conn->in_len += bytes_received;
+            processInput(conn);
+        } else if (bytes_received == -1 && errno == EINTR) {
+            continue;
+        } else if (bytes_received == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return;
+        } else {
+            scheduleClose(conn);
+        }
+    }
+}
+
+// Accept every pending connection on the (edge-triggered) listening socket
+void acceptConnections(int sockfd) {
+    while (1) {
+        int clientfd = accept(sockfd, NULL, NULL);
+        if (clientfd == -1) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("accept error");
             }
+            return;
         }
-    } else {
-        board_json = boardToJSON();
         
-        if (board_json) {
-            cJSON_AddStringToObject(response, "type", "invalid_move");
-            cJSON_AddItemToObject(response, "board", board_json);
-            cJSON_AddStringToObject(response, "next_player", game.players[game.current_player].username);
-            
-            logMove(username, sx+1, sy+1, tx+1, ty+1, "Invalid move");
+        if (openConnection(clientfd)) {
+            printf("New connection (fd=%d)\n", clientfd);
+        }
+    }
+}
+
+// Dispatch one newline-terminated message
+void handleClientMessage(int clientfd, char* line) {
+    if (traceMessages) printf("[CLIENT %d->SERVER] %s\n", clientfd, line);
+    Connection* conn = connections[clientfd];
+    if (conn && conn->game) logText(conn->game->log, "[CLIENT %d->SERVER] %s\n", clientfd, line);
+    
+    // Spectators only listen until their game ends
+    if (conn && conn->watching) return;
+    
+    // Parse JSON
+    cJSON* json = cJSON_Parse(line);
+    if (!json) return;
+    
+    cJSON* type = cJSON_GetObjectItem(json, "type");
+    if (type && cJSON_IsString(type)) {
+        if (strcmp(type->valuestring, "register") == 0) {
+            cJSON* username = cJSON_GetObjectItem(json, "username");
+            cJSON* player_type = cJSON_GetObjectItem(json, "player_type");
             
-            for (int i = 0; i < MAX_PLAYERS; i++) {
-                if (game.players[i].connected) {
-                    sendJSON(game.players[i].sockfd, response);
+            if (username && cJSON_IsString(username)) {
+                const char* type_str = NULL;
+                if (player_type && cJSON_IsString(player_type)) {
+                    type_str = player_type->valuestring;
                 }
+                cJSON* protocol = cJSON_GetObjectItem(json, "protocol");
+                int binary = protocol && cJSON_IsString(protocol) &&
+                             strcmp(protocol->valuestring, WIRE_PROTOCOL_NAME) == 0;
+                handleRegister(clientfd, username->valuestring, type_str, binary);
+            }
+        } else if (strcmp(type->valuestring, "move") == 0) {
+            cJSON* username = cJSON_GetObjectItem(json, "username");
+            cJSON* sx = cJSON_GetObjectItem(json, "sx");
+            cJSON* sy = cJSON_GetObjectItem(json, "sy");
+            cJSON* tx = cJSON_GetObjectItem(json, "tx");
+            cJSON* ty = cJSON_GetObjectItem(json, "ty");
+            
+            if (username && cJSON_IsString(username) &&
+                sx && cJSON_IsNumber(sx) &&
+                sy && cJSON_IsNumber(sy) &&
+                tx && cJSON_IsNumber(tx) &&
+                ty && cJSON_IsNumber(ty)) {
+                handleMove(clientfd, username->valuestring,
+                         (int)sx->valuedouble, (int)sy->valuedouble,
+                         (int)tx->valuedouble, (int)ty->valuedouble);
             }
+        } else if (strcmp(type->valuestring, "spectate") == 0) {
+            cJSON* game_id = cJSON_GetObjectItem(json, "game_id");
+            cJSON* protocol = cJSON_GetObjectItem(json, "protocol");
+            int binary = protocol && cJSON_IsString(protocol) &&
+                         strcmp(protocol->valuestring, WIRE_PROTOCOL_NAME) == 0;
+            handleSpectate(clientfd, (game_id && cJSON_IsNumber(game_id)) ? (int)game_id->valuedouble : 0, binary);
         }
     }
-    
-    cJSON_Delete(response);
+    cJSON_Delete(json);
 }
 
-// Send pass message when timeout occurs
-void sendPassMessage(int player_idx) {
-    cJSON* message = cJSON_CreateObject();
-    if (!message) return;
-    
-    int next_player = 1 - player_idx;
-    
-    cJSON_AddStringToObject(message, "type", "pass");
-    cJSON_AddStringToObject(message, "next_player", game.players[next_player].username);
+// Handle one frame from a client that negotiated the binary protocol
+void handleClientFrame(int clientfd, const uint8_t* payload, size_t len) {
+    Connection* conn = connections[clientfd];
+    if (!conn || conn->watching) return;
+    
+    if (payload[0] == WIRE_MOVE && len == 3) {
+        int sx, sy, tx, ty;
+        wire_unpackMove(wire_getMove(payload + 1), &sx, &sy, &tx, &ty);
+        if (traceMessages) printf("[CLIENT %d->SERVER] move (%d,%d)->(%d,%d)\n", clientfd, sx, sy, tx, ty);
+        if (conn->game) logText(conn->game->log, "[CLIENT %d->SERVER] move (%d,%d)->(%d,%d)\n", clientfd, sx, sy, tx, ty);
+        handleMove(clientfd, conn->username, sx, sy, tx, ty);
+    } else if (payload[0] == WIRE_REGISTER && len >= 2) {
+        char username[256];
+        if (!wire_getString(payload + 2, len - 2, username, sizeof(username))) return;
+        if (traceMessages) printf("[CLIENT %d->SERVER] register %s\n", clientfd, username);
+        handleRegister(clientfd, username, (payload[1] & 1) ? "human" : "ai", 1);
+    } else if (payload[0] == WIRE_SPECTATE) {
+        uint64_t game_id = 0;
+        if (wire_getVarint(payload + 1, len - 1, &game_id) <= 0 || game_id > INT_MAX) return;
+        if (traceMessages) printf("[CLIENT %d->SERVER] spectate %d\n", clientfd, (int)game_id);
+        handleSpectate(clientfd, (int)game_id, 1);
+    } else {
+        if (traceMessages) printf("[CLIENT %d->SERVER] unknown frame type %d\n", clientfd, payload[0]);
+    }
+}
+
+// ===== MOVE TIMERS =====
+
+long long now_ms() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static void timer_place(GameState* g, int index) {
+    currentLoop->timers[index] = g;
+    g->timer_index = index;
+}
+
+static void timer_siftUp(int index) {
+    GameState** heap = currentLoop->timers;
+    GameState* g = heap[index];
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (heap[parent]->deadline_ms <= g->deadline_ms) break;
+        timer_place(heap[parent], index);
+        index = parent;
+    }
+    timer_place(g, index);
+}
+
+static void timer_siftDown(int index) {
+    GameState** heap = currentLoop->timers;
+    int count = currentLoop->timer_count;
+    GameState* g = heap[index];
+    while (1) {
+        int child = 2 * index + 1;
+        if (child >= count) break;
+        if (child + 1 < count && heap[child + 1]->deadline_ms < heap[child]->deadline_ms) child++;
+        if (g->deadline_ms <= heap[child]->deadline_ms) break;
+        timer_place(heap[child], index);
+        index = child;
+    }
+    timer_place(g, index);
+}
+
+// Set (or move) the game's deadline in the current loop's heap
+void timer_arm(GameState* g, long long deadline) {
+    if (g->timer_index >= 0) {
+        long long old = g->deadline_ms;
+        g->deadline_ms = deadline;
+        if (deadline < old) timer_siftUp(g->timer_index);
+        else timer_siftDown(g->timer_index);
+        return;
+    }
     
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].connected) {
-            sendJSON(game.players[i].sockfd, message);
+    if (currentLoop->timer_count == currentLoop->timer_capacity) {
+        int capacity = currentLoop->timer_capacity ? currentLoop->timer_capacity * 2 : 64;
+        GameState** grown = realloc(currentLoop->timers, capacity * sizeof(GameState*));
+        if (!grown) {
+            printf("Out of memory, game #%d has no move deadline\n", g->id);
+            return;
         }
+        currentLoop->timers = grown;
+        currentLoop->timer_capacity = capacity;
     }
     
-    cJSON_Delete(message);
+    g->deadline_ms = deadline;
+    timer_place(g, currentLoop->timer_count++);
+    timer_siftUp(g->timer_index);
 }
 
-// Send game over message
-void sendGameOver() {
-    cJSON* message = cJSON_CreateObject();
-    cJSON* scores = cJSON_CreateObject();
-    
-    if (!message || !scores) {
-        if (message) cJSON_Delete(message);
-        if (scores) cJSON_Delete(scores);
+void timer_cancel(GameState* g) {
+    int index = g->timer_index;
+    if (index < 0) return;
+    
+    g->timer_index = -1;
+    GameState* last = currentLoop->timers[--currentLoop->timer_count];
+    if (last != g) {
+        timer_place(last, index);
+        timer_siftUp(index);
+        timer_siftDown(last->timer_index);
+    }
+}
+
+// Arm timerfd for the earliest deadline; one syscall per batch at most
+void updateTimerfd() {
+    long long deadline = currentLoop->timer_count ? currentLoop->timers[0]->deadline_ms : 0;
+    if (deadline == currentLoop->timerfd_deadline) return;
+    
+    struct itimerspec spec;
+    memset(&spec, 0, sizeof(spec));
+    if (deadline) {
+        spec.it_value.tv_sec = deadline / 1000;
+        spec.it_value.tv_nsec = (deadline % 1000) * 1000000;
+    }
+    if (timerfd_settime(currentLoop->timerfd, TFD_TIMER_ABSTIME, &spec, NULL) == -1) {
+        perror("timerfd_settime error");
         return;
     }
-    
-    int red_count = countPieces(RED);
-    int blue_count = countPieces(BLUE);
-    
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        int player_score = (game.players[i].color == RED) ? red_count : blue_count;
-        cJSON_AddNumberToObject(scores, game.players[i].username, player_score);
+    currentLoop->timerfd_deadline = deadline;
+}
+
+// timerfd fired: time out every game whose deadline has passed
+void expireTimers() {
+    uint64_t expirations;
+    while (read(currentLoop->timerfd, &expirations, sizeof(expirations)) > 0) {}
+    currentLoop->timerfd_deadline = 0;
+    
+    long long now = now_ms();
+    while (currentLoop->timer_count && currentLoop->timers[0]->deadline_ms <= now) {
+        GameState* g = currentLoop->timers[0];
+        timer_cancel(g);
+        g->deadline_ms = 0;
+        handleTimeout(g);
+        closePendingConnections();
     }
-    
-    cJSON_AddStringToObject(message, "type", "game_over");
-    cJSON_AddItemToObject(message, "scores", scores);
-    
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].connected) {
-            sendJSON(game.players[i].sockfd, message);
-        }
+}
+
+// ===== EVENT LOOPS =====
+
+void handoff_init(HandoffQueue* q) {
+    atomic_store_explicit(&q->stub.next, NULL, memory_order_relaxed);
+    atomic_store_explicit(&q->head, &q->stub, memory_order_relaxed);
+    q->tail = &q->stub;
+}
+
+// Any thread
+void handoff_push(HandoffQueue* q, HandoffNode* node) {
+    atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+    HandoffNode* prev = atomic_exchange_explicit(&q->head, node, memory_order_acq_rel);
+    atomic_store_explicit(&prev->next, node, memory_order_release);
+}
+
+// Owning thread only. Returns NULL when empty, or when a push is halfway
+// done; its wakeup then arrives after the push completes.
+HandoffNode* handoff_pop(HandoffQueue* q) {
+    HandoffNode* tail = q->tail;
+    HandoffNode* next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    
+    if (tail == &q->stub) {
+        if (!next) return NULL;
+        q->tail = next;
+        tail = next;
+        next = atomic_load_explicit(&tail->next, memory_order_acquire);
     }
-    
-    printf("\n=== GAME OVER ===\n");
-    printf("Red: %d, Blue: %d\n", red_count, blue_count);
-    printf("Total moves: %d\n", game.moves_count);
-    
-    logBoardState("Game Over - Final Board");
-    if (logFile) {
-        fprintf(logFile, "\nFinal Score: Red=%d, Blue=%d\n", red_count, blue_count);
-        fprintf(logFile, "Total moves: %d\n", game.moves_count);
+    if (next) {
+        q->tail = next;
+        return tail;
+    }
+    if (tail != atomic_load_explicit(&q->head, memory_order_acquire)) {
+        return NULL;
     }
     
-    cJSON_Delete(message);
-    
-    game.game_started = 0;
-    game.game_over = 1;
+    handoff_push(q, &q->stub);
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if (next) {
+        q->tail = next;
+        return tail;
+    }
+    return NULL;
+}
 
-    fflush(logFile);  // 버퍼 강제 플러시
-    usleep(100000);   // 0.1초 대기
+void wakeLoop(EventLoop* loop) {
+    uint64_t one = 1;
+    if (write(loop->wakefd, &one, sizeof(one)) == -1 && errno != EAGAIN) {
+        perror("eventfd write error");
+    }
+}
 
+int initEventLoop(EventLoop* loop, int id) {
+    memset(loop, 0, sizeof(*loop));
+    loop->id = id;
+    handoff_init(&loop->inbox);
+    
+    loop->epollfd = epoll_create1(0);
+    loop->wakefd = eventfd(0, EFD_NONBLOCK);
+    loop->timerfd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    if (loop->epollfd == -1 || loop->wakefd == -1 || loop->timerfd == -1) {
+        perror("event loop error");
+        return -1;
+    }
+    
+    int fds[2] = {loop->wakefd, loop->timerfd};
+    for (int i = 0; i < 2; i++) {
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = fds[i];
+        if (epoll_ctl(loop->epollfd, EPOLL_CTL_ADD, fds[i], &ev) == -1) {
+            perror("epoll_ctl error");
+            return -1;
+        }
+    }
+    return 0;
 }
 
-// Handle client disconnect
-void handleClientDisconnect(int clientfd) {
-    for (int i = 0; i < MAX_PLAYERS; i++) {
-        if (game.players[i].sockfd == clientfd) {
-            game.players[i].connected = 0;
-            printf("Player %s disconnected\n", game.players[i].username);
+// End of a batch of events: pass matched games and new spectators to their
+// workers (main thread) and finished players and spectators back to the
+// lobby side (workers). The fds leave this epoll before the other thread
+// adds them to its own.
+void handOff() {
+    if (currentLoop == &acceptorLoop) {
+        while (currentLoop->activeGames) {
+            GameState* g = currentLoop->activeGames;
+            currentLoop->activeGames = g->next;
+            if (g->next) g->next->prev = NULL;
+            g->next = NULL;
+            timer_cancel(g);  // deadline_ms stays; the worker re-arms it
             
-            if (logFile) {
-                fprintf(logFile, "Player %s disconnected\n", game.players[i].username);
-                fflush(logFile);
+            for (int i = 0; i < MAX_PLAYERS; i++) {
+                if (g->players[i].connected) {
+                    epoll_ctl(currentLoop->epollfd, EPOLL_CTL_DEL, g->players[i].sockfd, NULL);
+                }
             }
             
-            // Check if both disconnected
-            int connected_count = 0;
-            for (int j = 0; j < MAX_PLAYERS; j++) {
-                if (game.players[j].connected) connected_count++;
-            }
+            EventLoop* worker = &workers[g->id % workerCount];
+            handoff_push(&worker->inbox, &g->handoff_node);
+            wakeLoop(worker);
+        }
+        
+        // Spectators follow, so a game matched in this batch is there first
+        while (currentLoop->handoffConnections) {
+            Connection* conn = currentLoop->handoffConnections;
+            currentLoop->handoffConnections = conn->next_handoff;
+            
+            epoll_ctl(currentLoop->epollfd, EPOLL_CTL_DEL, conn->fd, NULL);
+            EventLoop* worker = &workers[conn->watch_id % workerCount];
+            handoff_push(&worker->inbox, &conn->handoff_node);
+            wakeLoop(worker);
+        }
+    } else if (currentLoop->handoffConnections) {
+        while (currentLoop->handoffConnections) {
+            Connection* conn = currentLoop->handoffConnections;
+            currentLoop->handoffConnections = conn->next_handoff;
+            
+            epoll_ctl(currentLoop->epollfd, EPOLL_CTL_DEL, conn->fd, NULL);
+            handoff_push(&acceptorLoop.inbox, &conn->handoff_node);
+        }
+        wakeLoop(&acceptorLoop);
+    }
+}
+
+// Take a connection over from another loop and handle input it left behind
+void adoptConnection(Connection* conn) {
+    conn->handoff = 0;
+    if (watchConnection(conn) == -1) {
+        scheduleClose(conn);
+        return;
+    }
+    processInput(conn);
+}
+
+// Drain the inbox after a wakeup
+void receiveHandoffs() {
+    uint64_t count;
+    while (read(currentLoop->wakefd, &count, sizeof(count)) > 0) {}
+    
+    HandoffNode* node;
+    while ((node = handoff_pop(&currentLoop->inbox)) != NULL) {
+        if (node->kind == HANDOFF_CONNECTION && currentLoop == &acceptorLoop) {
+            adoptConnection(HANDOFF_ENTRY(node, Connection, handoff_node));
+        } else if (node->kind == HANDOFF_CONNECTION) {
+            startSpectating(HANDOFF_ENTRY(node, Connection, handoff_node));
+        } else {
+            GameState* g = HANDOFF_ENTRY(node, GameState, handoff_node);
+            g->prev = NULL;
+            g->next = currentLoop->activeGames;
+            if (currentLoop->activeGames) currentLoop->activeGames->prev = g;
+            currentLoop->activeGames = g;
+            if (g->deadline_ms) timer_arm(g, g->deadline_ms);
             
-            if (connected_count == 0 && game.game_started) {
-                printf("Both players disconnected. Game terminated.\n");
-                sendGameOver();
-            } else if (game.game_started && i == game.current_player) {
-                // Pass turn to other player
-                game.pass_count++;
-                game.current_player = 1 - i;
-                if (game.players[game.current_player].connected) {
-                    sendPassMessage(i);
-                    sendYourTurn(game.current_player);
+            for (int i = 0; i < MAX_PLAYERS; i++) {
+                if (g->players[i].connected) {
+                    adoptConnection(connections[g->players[i].sockfd]);
                 }
             }
-            break;
         }
+        closePendingConnections();
     }
 }
 
-// Print board
-void printBoard() {
-    printf("\nCurrent Board:\n");
-    printf("  1 2 3 4 5 6 7 8\n");
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        printf("%d ", i + 1);
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            printf("%c ", game.board[i][j]);
+// Run one thread's loop forever; listenfd is -1 on workers
+void runEventLoop(int listenfd) {
+    struct epoll_event events[MAX_EVENTS];
+    
+    while (!atomic_load(&stopRequested)) {
+        updateTimerfd();
+        int nready = epoll_wait(currentLoop->epollfd, events, MAX_EVENTS, -1);
+        
+        if (nready == -1) {
+            if (errno != EINTR) perror("epoll_wait error");
+            nready = 0;
         }
-        printf("\n");
+        
+        for (int e = 0; e < nready; e++) {
+            int fd = events[e].data.fd;
+            
+            if (fd == listenfd) {
+                acceptConnections(listenfd);
+                continue;
+            }
+            if (fd == currentLoop->wakefd) {
+                receiveHandoffs();
+                continue;
+            }
+            if (fd == currentLoop->timerfd) {
+                expireTimers();
+                continue;
+            }
+            
+            // Skip events that arrived for a connection this loop has given away
+            Connection* conn = connections[fd];
+            if (!conn || conn->closing || conn->handoff) continue;
+            
+            if (events[e].events & EPOLLOUT) {
+                flushOutput(conn);
+                if (conn->read_paused && conn->out_len <= OUTPUT_HIGH_WATER) {
+                    conn->read_paused = 0;
+                    readInput(conn);
+                }
+            }
+            if ((events[e].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) && !conn->read_paused) {
+                readInput(conn);
+            }
+            if (events[e].events & EPOLLERR) {
+                scheduleClose(conn);
+            }
+            
+            closePendingConnections();
+        }
+        
+        handOff();
     }
-    printf("Red: %d, Blue: %d, Empty: %d\n", 
-           countPieces(RED), countPieces(BLUE), countPieces(EMPTY));
-    printf("\n");
+}
+
+void* workerMain(void* arg) {
+    currentLoop = (EventLoop*)arg;
+    runEventLoop(-1);
+    return NULL;
+}
+
+void requestStop(int sig) {
+    (void)sig;
+    atomic_store(&stopRequested, 1);
+    wakeLoop(&acceptorLoop);
 }
 
 int main(int argc, char *argv[]) {
-    // Suppress unused parameter warnings
-    (void)argc;
-    (void)argv;
-    
     struct addrinfo hints, *res;
-    int sockfd, clientfd, status;
-    char buffer[BUFFER_SIZE];
-    struct timeval timeout;
-    fd_set read_fds, master_fds;
-    int maxfd;
-    
-    // Initialize game state
-    memset(&game, 0, sizeof(game));
-    initializeBoard();
-    initializeLog();
+    int sockfd, status;
+    char server_port[32];
+    
+    strcpy(server_port, DEFAULT_PORT);
+    workerCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    
+    // Parse arguments
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-port") == 0 && i + 1 < argc) {
+            snprintf(server_port, sizeof(server_port), "%s", argv[++i]);
+        } else if (strcmp(argv[i], "-match") == 0 && i + 1 < argc) {
+            const char* mode = argv[++i];
+            if (strcmp(mode, "rating") == 0) {
+                matchMode = MATCH_RATING;
+            } else if (strcmp(mode, "fifo") == 0) {
+                matchMode = MATCH_FIFO;
+            } else {
+                fprintf(stderr, "Unknown matchmaking mode: %s (use fifo or rating)\n", mode);
+                exit(1);
+            }
+        } else if (strcmp(argv[i], "-workers") == 0 && i + 1 < argc) {
+            workerCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-log-flush") == 0 && i + 1 < argc) {
+            logFlushMs = atoi(argv[++i]);
+            if (logFlushMs < 0) logFlushMs = 0;
+        } else if (strcmp(argv[i], "-event-log") == 0 && i + 1 < argc) {
+            eventLogPath = argv[++i];
+        } else if (strcmp(argv[i], "-archive") == 0 && i + 1 < argc) {
+            archivePath = argv[++i];
+        } else if (strcmp(argv[i], "-arena") == 0 && i + 1 < argc) {
+            arenaGames = atoi(argv[++i]);
+            if (arenaGames < 0) arenaGames = 0;
+        } else if (strcmp(argv[i], "-swap-colors") == 0) {
+            arenaSwapColors = 1;
+        } else if (strcmp(argv[i], "-trace") == 0) {
+            traceMessages = 1;
+        }
+    }
+    if (workerCount < 1) workerCount = 1;
+    if (workerCount > MAX_WORKERS) workerCount = MAX_WORKERS;
     
     // Set up socket
     memset(&hints, 0, sizeof hints);
@@ -750,7 +2952,7 @@ int main(int argc, char *argv[]) {
     hints.ai_socktype = SOCK_STREAM;
     hints.ai_flags = AI_PASSIVE;
     
-    status = getaddrinfo(NULL, "8080", &hints, &res);
+    status = getaddrinfo(NULL, server_port, &hints, &res);
     if (status != 0) {
         fprintf(stderr, "getaddrinfo error: %s\n", gai_strerror(status));
         exit(1);
@@ -771,183 +2973,63 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
     
-    status = listen(sockfd, 5);
+    status = listen(sockfd, SOMAXCONN);
     if (status == -1) {
         perror("listen error");
         exit(1);
     }
     
-    printf("=== OctaFlip Server ===\n");
-    printf("Listening on port 8080...\n");
-    printBoard();
+    currentLoop = &acceptorLoop;
+    if (initEventLoop(&acceptorLoop, 0) == -1 || startLogger() == -1) {
+        exit(1);
+    }
+    signal(SIGINT, requestStop);
+    signal(SIGTERM, requestStop);
+    
+    setNonBlocking(sockfd);
+    struct epoll_event listen_ev;
+    memset(&listen_ev, 0, sizeof(listen_ev));
+    listen_ev.events = EPOLLIN | EPOLLET;
+    listen_ev.data.fd = sockfd;
+    if (epoll_ctl(acceptorLoop.epollfd, EPOLL_CTL_ADD, sockfd, &listen_ev) == -1) {
+        perror("epoll_ctl error");
+        exit(1);
+    }
     
-    FD_ZERO(&master_fds);
-    FD_SET(sockfd, &master_fds);
-    maxfd = sockfd;
+    for (int i = 0; i < workerCount; i++) {
+        if (initEventLoop(&workers[i], i + 1) == -1 ||
+            pthread_create(&workers[i].thread, NULL, workerMain, &workers[i]) != 0) {
+            fprintf(stderr, "Cannot start worker %d\n", i + 1);
+            exit(1);
+        }
+    }
     
-    char recv_buffer[BUFFER_SIZE * 2];  // Larger buffer for partial messages
-    int recv_len[FD_SETSIZE] = {0};    // Track received data per socket
+    printf("=== OctaFlip Server ===\n");
+    printf("Listening on port %s...\n", server_port);
+    printf("Matchmaking: %s\n", matchMode == MATCH_RATING ? "Rating" : "FIFO");
+    printf("Game workers: %d\n", workerCount);
+    printf("Log flush: every %d ms\n", logFlushMs);
+    printf("Event log: %s\n", eventLogPath ? eventLogPath : "off");
+    printf("Game archive: %s\n", archivePath ? archivePath : "off");
+    if (arenaGames > 0) {
+        printf("Arena: %d games%s\n", arenaGames, arenaSwapColors ? ", swapping colors" : "");
+    } else {
+        printf("Arena: off\n");
+    }
     
-    // Main server loop
-    while (1) {
-        read_fds = master_fds;
-        
-        timeout.tv_sec = 1;
-        timeout.tv_usec = 0;
-        
-        status = select(maxfd + 1, &read_fds, NULL, NULL, &timeout);
-        
-        if (status == -1) {
-            perror("select error");
-            continue;
-        }
-        
-        // Check for timeout
-        if (game.game_started && !game.game_over) {
-            time_t current_time = time(NULL);
-            
-            // Only check timeout for AI players
-            if (!game.players[game.current_player].is_human && 
-                current_time - game.last_move_time >= TIMEOUT_SECONDS) {
-                printf("Timeout for player %s\n", game.players[game.current_player].username);
-                
-                logMove(game.players[game.current_player].username, 0, 0, 0, 0, "Timeout - forced pass");
-                
-                game.pass_count++;
-                sendPassMessage(game.current_player);
-                game.current_player = 1 - game.current_player;
-                game.last_move_time = current_time;
-                
-                if (isGameOver()) {
-                    sendGameOver();
-                } else {
-                    sendYourTurn(game.current_player);
-                }
-            }
-        }
-        
-        // Check all sockets
-        for (int i = 0; i <= maxfd; i++) {
-            if (FD_ISSET(i, &read_fds)) {
-                if (i == sockfd) {
-                    // New connection
-                    clientfd = accept(sockfd, NULL, NULL);
-                    if (clientfd == -1) {
-                        perror("accept error");
-                        continue;
-                    }
-                    
-                    printf("New connection (fd=%d)\n", clientfd);
-                    
-                    FD_SET(clientfd, &master_fds);
-                    if (clientfd > maxfd) maxfd = clientfd;
-                    recv_len[clientfd] = 0;
-                    
-                } else {
-                    // Data from client
-                    memset(buffer, 0, BUFFER_SIZE);
-                    int bytes_received = recv(i, buffer, BUFFER_SIZE - 1, 0);
-                    
-                    if (bytes_received <= 0) {
-                        close(i);
-                        FD_CLR(i, &master_fds);
-                        handleClientDisconnect(i);
-                        recv_len[i] = 0;
-                    } else {
-                        // Append to existing buffer
-                        if (recv_len[i] + bytes_received < BUFFER_SIZE * 2) {
-                            memcpy(recv_buffer + recv_len[i], buffer, bytes_received);
-                            recv_len[i] += bytes_received;
-                            recv_buffer[recv_len[i]] = '\0';
-                            
-                            // Process complete messages
-                            char* start = recv_buffer;
-                            char* newline = NULL;
-                            
-                            while ((newline = strchr(start, '\n')) != NULL) {
-                                *newline = '\0';
-                                
-                                printf("[CLIENT %d->SERVER] %s\n", i, start);
-                                if (logFile) {
-                                    fprintf(logFile, "[CLIENT %d->SERVER] %s\n", i, start);
-                                    fflush(logFile);
-                                }
-                                
-                                // Parse JSON
-                                cJSON* json = cJSON_Parse(start);
-                                if (json) {
-                                    cJSON* type = cJSON_GetObjectItem(json, "type");
-                                    if (type && cJSON_IsString(type)) {
-                                        if (strcmp(type->valuestring, "register") == 0) {
-                                            cJSON* username = cJSON_GetObjectItem(json, "username");
-                                            cJSON* player_type = cJSON_GetObjectItem(json, "player_type");
-                                            
-                                            if (username && cJSON_IsString(username)) {
-                                                const char* type_str = NULL;
-                                                if (player_type && cJSON_IsString(player_type)) {
-                                                    type_str = player_type->valuestring;
-                                                }
-                                                handleRegister(i, username->valuestring, type_str);
-                                            }
-                                        } else if (strcmp(type->valuestring, "move") == 0) {
-                                            cJSON* username = cJSON_GetObjectItem(json, "username");
-                                            cJSON* sx = cJSON_GetObjectItem(json, "sx");
-                                            cJSON* sy = cJSON_GetObjectItem(json, "sy");
-                                            cJSON* tx = cJSON_GetObjectItem(json, "tx");
-                                            cJSON* ty = cJSON_GetObjectItem(json, "ty");
-                                            
-                                            if (username && cJSON_IsString(username) &&
-                                                sx && cJSON_IsNumber(sx) &&
-                                                sy && cJSON_IsNumber(sy) &&
-                                                tx && cJSON_IsNumber(tx) &&
-                                                ty && cJSON_IsNumber(ty)) {
-                                                handleMove(i, username->valuestring,
-                                                         (int)sx->valuedouble, (int)sy->valuedouble,
-                                                         (int)tx->valuedouble, (int)ty->valuedouble);
-                                            }
-                                        }
-                                    }
-                                    cJSON_Delete(json);
-                                }
-                                
-                                start = newline + 1;
-                            }
-                            
-                            // Move remaining data to beginning
-                            int remaining = recv_len[i] - (start - recv_buffer);
-                            if (remaining > 0) {
-                                memmove(recv_buffer, start, remaining);
-                            }
-                            recv_len[i] = remaining;
-                        }
-                    }
-                }
-            }
-        }
-        
-        // Exit if game is over and no players connected
-        if (game.game_over) {
-            int connected = 0;
-            for (int i = 0; i < MAX_PLAYERS; i++) {
-                if (game.players[i].connected) connected++;
-            }
-            if (connected == 0) {
-                printf("Game ended and all players disconnected. Shutting down server.\n");
-                
-                // 로그 파일 안전하게 닫기
-                if (logFile) {
-                    fprintf(logFile, "\nGame completed successfully\n");
-                    fflush(logFile);
-                    closeLog();
-                }
-                usleep(500000);  // 0.5초 대기
-                break;
-            }
-        }
+    // Main thread: accept, register and match; games run on the workers until stopped
+    runEventLoop(sockfd);
+    
+    // Let the workers finish their current batch, so a game that just ended
+    // has committed all of its log events before the logger drains them
+    for (int i = 0; i < workerCount; i++) {
+        wakeLoop(&workers[i]);
+        pthread_join(workers[i].thread, NULL);
     }
     
-    // Clean up
-    closeLog();
+    printf("Shutting down, writing out logs...\n");
+    stopLogger();
+    
     freeaddrinfo(res);
     close(sockfd);
     
@@ -0,0 +1,93 @@
+// symmetry.h - The 8 symmetries of the OctaFlip board on bitboards
+// Shared by the client's hash tables and opening book; train_octoflip.py
+// computes the same keys for the book and its training data
+#ifndef SYMMETRY_H
+#define SYMMETRY_H
+
+#include <stdint.h>
+
+// Symmetry t (0..7), on bitboards with bit r * 8 + c for square (r, c):
+// bit 2 transposes (r, c) -> (c, r), then bit 0 flips the rows and bit 1
+// the columns. t = 0 is the identity.
+#define SYMMETRIES 8
+
+static inline uint64_t sym_flipRows(uint64_t b) {
+    return __builtin_bswap64(b);
+}
+
+static inline uint64_t sym_flipColumns(uint64_t b) {
+    b = ((b >> 1) & 0x5555555555555555ULL) | ((b & 0x5555555555555555ULL) << 1);
+    b = ((b >> 2) & 0x3333333333333333ULL) | ((b & 0x3333333333333333ULL) << 2);
+    b = ((b >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((b & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return b;
+}
+
+static inline uint64_t sym_transpose(uint64_t b) {
+    uint64_t t;
+    t = 0x0F0F0F0F00000000ULL & (b ^ (b << 28));
+    b ^= t ^ (t >> 28);
+    t = 0x3333000033330000ULL & (b ^ (b << 14));
+    b ^= t ^ (t >> 14);
+    t = 0x5500550055005500ULL & (b ^ (b << 7));
+    b ^= t ^ (t >> 7);
+    return b;
+}
+
+static inline uint64_t sym_apply(int t, uint64_t b) {
+    if (t & 4) b = sym_transpose(b);
+    if (t & 1) b = sym_flipRows(b);
+    if (t & 2) b = sym_flipColumns(b);
+    return b;
+}
+
+// Square sq (r * 8 + c) under symmetry t
+static inline int sym_square(int t, int sq) {
+    int r = sq >> 3, c = sq & 7;
+    if (t & 4) { int tmp = r; r = c; c = tmp; }
+    if (t & 1) r = 7 - r;
+    if (t & 2) c = 7 - c;
+    return r * 8 + c;
+}
+
+// Symmetry that undoes t: with a transpose the two flips trade places
+static inline int sym_inverse(int t) {
+    return (t & 4) ? (4 | (t & 1) << 1 | (t & 2) >> 1) : t;
+}
+
+static inline uint64_t sym_mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// 64-bit key of a board (red, blue and blocked squares), not symmetric
+static inline uint64_t sym_key(uint64_t red, uint64_t blue, uint64_t blocked) {
+    return sym_mix(red ^ sym_mix(blue ^ sym_mix(blocked)));
+}
+
+// Smallest key over the 8 images of the board, and the symmetry that maps
+// the board onto that image (squares and moves go through sym_square)
+static inline uint64_t sym_canonicalKey(uint64_t red, uint64_t blue, uint64_t blocked, int* symmetry) {
+    uint64_t images[2][3] = {
+        {red, blue, blocked},
+        {sym_transpose(red), sym_transpose(blue), sym_transpose(blocked)}
+    };
+    uint64_t best = 0;
+    for (int t = 0; t < SYMMETRIES; t++) {
+        const uint64_t* image = images[t >> 2];
+        uint64_t b[3];
+        for (int i = 0; i < 3; i++) {
+            b[i] = image[i];
+            if (t & 1) b[i] = sym_flipRows(b[i]);
+            if (t & 2) b[i] = sym_flipColumns(b[i]);
+        }
+        uint64_t key = sym_key(b[0], b[1], b[2]);
+        if (t == 0 || key < best) {
+            best = key;
+            *symmetry = t;
+        }
+    }
+    return best;
+}
+
+#endif // SYMMETRY_H
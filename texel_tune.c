@@ -0,0 +1,380 @@
+// texel_tune.c - Tune the classical OctaFlip evaluation weights
+// Team Shannon - Assignment 3
+//
+// Usage: ./texel_tune [-o eval_weights.h] [-epochs N] [-threads N] octaflip_game_*.log
+//
+// Texel's method: every board the server logged is labelled with the game's
+// result for red (1, 0.5 or 0) and the weights are fitted so that
+// sigmoid(K * eval) predicts it, K being fixed first for the starting
+// weights. The classical eval (without pattern tables) is linear in its
+// weights, so each position is reduced once to the vector of terms each
+// weight multiplies, using the helpers the client evaluates with.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include "eval_terms.h"
+#include "game_log.h"
+
+#define BOARD_SIZE 8
+#define MAX_MOVES 200          // Move list size of the client (caps mobility)
+#define MAX_THREADS 16
+#define LEARNING_RATE 0.5
+#define ADAM_BETA1 0.9
+#define ADAM_BETA2 0.999
+
+// Weight layout. Position tables keep the board's 8-fold symmetry, so each
+// table has one weight per square class.
+#define SQUARE_CLASSES 10
+#define W_PIECE 0                                   // TAPER_PIECE_VALUE[4]
+#define W_TABLE (W_PIECE + 4)                       // [PST_TABLES][SQUARE_CLASSES]
+#define W_CORNER (W_TABLE + PST_TABLES * SQUARE_CLASSES)
+#define W_X_SQUARE (W_CORNER + 1)
+#define W_MOBILITY (W_CORNER + 2)
+#define W_CONNECTIVITY (W_CORNER + 3)
+#define W_EDGE (W_CORNER + 4)
+#define WEIGHT_COUNT (W_CORNER + 5)
+
+typedef struct {
+    float terms[WEIGHT_COUNT];
+    float result;  // For red: 1 win, 0.5 draw, 0 loss
+} Position;
+
+static Position* positions = NULL;
+static size_t positionCount = 0;
+static size_t positionCapacity = 0;
+
+static double weights[WEIGHT_COUNT];
+static double scaleK = 0.0;
+
+static int squareClass(int sq) {
+    int r = sq / BOARD_SIZE, c = sq % BOARD_SIZE;
+    int a = r < BOARD_SIZE - 1 - r ? r : BOARD_SIZE - 1 - r;
+    int b = c < BOARD_SIZE - 1 - c ? c : BOARD_SIZE - 1 - c;
+    if (a > b) {
+        int tmp = a;
+        a = b;
+        b = tmp;
+    }
+    return a * 4 - a * (a - 1) / 2 + (b - a);
+}
+
+// Terms of evaluateTapered from red's point of view, one per weight
+static void extractTerms(Bitboard red, Bitboard blue, Bitboard empty, float* terms) {
+    int redCount = __builtin_popcountll(red);
+    int blueCount = __builtin_popcountll(blue);
+    int k;
+    double t;
+    taperSegment(redCount + blueCount, __builtin_popcountll(empty), &k, &t);
+    
+    memset(terms, 0, WEIGHT_COUNT * sizeof(float));
+    terms[W_PIECE + k] += (redCount - blueCount) * (1.0 - t);
+    terms[W_PIECE + k + 1] += (redCount - blueCount) * t;
+    
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        int owner = (red >> sq & 1) ? 1 : ((blue >> sq & 1) ? -1 : 0);
+        if (!owner) continue;
+        terms[W_TABLE + TAPER_TABLE[k] * SQUARE_CLASSES + squareClass(sq)] += owner * (1.0 - t);
+        terms[W_TABLE + TAPER_TABLE[k + 1] * SQUARE_CLASSES + squareClass(sq)] += owner * t;
+    }
+    
+    terms[W_CORNER] = __builtin_popcountll(red & BB_CORNERS) - __builtin_popcountll(blue & BB_CORNERS);
+    terms[W_X_SQUARE] = -(bb_xSquares(red) - bb_xSquares(blue));
+    terms[W_MOBILITY] = bb_moveCount(red, empty, MAX_MOVES) - bb_moveCount(blue, empty, MAX_MOVES);
+    terms[W_CONNECTIVITY] = bb_connectivity(red);
+    terms[W_EDGE] = __builtin_popcountll(red & BB_EDGES);
+}
+
+// The client's evaluateTapered without pattern tables, with the weights in
+// eval_weights.h; checks that extractTerms still matches it
+static double referenceEval(Bitboard red, Bitboard blue, Bitboard empty) {
+    int redCount = __builtin_popcountll(red);
+    int blueCount = __builtin_popcountll(blue);
+    double pieceValue, tableWeight[PST_TABLES];
+    taperWeights(redCount + blueCount, __builtin_popcountll(empty), &pieceValue, tableWeight);
+    
+    double score = (redCount - blueCount) * pieceValue;
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        int owner = (red >> sq & 1) ? 1 : ((blue >> sq & 1) ? -1 : 0);
+        for (int t = 0; t < PST_TABLES; t++) {
+            score += owner * tableWeight[t] * POSITION_TABLES[t][sq / BOARD_SIZE][sq % BOARD_SIZE];
+        }
+    }
+    score += (__builtin_popcountll(red & BB_CORNERS) - __builtin_popcountll(blue & BB_CORNERS)) * CORNER_BONUS;
+    score -= (bb_xSquares(red) - bb_xSquares(blue)) * X_SQUARE_PENALTY;
+    score += (bb_moveCount(red, empty, MAX_MOVES) - bb_moveCount(blue, empty, MAX_MOVES)) * MOBILITY_WEIGHT;
+    score += bb_connectivity(red) * CONNECTIVITY_WEIGHT;
+    score += __builtin_popcountll(red & BB_EDGES) * EDGE_WEIGHT;
+    return score;
+}
+
+static double linearEval(const Position* pos) {
+    double score = 0.0;
+    for (int w = 0; w < WEIGHT_COUNT; w++) {
+        score += weights[w] * pos->terms[w];
+    }
+    return score;
+}
+
+static void initWeights() {
+    int classSize[SQUARE_CLASSES] = {0};
+    for (int w = 0; w < WEIGHT_COUNT; w++) {
+        weights[w] = 0.0;
+    }
+    for (int i = 0; i < 4; i++) {
+        weights[W_PIECE + i] = TAPER_PIECE_VALUE[i];
+    }
+    
+    // Average each square class, in case a table was edited asymmetrically
+    for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+        classSize[squareClass(sq)]++;
+        for (int t = 0; t < PST_TABLES; t++) {
+            weights[W_TABLE + t * SQUARE_CLASSES + squareClass(sq)] +=
+                POSITION_TABLES[t][sq / BOARD_SIZE][sq % BOARD_SIZE];
+        }
+    }
+    for (int t = 0; t < PST_TABLES; t++) {
+        for (int c = 0; c < SQUARE_CLASSES; c++) {
+            weights[W_TABLE + t * SQUARE_CLASSES + c] /= classSize[c];
+        }
+    }
+    
+    weights[W_CORNER] = CORNER_BONUS;
+    weights[W_X_SQUARE] = X_SQUARE_PENALTY;
+    weights[W_MOBILITY] = MOBILITY_WEIGHT;
+    weights[W_CONNECTIVITY] = CONNECTIVITY_WEIGHT;
+    weights[W_EDGE] = EDGE_WEIGHT;
+}
+
+static int matchingCount = 0;  // Positions where the starting weights reproduce referenceEval
+
+static void addGame(const GameLogGame* game, void* ctx) {
+    (void)ctx;
+    float result = game->red > game->blue ? 1.0f : (game->red < game->blue ? 0.0f : 0.5f);
+    
+    for (int i = 0; i < game->boardCount; i++) {
+        Bitboard red = 0, blue = 0, empty = 0;
+        for (int sq = 0; sq < BOARD_SIZE * BOARD_SIZE; sq++) {
+            char piece = game->boards[i][sq / BOARD_SIZE][sq % BOARD_SIZE];
+            if (piece == 'R') red |= 1ULL << sq;
+            else if (piece == 'B') blue |= 1ULL << sq;
+            else if (piece == '.') empty |= 1ULL << sq;
+        }
+        if (!red || !blue) continue;  // Decided: the eval returns INF_SCORE
+        
+        if (positionCount == positionCapacity) {
+            positionCapacity = positionCapacity ? positionCapacity * 2 : 4096;
+            positions = realloc(positions, positionCapacity * sizeof(Position));
+            if (!positions) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+        Position* pos = &positions[positionCount++];
+        extractTerms(red, blue, empty, pos->terms);
+        pos->result = result;
+        
+        if (fabs(linearEval(pos) - referenceEval(red, blue, empty)) < 1e-3) {
+            matchingCount++;
+        }
+    }
+}
+
+static inline double sigmoid(double x) {
+    return 1.0 / (1.0 + exp(-x));
+}
+
+typedef struct {
+    size_t begin, end;
+    double loss;
+    double gradient[WEIGHT_COUNT];
+} TuneSlice;
+
+// Squared error and its gradient over one slice of the positions
+static void* tuneWorker(void* arg) {
+    TuneSlice* slice = (TuneSlice*)arg;
+    slice->loss = 0.0;
+    memset(slice->gradient, 0, sizeof(slice->gradient));
+    
+    for (size_t p = slice->begin; p < slice->end; p++) {
+        const Position* pos = &positions[p];
+        double s = sigmoid(scaleK * linearEval(pos));
+        double error = pos->result - s;
+        slice->loss += error * error;
+        
+        double d = -2.0 * error * s * (1.0 - s) * scaleK;
+        for (int w = 0; w < WEIGHT_COUNT; w++) {
+            slice->gradient[w] += d * pos->terms[w];
+        }
+    }
+    return NULL;
+}
+
+// Mean squared error over all positions; fills gradient if not NULL
+static double evaluateLoss(int threads, double* gradient) {
+    pthread_t tids[MAX_THREADS];
+    static TuneSlice slices[MAX_THREADS];
+    
+    for (int i = 0; i < threads; i++) {
+        slices[i].begin = positionCount * i / threads;
+        slices[i].end = positionCount * (i + 1) / threads;
+        pthread_create(&tids[i], NULL, tuneWorker, &slices[i]);
+    }
+    
+    double loss = 0.0;
+    if (gradient) memset(gradient, 0, WEIGHT_COUNT * sizeof(double));
+    for (int i = 0; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+        loss += slices[i].loss;
+        for (int w = 0; w < WEIGHT_COUNT && gradient; w++) {
+            gradient[w] += slices[i].gradient[w] / positionCount;
+        }
+    }
+    return loss / positionCount;
+}
+
+// K minimizing the loss of the starting weights (golden section on log K)
+static void fitScale(int threads) {
+    double lo = log(1e-5), hi = log(1e-1);
+    const double ratio = (sqrt(5.0) - 1.0) / 2.0;
+    
+    for (int i = 0; i < 40; i++) {
+        double a = hi - ratio * (hi - lo);
+        double b = lo + ratio * (hi - lo);
+        scaleK = exp(a);
+        double lossA = evaluateLoss(threads, NULL);
+        scaleK = exp(b);
+        double lossB = evaluateLoss(threads, NULL);
+        if (lossA < lossB) hi = b;
+        else lo = a;
+    }
+    scaleK = exp((lo + hi) / 2.0);
+}
+
+// Adam on the full gradient
+static double tune(int threads, int epochs) {
+    double gradient[WEIGHT_COUNT], m[WEIGHT_COUNT] = {0}, v[WEIGHT_COUNT] = {0};
+    double loss = 0.0;
+    
+    for (int epoch = 1; epoch <= epochs; epoch++) {
+        loss = evaluateLoss(threads, gradient);
+        for (int w = 0; w < WEIGHT_COUNT; w++) {
+            m[w] = ADAM_BETA1 * m[w] + (1.0 - ADAM_BETA1) * gradient[w];
+            v[w] = ADAM_BETA2 * v[w] + (1.0 - ADAM_BETA2) * gradient[w] * gradient[w];
+            double mHat = m[w] / (1.0 - pow(ADAM_BETA1, epoch));
+            double vHat = v[w] / (1.0 - pow(ADAM_BETA2, epoch));
+            weights[w] -= LEARNING_RATE * mHat / (sqrt(vHat) + 1e-12);
+        }
+        
+        if (epoch == 1 || epoch % 100 == 0 || epoch == epochs) {
+            printf("epoch %5d: mse %.6f\n", epoch, loss);
+        }
+    }
+    return evaluateLoss(threads, NULL);
+}
+
+static void writeTable(FILE* file, const char* comment, const char* name, int t) {
+    fprintf(file, "// %s\nstatic const double %s[8][8] = {\n", comment, name);
+    for (int r = 0; r < BOARD_SIZE; r++) {
+        fprintf(file, "    {");
+        for (int c = 0; c < BOARD_SIZE; c++) {
+            fprintf(file, "%4.0f%s", weights[W_TABLE + t * SQUARE_CLASSES + squareClass(r * BOARD_SIZE + c)],
+                    c < BOARD_SIZE - 1 ? ", " : "");
+        }
+        fprintf(file, "}%s\n", r < BOARD_SIZE - 1 ? "," : "");
+    }
+    fprintf(file, "};\n\n");
+}
+
+// Every weight is rounded to an integer, so the client's incremental position
+// sums stay exact; the loss written with them is measured after rounding
+static void roundWeights() {
+    for (int w = 0; w < WEIGHT_COUNT; w++) {
+        weights[w] = round(weights[w]);
+    }
+}
+
+// Expects rounded weights (roundWeights)
+static int writeWeights(const char* path, double loss) {
+    char tmpPath[1024];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    FILE* file = fopen(tmpPath, "w");
+    if (!file) {
+        fprintf(stderr, "Cannot write %s\n", tmpPath);
+        return 0;
+    }
+    
+    fprintf(file, "// eval_weights.h - Weights of the classical OctaFlip evaluation\n");
+    fprintf(file, "// Written by texel_tune from %zu positions (K = %.6g, mse %.6f)\n", positionCount, scaleK, loss);
+    fprintf(file, "#ifndef EVAL_WEIGHTS_H\n#define EVAL_WEIGHTS_H\n\n");
+    writeTable(file, "Opening: 중앙 제어 + 초기 위치 활용", "POSITION_WEIGHTS_OPENING", 0);
+    writeTable(file, "Midgame: 안정성 vs 기동성 균형", "POSITION_WEIGHTS_MIDGAME", 1);
+    writeTable(file, "Endgame: 코너와 엣지가 결정적", "POSITION_WEIGHTS_ENDGAME", 2);
+    fprintf(file, "// Piece value at each TAPER_FILL point\n");
+    fprintf(file, "static const double TAPER_PIECE_VALUE[4] = {%.1f, %.1f, %.1f, %.1f};\n\n",
+            weights[W_PIECE], weights[W_PIECE + 1], weights[W_PIECE + 2], weights[W_PIECE + 3]);
+    fprintf(file, "#define CORNER_BONUS %.1f\n", weights[W_CORNER]);
+    fprintf(file, "#define X_SQUARE_PENALTY %.1f\n", weights[W_X_SQUARE]);
+    fprintf(file, "#define MOBILITY_WEIGHT %.1f\n", weights[W_MOBILITY]);
+    fprintf(file, "#define CONNECTIVITY_WEIGHT %.1f\n", weights[W_CONNECTIVITY]);
+    fprintf(file, "#define EDGE_WEIGHT %.1f\n", weights[W_EDGE]);
+    fprintf(file, "\n#endif // EVAL_WEIGHTS_H\n");
+    
+    if (fclose(file) != 0 || rename(tmpPath, path) != 0) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        remove(tmpPath);
+        return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    const char* output = "eval_weights.h";
+    int epochs = 1000;
+    int threads = 4;
+    int games = 0;
+    
+    initWeights();
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-epochs") == 0 && i + 1 < argc) {
+            epochs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-threads") == 0 && i + 1 < argc) {
+            threads = atoi(argv[++i]);
+            if (threads < 1) threads = 1;
+            if (threads > MAX_THREADS) threads = MAX_THREADS;
+        } else {
+            games += gameLog_read(argv[i], addGame, NULL);
+        }
+    }
+    
+    if (positionCount == 0) {
+        fprintf(stderr, "Usage: %s [-o eval_weights.h] [-epochs N] [-threads N] octaflip_game_*.log\n", argv[0]);
+        fprintf(stderr, "No finished games found\n");
+        return 1;
+    }
+    printf("%d games, %zu positions\n", games, positionCount);
+    if ((size_t)matchingCount != positionCount) {
+        // Asymmetric position tables were averaged; anything else is a bug
+        printf("Note: starting weights differ from eval_weights.h on %zu positions\n",
+               positionCount - matchingCount);
+    }
+    
+    fitScale(threads);
+    double startLoss = evaluateLoss(threads, NULL);
+    printf("K = %.6g, starting mse %.6f\n", scaleK, startLoss);
+    
+    double loss = tune(threads, epochs);
+    roundWeights();
+    double roundedLoss = evaluateLoss(threads, NULL);
+    printf("Final mse %.6f, %.6f with rounded weights\n", loss, roundedLoss);
+    
+    if (!writeWeights(output, roundedLoss)) {
+        return 1;
+    }
+    printf("Wrote %s\n", output);
+    return 0;
+}
@@ -1,21 +1,23 @@
 #!/usr/bin/env python3
 """
-OctaFlip Tournament - Maximum Stability Version
+OctaFlip Tournament - Arena Version
+한 매치(두 엔진)마다 서버를 한 번만 띄우고 ./server -arena N -swap-colors 로
+N 게임을 연속으로 진행합니다. 클라이언트는 -rejoin 으로 연결을 유지하며,
+결과는 서버가 출력하는 "ARENA {...}" 줄에서 읽습니다.
 """
 
 import subprocess
 import time
 import os
-import signal
 import sys
-import re
+import json
 import socket
 
 class RobustTournament:
     def __init__(self):
         self.engines = {
             1: "Eunsong",
-            2: "MCTS", 
+            2: "MCTS",
             3: "AlphaBeta",
             4: "TournamentBeast",
             5: "UltimateAI",
@@ -33,32 +35,20 @@ class RobustTournament:
         
         # 디버그 모드
         self.debug = False
+        
+        # 게임당 최대 대기 시간 (초)
+        self.game_timeout = 90
+        self.port = 8080
     
     def cleanup_everything(self):
-        """완전한 정리"""
+        """남아 있는 서버/클라이언트 정리 (시작과 종료 때만)"""
         print("Cleaning up...", end='', flush=True)
         
-        # 모든 서버/클라이언트 프로세스 종료
         os.system("killall -9 server 2>/dev/null")
         os.system("killall -9 client 2>/dev/null")
         
-        # 추가 정리
-        os.system("pkill -9 -f './server' 2>/dev/null")
-        os.system("pkill -9 -f './client' 2>/dev/null")
-        
-        time.sleep(2)
         print(" done")
     
-    def is_port_free(self, port=8080):
-        """포트가 사용 가능한지 확인"""
-        sock = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
-        try:
-            sock.bind(('', port))
-            sock.close()
-            return True
-        except:
-            return False
-    
     def wait_for_port(self, port=8080, timeout=5):
         """포트가 열릴 때까지 대기"""
         start = time.time()
@@ -68,177 +58,163 @@ class RobustTournament:
             sock.close()
             if result == 0:
                 return True
-            time.sleep(0.1)
+            time.sleep(0.05)
+        return False
+    
+    def wait_for_text(self, log_file, text, proc, timeout=10):
+        """서버 로그에 text 가 나올 때까지 대기"""
+        start = time.time()
+        while time.time() - start < timeout:
+            if proc.poll() is not None:
+                return False
+            with open(log_file, 'r', errors='replace') as f:
+                if text in f.read():
+                    return True
+            time.sleep(0.05)
         return False
     
-    def run_game_simple(self, red_engine_id, blue_engine_id, game_num):
-        """단순하고 안정적인 게임 실행"""
+    def start_client(self, engine_id):
+        return subprocess.Popen(
+            ["./client",
+             "-ip", "127.0.0.1",
+             "-port", str(self.port),
+             "-username", f"Engine{engine_id}",
+             "-engine", str(engine_id),
+             "-no-board",
+             "-rejoin"],
+            stdout=subprocess.DEVNULL if not self.debug else None,
+            stderr=subprocess.DEVNULL if not self.debug else None
+        )
+    
+    def run_arena(self, red_engine_id, blue_engine_id, games, label):
+        """한 서버에서 games 게임 연속 진행. 첫 게임은 red_engine_id 가 Red 이고 매 게임 색을 바꿉니다.
+        게임마다 (winner, red_engine, blue_engine, red_score, blue_score) 를 돌려줍니다."""
         print(f"\n{'='*60}")
-        print(f"Game #{game_num}: {self.engines[red_engine_id]} (Red) vs {self.engines[blue_engine_id]} (Blue)")
+        print(f"{label}: {self.engines[red_engine_id]} vs {self.engines[blue_engine_id]}, {games} games")
         print(f"{'='*60}")
         
-        # 완전한 정리부터 시작
-        self.cleanup_everything()
-        
-        # 포트 확인
-        if not self.is_port_free(8080):
-            print("Port 8080 is busy. Waiting...")
-            time.sleep(3)
-            self.cleanup_everything()
-            time.sleep(2)
-        
-        log_file = f"tournament_logs/game_{game_num}_{red_engine_id}v{blue_engine_id}.log"
+        log_file = f"tournament_logs/arena_{label}_{red_engine_id}v{blue_engine_id}.log"
+        procs = []
         
         try:
             # 1. 서버 시작
             print("Starting server...", end='', flush=True)
             server_proc = subprocess.Popen(
-                ["./server"],
+                ["./server", "-port", str(self.port), "-arena", str(games), "-swap-colors"],
                 stdout=open(log_file, 'w'),
                 stderr=subprocess.STDOUT
             )
+            procs.append(server_proc)
             
-            # 서버가 포트를 열 때까지 대기
-            if not self.wait_for_port(8080, 5):
+            if not self.wait_for_port(self.port, 5):
                 print(" FAILED (port not open)")
-                server_proc.kill()
-                return None
-            
-            # 서버가 완전히 준비될 때까지 추가 대기
-            time.sleep(2)
+                return []
             print(" OK")
             
-            # 2. Red 플레이어 시작
-            print(f"Starting {self.engines[red_engine_id]} (Red)...", end='', flush=True)
-            
-            client1_proc = subprocess.Popen(
-                ["./client", 
-                 "-ip", "127.0.0.1",
-                 "-port", "8080",
-                 "-username", f"Engine{red_engine_id}",
-                 "-engine", str(red_engine_id),
-                 "-no-board"],
-                stdout=subprocess.DEVNULL if not self.debug else None,
-                stderr=subprocess.DEVNULL if not self.debug else None
-            )
-            
-            # 첫 번째 클라이언트가 연결되고 등록할 시간
-            time.sleep(3)
-            
-            # 프로세스 확인
-            if client1_proc.poll() is not None:
-                print(" FAILED (process died)")
-                server_proc.kill()
-                return None
+            # 2. 먼저 등록한 쪽이 첫 게임의 Red
+            print(f"Starting {self.engines[red_engine_id]} (Red first)...", end='', flush=True)
+            procs.append(self.start_client(red_engine_id))
+            if not self.wait_for_text(log_file, f"Player Engine{red_engine_id} joined the lobby", server_proc):
+                print(" FAILED (not registered)")
+                return []
             print(" OK")
             
-            # 3. Blue 플레이어 시작
-            print(f"Starting {self.engines[blue_engine_id]} (Blue)...", end='', flush=True)
-            
-            client2_proc = subprocess.Popen(
-                ["./client",
-                 "-ip", "127.0.0.1", 
-                 "-port", "8080",
-                 "-username", f"Engine{blue_engine_id}",
-                 "-engine", str(blue_engine_id),
-                 "-no-board"],
-                stdout=subprocess.DEVNULL if not self.debug else None,
-                stderr=subprocess.DEVNULL if not self.debug else None
-            )
-            
-            # 두 번째 클라이언트 연결 대기
-            time.sleep(2)
-            
-            # 프로세스 확인
-            if client2_proc.poll() is not None:
-                print(" FAILED (process died)")
-                server_proc.kill()
-                client1_proc.kill()
-                return None
+            print(f"Starting {self.engines[blue_engine_id]}...", end='', flush=True)
+            procs.append(self.start_client(blue_engine_id))
             print(" OK")
             
-            # 4. 게임 진행
-            print("\nGame running", end='', flush=True)
-            
-            timeout = 90  # 1.5분
+            # 3. 마지막 게임이 끝나면 서버가 스스로 종료
+            print("\nGames running", end='', flush=True)
             start = time.time()
-            
-            while time.time() - start < timeout:
-                # 서버 종료 확인
-                if server_proc.poll() is not None:
-                    print("\nGame finished!")
-                    break
-                
-                # 클라이언트 상태 확인
-                if client1_proc.poll() is not None and client2_proc.poll() is not None:
-                    print("\nClients disconnected")
-                    time.sleep(2)
+            while server_proc.poll() is None:
+                if time.time() - start > self.game_timeout * games:
+                    print("\nTimeout!")
                     break
-                
                 print(".", end='', flush=True)
-                time.sleep(3)
+                time.sleep(1)
             else:
-                print("\nTimeout!")
-            
-            # 5. 정리
-            time.sleep(1)
-            
-            # 프로세스 종료
-            for proc in [client1_proc, client2_proc, server_proc]:
-                try:
-                    proc.terminate()
-                    time.sleep(0.5)
-                    if proc.poll() is None:
-                        proc.kill()
-                except:
-                    pass
-            
-            time.sleep(2)
-            
-            # 6. 결과 파싱
-            return self.parse_result(log_file)
-            
+                print("\nArena finished!")
+        
         except Exception as e:
             print(f"\nERROR: {e}")
             if self.debug:
                 import traceback
                 traceback.print_exc()
-            return None
         
         finally:
-            # 완전한 정리
-            self.cleanup_everything()
+            # 클라이언트는 서버가 연결을 닫으면 종료; 남은 것만 정리
+            for proc in reversed(procs):
+                try:
+                    if proc.poll() is None:
+                        proc.terminate()
+                        proc.wait(timeout=2)
+                except Exception:
+                    proc.kill()
+        
+        return self.parse_results(log_file)
     
-    def parse_result(self, log_file):
-        """결과 파싱"""
+    def parse_results(self, log_file):
+        """서버 로그의 ARENA 결과 줄 파싱"""
+        results = []
         try:
-            with open(log_file, 'r') as f:
-                content = f.read()
-            
-            # 점수 찾기
-            match = re.search(r"Red:\s*(\d+),\s*Blue:\s*(\d+)", content)
-            if match:
-                red = int(match.group(1))
-                blue = int(match.group(2))
-                
-                print(f"Score: Red {red} - Blue {blue}")
-                
-                if red > blue:
-                    return "RED", red, blue
-                elif blue > red:
-                    return "BLUE", red, blue
-                else:
-                    return "DRAW", red, blue
-            
-            print("Could not find score in log")
-            return None
-            
+            with open(log_file, 'r', errors='replace') as f:
+                for line in f:
+                    if not line.startswith("ARENA "):
+                        continue
+                    record = json.loads(line[len("ARENA "):])
+                    if record.get("type") != "arena_result":
+                        continue
+                    
+                    red = record["red_score"]
+                    blue = record["blue_score"]
+                    red_engine = int(record["red"][len("Engine"):])
+                    blue_engine = int(record["blue"][len("Engine"):])
+                    
+                    if red > blue:
+                        winner = "RED"
+                    elif blue > red:
+                        winner = "BLUE"
+                    else:
+                        winner = "DRAW"
+                    
+                    print(f"Game {record['game']}: {self.engines[red_engine]} (Red) {red} - "
+                          f"{blue} {self.engines[blue_engine]} (Blue), {record['moves']} moves")
+                    results.append((winner, red_engine, blue_engine, red, blue))
         except Exception as e:
             print(f"Parse error: {e}")
-            return None
+        
+        if not results:
+            print("Could not find results in log")
+        return results
+    
+    def tally(self, results, result):
+        """한 게임 결과를 순위표에 반영"""
+        winner, red_engine, blue_engine, red_score, blue_score = result
+        
+        results[red_engine]["for"] += red_score
+        results[red_engine]["against"] += blue_score
+        results[blue_engine]["for"] += blue_score
+        results[blue_engine]["against"] += red_score
+        
+        if winner == "RED":
+            results[red_engine]["wins"] += 1
+            results[red_engine]["points"] += 3
+            results[blue_engine]["losses"] += 1
+            print(f"Winner: {self.engines[red_engine]}")
+        elif winner == "BLUE":
+            results[blue_engine]["wins"] += 1
+            results[blue_engine]["points"] += 3
+            results[red_engine]["losses"] += 1
+            print(f"Winner: {self.engines[blue_engine]}")
+        else:
+            results[red_engine]["draws"] += 1
+            results[red_engine]["points"] += 1
+            results[blue_engine]["draws"] += 1
+            results[blue_engine]["points"] += 1
+            print("Draw!")
     
     def double_round_robin(self):
-        """더블 라운드 로빈"""
+        """더블 라운드 로빈: 쌍마다 서버 하나에서 색을 바꿔 2게임"""
         print("\n" + "="*70)
         print("Double Round Robin Tournament")
         print("="*70)
@@ -254,89 +230,27 @@ class RobustTournament:
                 "against": 0
             }
         
-        game_count = 0
+        match_count = 0
         successful_games = 0
+        start = time.time()
         
         # 모든 쌍에 대해
         for e1 in range(1, 7):
             for e2 in range(e1 + 1, 7):
-                # 첫 번째 게임: e1이 Red
-                game_count += 1
-                print(f"\n[Game {game_count}/30]")
+                match_count += 1
+                print(f"\n[Match {match_count}/15]")
                 
-                result = self.run_game_simple(e1, e2, game_count)
-                
-                if result:
+                games = self.run_arena(e1, e2, 2, f"match{match_count}")
+                for result in games:
                     successful_games += 1
-                    winner, red_score, blue_score = result
-                    
-                    results[e1]["for"] += red_score
-                    results[e1]["against"] += blue_score
-                    results[e2]["for"] += blue_score
-                    results[e2]["against"] += red_score
-                    
-                    if winner == "RED":
-                        results[e1]["wins"] += 1
-                        results[e1]["points"] += 3
-                        results[e2]["losses"] += 1
-                        print(f"Winner: {self.engines[e1]}")
-                    elif winner == "BLUE":
-                        results[e2]["wins"] += 1
-                        results[e2]["points"] += 3
-                        results[e1]["losses"] += 1
-                        print(f"Winner: {self.engines[e2]}")
-                    else:
-                        results[e1]["draws"] += 1
-                        results[e1]["points"] += 1
-                        results[e2]["draws"] += 1
-                        results[e2]["points"] += 1
-                        print("Draw!")
-                else:
-                    print("Game failed!")
-                
-                # 충분한 휴식
-                time.sleep(5)
-                
-                # 두 번째 게임: e2가 Red
-                game_count += 1
-                print(f"\n[Game {game_count}/30]")
-                
-                result = self.run_game_simple(e2, e1, game_count)
-                
-                if result:
-                    successful_games += 1
-                    winner, red_score, blue_score = result
-                    
-                    results[e2]["for"] += red_score
-                    results[e2]["against"] += blue_score
-                    results[e1]["for"] += blue_score
-                    results[e1]["against"] += red_score
-                    
-                    if winner == "RED":
-                        results[e2]["wins"] += 1
-                        results[e2]["points"] += 3
-                        results[e1]["losses"] += 1
-                        print(f"Winner: {self.engines[e2]}")
-                    elif winner == "BLUE":
-                        results[e1]["wins"] += 1
-                        results[e1]["points"] += 3
-                        results[e2]["losses"] += 1
-                        print(f"Winner: {self.engines[e1]}")
-                    else:
-                        results[e1]["draws"] += 1
-                        results[e1]["points"] += 1
-                        results[e2]["draws"] += 1
-                        results[e2]["points"] += 1
-                        print("Draw!")
-                else:
-                    print("Game failed!")
-                
-                # 충분한 휴식
-                time.sleep(5)
+                    self.tally(results, result)
+                if len(games) < 2:
+                    print(f"{2 - len(games)} game(s) failed!")
         
         # 결과 출력
         print("\n" + "="*70)
-        print(f"Tournament Complete! ({successful_games}/30 games successful)")
+        print(f"Tournament Complete! ({successful_games}/30 games successful, "
+              f"{time.time() - start:.0f}s)")
         print("="*70)
         
         # 순위표
@@ -360,33 +274,17 @@ class RobustTournament:
                   f"{stats['points']:<5} {stats['for']:<5} {stats['against']:<5} "
                   f"{diff_str:<6}")
     
-    def run_match(self, e1, e2):
-        """두 엔진 간 매치"""
+    def run_match(self, e1, e2, games=2):
+        """두 엔진 간 매치 (색을 번갈아 games 게임)"""
         print(f"\nMatch: {self.engines[e1]} vs {self.engines[e2]}")
         
         stats = {e1: 0, e2: 0, "draws": 0}
         
-        # Game 1
-        result = self.run_game_simple(e1, e2, 1)
-        if result:
-            winner, _, _ = result
-            if winner == "RED":
-                stats[e1] += 1
-            elif winner == "BLUE":
-                stats[e2] += 1
-            else:
-                stats["draws"] += 1
-        
-        time.sleep(5)
-        
-        # Game 2
-        result = self.run_game_simple(e2, e1, 2)
-        if result:
-            winner, _, _ = result
+        for winner, red_engine, blue_engine, _, _ in self.run_arena(e1, e2, games, "match"):
             if winner == "RED":
-                stats[e2] += 1
+                stats[red_engine] += 1
             elif winner == "BLUE":
-                stats[e1] += 1
+                stats[blue_engine] += 1
             else:
                 stats["draws"] += 1
         
@@ -404,7 +302,7 @@ def main():
     
     while True:
         print("\n" + "="*50)
-        print("OctaFlip Tournament (Robust)")
+        print("OctaFlip Tournament (Arena)")
         print("="*50)
         print("1. Double Round Robin")
         print("2. Two Engine Match")
@@ -422,8 +320,9 @@ def main():
             try:
                 e1 = int(input("Engine 1: "))
                 e2 = int(input("Engine 2: "))
-                if e1 in tournament.engines and e2 in tournament.engines and e1 != e2:
-                    tournament.run_match(e1, e2)
+                games = int(input("Games (default 2): ") or "2")
+                if e1 in tournament.engines and e2 in tournament.engines and e1 != e2 and games > 0:
+                    tournament.run_match(e1, e2, games)
             except:
                 print("Invalid input")
         elif choice == '3':
@@ -440,4 +339,4 @@ if __name__ == "__main__":
     except KeyboardInterrupt:
         print("\n\nCleaning up...")
         t = RobustTournament()
-        t.cleanup_everything()
\ No newline at end of file
+        t.cleanup_everything()
@@ -16,6 +16,8 @@ import json
 import pickle
 import gzip
 import os
+import struct
+import sys
 import traceback
 from datetime import datetime, timedelta
 import warnings
@@ -53,6 +55,22 @@ HALL_OF_FAME_SIZE = 10
 OUTPUT_SCALE = 200
 QUANTIZATION_SCALE = 127
 
+# 바이너리 네트워크 파일 (client.c의 NNUEFileHeader와 동일)
+NNUE_FILE_MAGIC = b'OFNN'
+NNUE_FILE_VERSION = 2
+NNUE_FILE_NAME = 'octaflip.nnue'
+NNUE_HEADER_FORMAT = '<4s5I7d iIII'
+NNUE_ACTIVATION_LIMIT = 16000   # int16 활성값 여유 (2배)
+NNUE_TEST_VECTORS = 32
+
+# 오프닝 북 파일 (client.c의 BookFileHeader / BookEntry와 동일)
+BOOK_FILE_MAGIC = b'OFBK'
+BOOK_FILE_VERSION = 2
+BOOK_FILE_NAME = 'octaflip.book'
+BOOK_HEADER_FORMAT = '<4sIII'
+BOOK_ENTRY_FORMAT = '<QIHBB'
+BOOK_SIDE_KEY = 0x9E3779B97F4A7C15      # BLUE 차례일 때 키에 xor
+
 
 class DeepNNUE:
     """개선된 NNUE with Leaky ReLU"""
@@ -521,87 +539,119 @@ class DeepNNUE:
             print(f"Error loading weights: {e}")
             print("Initializing with new random weights")
     
-    def export_to_c_arrays(self, filename='nnue_weights_generated.h'):
-        """C 헤더 파일로 내보내기 (client.c와 호환)"""
-        with open(filename, 'w') as f:
-            f.write("// Auto-generated Deep NNUE weights from Python training v7.0\n")
-            f.write("// 4-layer structure with batch normalization\n")
-            f.write("// Leaky ReLU activation\n\n")
-            
-            f.write("#ifndef NNUE_WEIGHTS_GENERATED_H\n")
-            f.write("#define NNUE_WEIGHTS_GENERATED_H\n\n")
-            
-            f.write("#include <stdint.h>\n\n")
-            
-            # Define sizes
-            f.write(f"#define NNUE_HIDDEN1_SIZE {HIDDEN1_SIZE}\n")
-            f.write(f"#define NNUE_HIDDEN2_SIZE {HIDDEN2_SIZE}\n")
-            f.write(f"#define NNUE_HIDDEN3_SIZE {HIDDEN3_SIZE}\n\n")
-            
-            # 양자화 스케일
-            scale = QUANTIZATION_SCALE
-            
-            # 각 레이어 출력
-            for name, data in [
-                ('w1', self.w1), ('b1', self.b1),
-                ('w2', self.w2), ('b2', self.b2),
-                ('w3', self.w3), ('b3', self.b3),
-                ('w4', self.w4), ('b4', self.b4),
-                ('bn_gamma1', self.bn_gamma1), ('bn_beta1', self.bn_beta1),
-                ('bn_gamma2', self.bn_gamma2), ('bn_beta2', self.bn_beta2),
-                ('bn_gamma3', self.bn_gamma3), ('bn_beta3', self.bn_beta3),
-            ]:
-                # int16으로 양자화
-                quantized = np.clip(np.round(data * scale), -32768, 32767).astype(np.int16)
-                
-                if name.startswith('w') and len(data.shape) == 2:
-                    rows, cols = data.shape
-                    f.write(f"static const int16_t nnue_{name}[{rows}][{cols}] = {{\n")
-                    for i in range(rows):
-                        f.write("    {")
-                        for j in range(cols):
-                            f.write(f"{quantized[i,j]:6d}")
-                            if j < cols - 1:
-                                f.write(", ")
-                        f.write("}")
-                        if i < rows - 1:
-                            f.write(",")
-                        f.write("\n")
-                else:
-                    size = data.size
-                    f.write(f"static const int16_t nnue_{name}[{size}] = {{\n    ")
-                    for i in range(size):
-                        f.write(f"{quantized[i]:6d}")
-                        if i < size - 1:
-                            f.write(", ")
-                            if (i + 1) % 8 == 0:
-                                f.write("\n    ")
-                    f.write("\n")
-                
-                f.write("};\n\n")
-            
-            # BN statistics (float로 저장)
-            for name, data in [
-                ('bn_mean1', self.bn_mean1), ('bn_var1', self.bn_var1),
-                ('bn_mean2', self.bn_mean2), ('bn_var2', self.bn_var2),
-                ('bn_mean3', self.bn_mean3), ('bn_var3', self.bn_var3),
-            ]:
-                size = data.size
-                f.write(f"static const float nnue_{name}[{size}] = {{\n    ")
-                for i in range(size):
-                    f.write(f"{data[i]:.6f}f")
-                    if i < size - 1:
-                        f.write(", ")
-                        if (i + 1) % 4 == 0:
-                            f.write("\n    ")
-                f.write("\n};\n\n")
-            
-            f.write(f"#define NNUE_SCALE {QUANTIZATION_SCALE}\n")
-            f.write(f"#define NNUE_OUTPUT_SCALE {OUTPUT_SCALE}\n")
-            f.write("#define HAS_NNUE_WEIGHTS\n\n")
-            f.write("#endif // NNUE_WEIGHTS_GENERATED_H\n")
-        
-        print(f"Exported Deep NNUE weights to {filename}")
+    def fold_batch_norm(self):
+        """BN을 앞 레이어의 가중치/바이어스에 합치기 (추론 모드 기준)"""
+        layers = []
+        for w, b, gamma, beta, mean, var in [
+            (self.w1, self.b1, self.bn_gamma1, self.bn_beta1, self.bn_mean1, self.bn_var1),
+            (self.w2, self.b2, self.bn_gamma2, self.bn_beta2, self.bn_mean2, self.bn_var2),
+            (self.w3, self.b3, self.bn_gamma3, self.bn_beta3, self.bn_mean3, self.bn_var3),
+        ]:
+            k = gamma.astype(np.float64) / np.sqrt(var.astype(np.float64) + self.epsilon)
+            layers.append((w.astype(np.float64) * k, (b - mean) * k + beta))
+        layers.append((self.w4.astype(np.float64).reshape(-1), self.b4.astype(np.float64).reshape(-1)))
+        return layers
+    
+    @staticmethod
+    def _quantized_forward(net, boards):
+        """client.c의 정수 연산을 그대로 재현 (출력 레이어 합, tanh 이전)"""
+        x = np.array([[1 if board[i // 8][i % 8] == piece else 0
+                       for piece in (RED, BLUE, EMPTY) for i in range(64)] for board in boards],
+                     dtype=np.int64)
+        
+        # 활성값은 C 커널처럼 int16 으로 포화
+        def leaky_div(v, pos, neg):
+            a = np.trunc(v.astype(np.float64) / np.where(v > 0, pos, neg))
+            return np.clip(a, -32768, 32767).astype(np.int64)
+        
+        a = leaky_div(x @ net['w1'] + net['b1'], *net['div'][0])
+        a = leaky_div(a @ net['w2'] + net['b2'], *net['div'][1])
+        a = leaky_div(a @ net['w3'] + net['b3'], *net['div'][2])
+        return a @ net['w4'] + net['b4']
+    
+    def export_network(self, filename=NNUE_FILE_NAME):
+        """바이너리 네트워크 파일로 내보내기 (client.c -net 과 호환)
+        
+        BN 접기, int8 가중치 + int32 바이어스, 레이어별 스케일.
+        C 쪽에서 로드할 때 확인하는 테스트 벡터를 함께 저장.
+        """
+        layers = self.fold_batch_norm()
+        
+        # 스케일 보정용 국면 (랜덤 게임)
+        rng = random.Random(12345)
+        boards = []
+        for _ in range(64):
+            game = OctaFlipGame()
+            for _ in range(rng.randint(0, 70)):
+                moves = game.get_valid_moves()
+                if not moves or game.is_game_over():
+                    break
+                game.make_move(rng.choice(moves))
+            boards.append([row[:] for row in game.board])
+        
+        x = np.array([self.board_to_input(board) for board in boards], dtype=np.float64)
+        
+        # 은닉 레이어: int8 가중치 (스케일 s_w), int32 바이어스 (단위 1/(s_in*s_w)),
+        # 활성값은 int16 범위 안에서 최대한 크게 (단위 1/s_out)
+        net = {'div': []}
+        s_in = 1.0  # one-hot 입력
+        a_float = x
+        for n, (w, b) in enumerate(layers[:3], start=1):
+            s_w = 127.0 / np.max(np.abs(w))
+            net[f'w{n}'] = np.round(w * s_w).astype(np.int64)
+            net[f'b{n}'] = np.round(b * s_in * s_w).astype(np.int64)
+            a_float = self.leaky_relu(a_float @ w + b)
+            s_out = NNUE_ACTIVATION_LIMIT / max(np.max(np.abs(a_float)), 1e-6)
+            pos = s_in * s_w / s_out
+            net['div'].append((pos, pos / self.leaky_slope))
+            s_in = s_out
+        
+        # 출력 레이어: 32개뿐이고 합이 거의 상쇄되므로 int16 가중치 유지.
+        # 어떤 int16 활성값에서도 int32 합이 넘치지 않도록 스케일 제한
+        w4, b4 = layers[3]
+        s_w = min(32767.0 / np.max(np.abs(w4)), 65000.0 / np.sum(np.abs(w4)))
+        net['w4'] = np.round(w4 * s_w).astype(np.int64)
+        net['b4'] = np.round(b4 * s_in * s_w).astype(np.int64)
+        output_div = s_in * s_w
+        
+        # 정확도 확인 (float 모델 대비)
+        raw = self._quantized_forward(net, boards)
+        quantized = np.tanh(raw / output_div / 2) * 2 * OUTPUT_SCALE
+        reference = self.forward(x.astype(np.float32), training=False)
+        print(f"Quantization error: max {np.max(np.abs(quantized - reference)):.2f}, "
+              f"mean {np.mean(np.abs(quantized - reference)):.2f} (output scale {OUTPUT_SCALE})")
+        
+        # 가중치는 [in][out] row-major
+        payload = b''.join([
+            net['w1'].astype('<i1').tobytes(), net['b1'].astype('<i4').tobytes(),
+            net['w2'].astype('<i1').tobytes(), net['b2'].astype('<i4').tobytes(),
+            net['w3'].astype('<i1').tobytes(), net['b3'].astype('<i4').tobytes(),
+            net['w4'].astype('<i2').tobytes(), net['b4'].astype('<i4').tobytes(),
+        ])
+        
+        # 테스트 벡터: 64칸 보드 + 기대 출력 (tanh 이전 정수 합)
+        for board, value in zip(boards[:NNUE_TEST_VECTORS], raw[:NNUE_TEST_VECTORS]):
+            payload += ''.join(''.join(row) for row in board).encode('ascii')
+            payload += struct.pack('<i', int(value))
+        
+        # FNV-1a
+        checksum = 2166136261
+        for byte in payload:
+            checksum = ((checksum ^ byte) * 16777619) & 0xFFFFFFFF
+        
+        divisors = [d for pair in net['div'] for d in pair] + [output_div]
+        header = struct.pack(NNUE_HEADER_FORMAT, NNUE_FILE_MAGIC, NNUE_FILE_VERSION,
+                             INPUT_SIZE, HIDDEN1_SIZE, HIDDEN2_SIZE, HIDDEN3_SIZE,
+                             *divisors, OUTPUT_SCALE, NNUE_TEST_VECTORS, len(payload), checksum)
+        
+        # 실행 중인 클라이언트가 다음 게임에서 교체할 수 있도록 rename으로 저장
+        tmp_filename = filename + '.tmp'
+        with open(tmp_filename, 'wb') as f:
+            f.write(header)
+            f.write(payload)
+        os.replace(tmp_filename, filename)
+        
+        print(f"Exported Deep NNUE network to {filename}")
     
     def copy(self):
         """딥 카피"""
@@ -749,6 +799,220 @@ class OctaFlipGame:
             return 0.0, 0.0
 
 
+# 보드 대칭 (symmetry.h 와 같은 계산)
+# 대칭 t: bit 2 전치 (r, c) -> (c, r), 그 다음 bit 0 행 뒤집기, bit 1 열 뒤집기
+MASK64 = (1 << 64) - 1
+
+
+def sym_flip_rows(b):
+    return int.from_bytes(b.to_bytes(8, 'little'), 'big')
+
+
+def sym_flip_columns(b):
+    b = ((b >> 1) & 0x5555555555555555) | ((b & 0x5555555555555555) << 1)
+    b = ((b >> 2) & 0x3333333333333333) | ((b & 0x3333333333333333) << 2)
+    b = ((b >> 4) & 0x0F0F0F0F0F0F0F0F) | ((b & 0x0F0F0F0F0F0F0F0F) << 4)
+    return b
+
+
+def sym_transpose(b):
+    t = 0x0F0F0F0F00000000 & (b ^ (b << 28))
+    b ^= t ^ (t >> 28)
+    t = 0x3333000033330000 & (b ^ (b << 14))
+    b ^= t ^ (t >> 14)
+    t = 0x5500550055005500 & (b ^ (b << 7))
+    b ^= t ^ (t >> 7)
+    return b & MASK64
+
+
+def sym_square(t, sq):
+    r, c = divmod(sq, 8)
+    if t & 4:
+        r, c = c, r
+    if t & 1:
+        r = 7 - r
+    if t & 2:
+        c = 7 - c
+    return r * 8 + c
+
+
+def sym_mix(z):
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & MASK64
+    return z ^ (z >> 31)
+
+
+def sym_canonical_key(red, blue, blocked):
+    """8가지 대칭 이미지 중 가장 작은 키와, 보드를 그 이미지로 옮기는 대칭"""
+    best = None
+    for t in range(8):
+        image = []
+        for b in (red, blue, blocked):
+            if t & 4:
+                b = sym_transpose(b)
+            if t & 1:
+                b = sym_flip_rows(b)
+            if t & 2:
+                b = sym_flip_columns(b)
+            image.append(b)
+        key = sym_mix(image[0] ^ sym_mix(image[1] ^ sym_mix(image[2])))
+        if best is None or key < best[0]:
+            best = (key, t)
+    return best
+
+
+def board_bitboards(board):
+    """빨강, 파랑, 막힌 칸 비트보드 (bit r * 8 + c)"""
+    red = blue = blocked = 0
+    for r in range(8):
+        for c in range(8):
+            bit = 1 << (r * 8 + c)
+            if board[r][c] == RED:
+                red |= bit
+            elif board[r][c] == BLUE:
+                blue |= bit
+            elif board[r][c] == '#':
+                blocked |= bit
+    return red, blue, blocked
+
+
+def dedupe_positions(data):
+    """(pos, value) 중 대칭까지 같은 국면 (같은 차례) 을 하나로 합치고 value 는 평균"""
+    merged = {}
+    for pos, value in data:
+        key = (sym_canonical_key(*board_bitboards(pos['board']))[0], pos['player'])
+        if key in merged:
+            merged[key][1] += value
+            merged[key][2] += 1
+        else:
+            merged[key] = [pos, value, 1]
+    return [(pos, total / count) for pos, total, count in merged.values()]
+
+
+# 오프닝 북
+class OpeningBook:
+    """opening_book.pkl.gz 에 pickle 된 객체 (book: {해시: {wins, losses, draws, moves}}, max_depth)"""
+    pass
+
+
+def book_key(board, player):
+    """북 키 (client.c book_probe): 정규형 키, BLUE 차례면 BOOK_SIDE_KEY 를 xor. (키, 대칭)"""
+    key, t = sym_canonical_key(*board_bitboards(board))
+    return key ^ (BOOK_SIDE_KEY if player == 1 else 0), t
+
+
+def replay_book_positions(book):
+    """북의 키는 프로세스마다 달라지는 hash(str) 라서 국면을 다시 찾아야 한다.
+    
+    시작 국면과 첫 수 이후 국면에서 출발해, 모든 수가 합법이고 전체 게임 수가 부모의
+    그 수 횟수와 같은 엔트리를 자식으로 찾아 내려간다. 후보가 여럿이면 자식이 더 많이
+    맞는 쪽을 고르고, 그래도 갈리지 않으면 버린다. 반환: {엔트리 키: (board, player)}
+    """
+    totals = {k: v['wins'] + v['losses'] + v['draws'] for k, v in book.items()}
+    
+    def legal_moves(board, player):
+        game = OctaFlipGame()
+        game.board = board
+        game.current_player = player
+        return {m[:4] for m in game.get_valid_moves()}
+    
+    def play(board, player, move):
+        game = OctaFlipGame()
+        game.board = [row[:] for row in board]
+        game.current_player = player
+        r1, c1, r2, c2 = move
+        game.make_move((r1, c1, r2, c2, max(abs(r2 - r1), abs(c2 - c1))))
+        return game.board
+    
+    def fits(entry, legal):
+        return book[entry]['moves'] and all(m in legal for m in book[entry]['moves'])
+    
+    def child_matches(entry, board, player):
+        matched = 0
+        for move, count in book[entry]['moves'].items():
+            child = legal_moves(play(board, player, move), 1 - player)
+            if any(totals[f] == count and fits(f, child) for f in book):
+                matched += 1
+        return matched
+    
+    start = OctaFlipGame().board
+    frontier = [(start, 0, None)]
+    for move in sorted(legal_moves(start, 0)):
+        frontier.append((play(start, 0, move), 1, None))
+    
+    positions = {}
+    seen = set()
+    while frontier:
+        board, player, count = frontier.pop(0)
+        state = (''.join(''.join(row) for row in board), player, count)
+        if state in seen:
+            continue
+        seen.add(state)
+        
+        legal = legal_moves(board, player)
+        candidates = [e for e in book if e not in positions and fits(e, legal) and
+                      (count is None or totals[e] == count)]
+        if board == start and count is None:
+            chosen = candidates  # 워커마다 따로 만든 시작 국면 엔트리
+        elif len(candidates) > 1:
+            scored = sorted(((child_matches(e, board, player), e) for e in candidates), reverse=True)
+            best = [e for score, e in scored if score == scored[0][0] and score > 0]
+            chosen = best if len(best) == 1 else []
+        else:
+            chosen = candidates
+        
+        for entry in chosen:
+            positions[entry] = (board, player)
+            for move, n in book[entry]['moves'].items():
+                frontier.append((play(board, player, move), 1 - player, n))
+    
+    return positions
+
+
+def export_book(src='opening_book.pkl.gz', dst=BOOK_FILE_NAME):
+    """pickle 오프닝 북을 client.c 가 mmap 하는 바이너리 북으로 변환
+    
+    레코드 (키, 수, weight, count) 를 키 순으로 정렬. 키와 수는 정규형 (symmetry.h) 기준이라
+    대칭인 국면은 한 엔트리로 합쳐진다. weight 는 그 국면에서 수가
+    둔 비율 (1/65535).
+    """
+    with gzip.open(src, 'rb') as f:
+        book = pickle.load(f).book
+    
+    positions = replay_book_positions(book)
+    
+    merged = {}
+    for entry, (board, player) in positions.items():
+        key, t = book_key(board, player)
+        moves = merged.setdefault(key, {})
+        for (r1, c1, r2, c2), count in book[entry]['moves'].items():
+            move = (sym_square(t, r1 * 8 + c1), sym_square(t, r2 * 8 + c2))
+            moves[move] = moves.get(move, 0) + count
+    
+    records = []
+    for key, moves in merged.items():
+        total = sum(moves.values())
+        for (src_sq, dst_sq), count in moves.items():
+            records.append((key, count, round(count * 65535 / total), src_sq, dst_sq))
+    records.sort(key=lambda rec: (rec[0], -rec[1], rec[3], rec[4]))
+    
+    payload = b''.join(struct.pack(BOOK_ENTRY_FORMAT, *rec) for rec in records)
+    
+    # FNV-1a
+    checksum = 2166136261
+    for byte in payload:
+        checksum = ((checksum ^ byte) * 16777619) & 0xFFFFFFFF
+    
+    tmp_filename = dst + '.tmp'
+    with open(tmp_filename, 'wb') as f:
+        f.write(struct.pack(BOOK_HEADER_FORMAT, BOOK_FILE_MAGIC, BOOK_FILE_VERSION, len(records), checksum))
+        f.write(payload)
+    os.replace(tmp_filename, dst)
+    
+    print(f"Recovered {len(positions)} of {len(book)} book positions; "
+          f"wrote {len(records)} moves for {len(merged)} positions to {dst}")
+
+
 # AI 플레이어들
 class SimpleAI:
     """NNUE 기반 AI"""
@@ -1334,7 +1598,10 @@ class StableTrainer:
                     
                     self.stats['games_played'] += 1
         
-        print(f" Done! {len(games_data)} positions")
+        # 대칭까지 같은 국면은 하나로 (오프닝 국면이 버퍼를 채우지 않도록)
+        collected = len(games_data)
+        games_data = dedupe_positions(games_data)
+        print(f" Done! {len(games_data)} positions ({collected} before merging symmetric positions)")
         
         # 승률 출력
         print("Win rates:")
@@ -1549,8 +1816,8 @@ class StableTrainer:
         best_nnue = self.population[0]
         best_nnue.save_weights('best_nnue_deep.pkl.gz')
         
-        # C 헤더 생성
-        best_nnue.export_to_c_arrays()
+        # 네트워크 파일 생성
+        best_nnue.export_network()
         
         # 통계 저장
         self.stats['generation'] = self.generation
@@ -1652,13 +1919,27 @@ class StableTrainer:
         
         print("\n💾 Files generated:")
         print("   - best_nnue_deep.pkl.gz (Python weights)")
-        print("   - nnue_weights_generated.h (C header)")
+        print(f"   - {NNUE_FILE_NAME} (C client network)")
         print("   - training_stats_deep.json (Statistics)")
         
         return self.population[0]
 
 
 def main():
+    # python3 train_octoflip.py --export-net [weights.pkl.gz] [octaflip.nnue]
+    if len(sys.argv) > 1 and sys.argv[1] == '--export-net':
+        src = sys.argv[2] if len(sys.argv) > 2 else 'best_nnue_deep.pkl.gz'
+        dst = sys.argv[3] if len(sys.argv) > 3 else NNUE_FILE_NAME
+        DeepNNUE(src).export_network(dst)
+        return
+    
+    # python3 train_octoflip.py --export-book [opening_book.pkl.gz] [octaflip.book]
+    if len(sys.argv) > 1 and sys.argv[1] == '--export-book':
+        src = sys.argv[2] if len(sys.argv) > 2 else 'opening_book.pkl.gz'
+        dst = sys.argv[3] if len(sys.argv) > 3 else BOOK_FILE_NAME
+        export_book(src, dst)
+        return
+    
     print("=== OctaFlip NNUE Training System v7.0 ===\n")
     
     print("Training options:")
@@ -0,0 +1,181 @@
+// wire.h - Binary framing of the OctaFlip protocol
+// Shared by the server and the client. A client asks for it with
+// "protocol": "binary" in its JSON register or spectate; once the ack (still a
+// JSON line) confirms it, both directions switch to frames.
+#ifndef WIRE_H
+#define WIRE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define WIRE_PROTOCOL_NAME "binary"
+
+// Frame: varint payload length, then the payload; payload[0] is the type
+#define WIRE_MAX_FRAME 1024
+#define WIRE_MAX_HEADER 5
+
+// Board: red, blue and blocked bitboards (bit r * 8 + c), little-endian
+#define WIRE_BOARD_BYTES 24
+
+// Move: (from << 6) | to with squares r * 8 + c, 2 bytes little-endian.
+// Real moves stay below 0x1000; the codes above are sentinels.
+#define WIRE_PASS_MOVE 0xFFFF
+#define WIRE_OFF_BOARD_MOVE 0xFFFE  // invalid_move only: coordinates outside the board
+
+// Colors in next-player and seat fields
+#define WIRE_RED 0
+#define WIRE_BLUE 1
+
+typedef enum {
+    // Client -> server
+    WIRE_REGISTER = 1,      // u8 flags (bit 0: human), string username
+    WIRE_MOVE,              // move
+    
+    // Server -> client
+    WIRE_REGISTER_ACK,      // (empty)
+    WIRE_REGISTER_NACK,     // string reason
+    WIRE_GAME_START,        // string red player, string blue player
+    WIRE_YOUR_TURN,         // board, varint timeout ms, varint time left ms
+    WIRE_MOVE_OK,           // board, move, u8 next player
+    WIRE_INVALID_MOVE,      // u8 flags (bit 0: board, move and u8 next player follow);
+                            // the move may be WIRE_OFF_BOARD_MOVE
+    WIRE_PASS,              // u8 next player
+    WIRE_GAME_OVER,         // varint red score, varint blue score
+    
+    // Spectators: a snapshot, then one delta per move or pass, then game over
+    WIRE_SPECTATE,          // varint game id (0: the latest game) - client -> server
+    WIRE_SPECTATE_NACK,     // string reason
+    WIRE_SNAPSHOT,          // varint game id, board, string red player, string blue player, u8 next player, varint moves
+    WIRE_DELTA              // move, u64 flipped squares (the mover's now), u8 next player
+} WireType;
+
+// ===== PRIMITIVES =====
+
+static inline size_t wire_putVarint(uint8_t* p, uint64_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+        p[n++] = (uint8_t)(v | 0x80);
+        v >>= 7;
+    }
+    p[n++] = (uint8_t)v;
+    return n;
+}
+
+// Bytes read, 0 if the buffer ends first, -1 if longer than 10 bytes
+static inline int wire_getVarint(const uint8_t* p, size_t len, uint64_t* v) {
+    uint64_t value = 0;
+    for (size_t n = 0; n < len && n < 10; n++) {
+        value |= (uint64_t)(p[n] & 0x7F) << (7 * n);
+        if (!(p[n] & 0x80)) {
+            *v = value;
+            return (int)n + 1;
+        }
+    }
+    return len >= 10 ? -1 : 0;
+}
+
+static inline void wire_putU64(uint8_t* p, uint64_t v) {
+    for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static inline uint64_t wire_getU64(const uint8_t* p) {
+    uint64_t v = 0;
+    for (int i = 0; i < 8; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+static inline size_t wire_putString(uint8_t* p, const char* s) {
+    size_t len = strlen(s);
+    if (len > 255) len = 255;
+    size_t n = wire_putVarint(p, len);
+    memcpy(p + n, s, len);
+    return n + len;
+}
+
+// Bytes read, 0 if malformed; out gets a NUL-terminated copy
+static inline size_t wire_getString(const uint8_t* p, size_t len, char* out, size_t outSize) {
+    uint64_t strLen;
+    int n = wire_getVarint(p, len, &strLen);
+    if (n <= 0 || strLen >= outSize || n + strLen > len) return 0;
+    memcpy(out, p + n, strLen);
+    out[strLen] = '\0';
+    return n + strLen;
+}
+
+// ===== BOARDS AND MOVES =====
+
+static inline size_t wire_putBoard(uint8_t* p, const char board[8][8]) {
+    uint64_t red = 0, blue = 0, blocked = 0;
+    for (int sq = 0; sq < 64; sq++) {
+        char cell = board[sq >> 3][sq & 7];
+        if (cell == 'R') red |= 1ULL << sq;
+        else if (cell == 'B') blue |= 1ULL << sq;
+        else if (cell == '#') blocked |= 1ULL << sq;
+    }
+    wire_putU64(p, red);
+    wire_putU64(p + 8, blue);
+    wire_putU64(p + 16, blocked);
+    return WIRE_BOARD_BYTES;
+}
+
+static inline void wire_getBoard(const uint8_t* p, char board[8][8]) {
+    uint64_t red = wire_getU64(p);
+    uint64_t blue = wire_getU64(p + 8);
+    uint64_t blocked = wire_getU64(p + 16);
+    for (int sq = 0; sq < 64; sq++) {
+        uint64_t bit = 1ULL << sq;
+        board[sq >> 3][sq & 7] = (red & bit) ? 'R' : (blue & bit) ? 'B' : (blocked & bit) ? '#' : '.';
+    }
+}
+
+// From the protocol's 1-indexed coordinates; (0, 0, 0, 0) is a pass
+static inline uint16_t wire_packMove(int sx, int sy, int tx, int ty) {
+    if (sx == 0 && sy == 0 && tx == 0 && ty == 0) return WIRE_PASS_MOVE;
+    return (uint16_t)((((sx - 1) * 8 + (sy - 1)) << 6) | ((tx - 1) * 8 + (ty - 1)));
+}
+
+static inline void wire_unpackMove(uint16_t move, int* sx, int* sy, int* tx, int* ty) {
+    if (move == WIRE_PASS_MOVE) {
+        *sx = *sy = *tx = *ty = 0;
+        return;
+    }
+    int from = (move >> 6) & 63, to = move & 63;
+    *sx = (from >> 3) + 1;
+    *sy = (from & 7) + 1;
+    *tx = (to >> 3) + 1;
+    *ty = (to & 7) + 1;
+}
+
+static inline size_t wire_putMove(uint8_t* p, uint16_t move) {
+    p[0] = (uint8_t)move;
+    p[1] = (uint8_t)(move >> 8);
+    return 2;
+}
+
+static inline uint16_t wire_getMove(const uint8_t* p) {
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+// ===== FRAMES =====
+
+// Write the length header for a payload of len bytes; returns its size
+static inline size_t wire_putHeader(uint8_t* p, size_t len) {
+    return wire_putVarint(p, len);
+}
+
+// Find the next complete frame in buf. Returns the bytes it spans, 0 if it
+// has not fully arrived, -1 if the stream is corrupt.
+static inline int wire_nextFrame(const uint8_t* buf, size_t len, const uint8_t** payload, size_t* payloadLen) {
+    uint64_t frameLen;
+    int n = wire_getVarint(buf, len < WIRE_MAX_HEADER ? len : WIRE_MAX_HEADER, &frameLen);
+    if (n < 0 || (n == 0 && len >= WIRE_MAX_HEADER)) return -1;
+    if (n == 0) return 0;
+    if (frameLen == 0 || frameLen > WIRE_MAX_FRAME) return -1;
+    if (n + frameLen > len) return 0;
+    *payload = buf + n;
+    *payloadLen = (size_t)frameLen;
+    return n + (int)frameLen;
+}
+
+#endif // WIRE_H